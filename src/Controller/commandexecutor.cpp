@@ -0,0 +1,230 @@
+// [file name] : commandexecutor.cpp
+// [function] : implement the CommandExecutor class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the CommandExecutor class
+// reason: to run long commands on a worker thread
+// -----------------------------------------------------------
+
+#include "commandexecutor.hpp"
+#include <exception>
+#include <utility>
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : CommandExecutor
+// [function] : constructor of the CommandExecutor class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+CommandExecutor::CommandExecutor() : m_nextTicket(1), m_stopping(false) {}
+
+// -----------------------------------------------------------
+// [name] : ~CommandExecutor
+// [function] : destructor of the CommandExecutor class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+CommandExecutor::~CommandExecutor() {
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+        // the queued jobs are not run, the worker answers them
+        for (const shared_ptr<Task>& task : m_queue) {
+            task->TaskProgress.Cancel();
+        }
+    }
+    m_condition.notify_all();
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Submit
+// [function] : queue a job for the worker thread
+// [input] : the job, the number of steps of the job
+// [output] : the ticket of the job
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+CommandExecutor::Ticket CommandExecutor::Submit(Job job, uint64_t steps) {
+    shared_ptr<Task> task = make_shared<Task>();
+    task->Function = move(job);
+    task->Future = task->Promise.get_future().share();
+    task->State = JobState::QUEUED;
+    task->TaskProgress.SetTotalSteps(steps);
+    Ticket ticket;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        ticket = m_nextTicket++;
+        m_tasks[ticket] = task;
+        m_queue.push_back(task);
+        // start the worker with the first job
+        if (!m_worker.joinable()) {
+            m_worker = thread(&CommandExecutor::WorkerLoop, this);
+        }
+    }
+    m_condition.notify_one();
+    return ticket;
+}
+
+// -----------------------------------------------------------
+// [name] : GetStatus
+// [function] : get the state and the progress of a job
+// [input] : the ticket, the status to fill
+// [output] : false if the ticket is unknown
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool CommandExecutor::GetStatus(Ticket ticket, JobStatus& status) const {
+    lock_guard<mutex> lock(m_mutex);
+    shared_ptr<Task> task = FindTask(ticket);
+    if (!task) {
+        return false;
+    }
+    const Progress& progress = task->TaskProgress;
+    status.State = task->State;
+    status.Cancelled = progress.IsCancelled();
+    status.TotalBytes = progress.GetTotalBytes();
+    status.Bytes = progress.GetBytes();
+    status.Faces = progress.GetFaces();
+    status.Lines = progress.GetLines();
+    status.TotalSteps = progress.GetTotalSteps();
+    status.Steps = progress.GetSteps();
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Cancel
+// [function] : ask a job to stop
+// [input] : the ticket
+// [output] : false if the ticket is unknown or the job is done
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool CommandExecutor::Cancel(Ticket ticket) {
+    lock_guard<mutex> lock(m_mutex);
+    shared_ptr<Task> task = FindTask(ticket);
+    if (!task || task->State == JobState::DONE) {
+        return false;
+    }
+    task->TaskProgress.Cancel();
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : TryCollect
+// [function] : get the responses of a job if it is done
+// [input] : the ticket, the vector receiving the responses
+// [output] : false if the ticket is unknown or the job is not done
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool CommandExecutor::TryCollect(Ticket ticket,
+                                 vector<Response>& responses) {
+    shared_ptr<Task> task;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        task = FindTask(ticket);
+        if (!task || task->State != JobState::DONE) {
+            return false;
+        }
+        m_tasks.erase(ticket);
+    }
+    // the result is set before the state becomes DONE
+    responses = task->Future.get();
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Collect
+// [function] : wait for a job and get its responses
+// [input] : the ticket, the vector receiving the responses
+// [output] : false if the ticket is unknown
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool CommandExecutor::Collect(Ticket ticket, vector<Response>& responses) {
+    shared_ptr<Task> task;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        task = FindTask(ticket);
+        if (!task) {
+            return false;
+        }
+        m_tasks.erase(ticket);
+    }
+    responses = task->Future.get();
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : WorkerLoop
+// [function] : run the queued jobs until the executor is destroyed
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void CommandExecutor::WorkerLoop() {
+    while (true) {
+        shared_ptr<Task> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() {
+                return m_stopping || !m_queue.empty();
+            });
+            if (m_queue.empty()) {
+                return;
+            }
+            task = m_queue.front();
+            m_queue.pop_front();
+            task->State = JobState::RUNNING;
+        }
+        if (task->TaskProgress.IsCancelled()) {
+            // cancelled while it was queued, it is not run
+            task->Promise.set_value(vector<Response>{
+                Response(Response::ResponseKey::CANCELLED, {})});
+        }
+        else {
+            try {
+                task->Promise.set_value(task->Function(task->TaskProgress));
+            }
+            catch (...) {
+                task->Promise.set_exception(current_exception());
+            }
+        }
+        // release the captured arguments of the job
+        task->Function = nullptr;
+        lock_guard<mutex> lock(m_mutex);
+        task->State = JobState::DONE;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : FindTask
+// [function] : find a task by ticket
+// [input] : the ticket
+// [output] : the task, nullptr if the ticket is unknown
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+shared_ptr<CommandExecutor::Task> CommandExecutor::FindTask(
+    Ticket ticket) const {
+    auto it = m_tasks.find(ticket);
+    if (it == m_tasks.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
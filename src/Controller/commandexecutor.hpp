@@ -0,0 +1,129 @@
+// [file name] : commandexecutor.hpp
+// [function] : declare the CommandExecutor class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init CommandExecutor class
+// reason: a large import or export ran on the thread of the viewer,
+//         which could not show anything until it was done
+// -----------------------------------------------------------
+
+#ifndef COMMANDEXECUTOR_HPP
+#define COMMANDEXECUTOR_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../Message/response.hpp"
+#include "../Model/Progress/progress.hpp"
+
+using namespace std;
+
+// notes on the class CommandExecutor
+// -----------------------------------------------------------
+// [class name] : CommandExecutor
+// [function] : run jobs one after another on a worker thread
+// [notes on interface] :
+// 1. Submit queues a job and returns a ticket at once, the job is a
+//    function that gets a Progress to report to and returns the responses
+// 2. the worker thread is started by the first Submit, it runs the jobs
+//    in the order they were submitted
+// 3. GetStatus reads the state and the progress of a job, Cancel asks
+//    the job to stop. a queued job that is cancelled is not run, its
+//    only response is CANCELLED. a running job stops when it next
+//    checks its Progress
+// 4. TryCollect returns false while the job is not done, Collect waits
+//    for it. both forget the ticket after handing out the responses,
+//    and rethrow an exception that escaped the job
+// 5. all functions can be called from any thread. the destructor cancels
+//    the queued jobs and waits for the running one
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class CommandExecutor
+{
+public:
+    // ticket of a submitted job, 0 is never used
+    using Ticket = uint64_t;
+    // a job, gets the progress to report to and returns the responses
+    using Job = function<vector<Response>(Progress& progress)>;
+    // notes for the JobState enum class
+    // -----------------------------------------------------------
+    // [enum class name] : JobState
+    // [function] : define the states of a job
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -----------------------------------------------------------
+    enum class JobState {
+        QUEUED,
+        RUNNING,
+        DONE
+    };
+    // state and progress of a job
+    struct JobStatus {
+        JobState State;
+        bool Cancelled;
+        uint64_t TotalBytes;
+        uint64_t Bytes;
+        uint64_t Faces;
+        uint64_t Lines;
+        uint64_t TotalSteps;
+        uint64_t Steps;
+    };
+
+    // constructor, no thread is started yet
+    CommandExecutor();
+    // destructor, cancel the queued jobs and stop the worker thread
+    ~CommandExecutor();
+    // queue a job with a number of steps, return its ticket
+    Ticket Submit(Job job, uint64_t steps);
+    // get the state and the progress of a job, false for an unknown ticket
+    bool GetStatus(Ticket ticket, JobStatus& status) const;
+    // ask a job to stop, false for an unknown or finished job
+    bool Cancel(Ticket ticket);
+    // get the responses of a finished job, false if it is not done
+    bool TryCollect(Ticket ticket, vector<Response>& responses);
+    // wait for a job and get its responses, false for an unknown ticket
+    bool Collect(Ticket ticket, vector<Response>& responses);
+
+private:
+    // a submitted job with its progress and its result
+    struct Task {
+        Job Function;
+        Progress TaskProgress;
+        promise<vector<Response>> Promise;
+        shared_future<vector<Response>> Future;
+        JobState State;
+    };
+    // no copies, the worker thread refers to the executor
+    CommandExecutor(const CommandExecutor&) = delete;
+    void operator=(const CommandExecutor&) = delete;
+    // body of the worker thread
+    void WorkerLoop();
+    // find a task by ticket, the mutex must be locked
+    shared_ptr<Task> FindTask(Ticket ticket) const;
+
+    // private member variables
+    // the mutex guards the queue, the tasks and the states of the tasks
+    mutable mutex m_mutex;
+    condition_variable m_condition;
+    deque<shared_ptr<Task>> m_queue;
+    unordered_map<Ticket, shared_ptr<Task>> m_tasks;
+    Ticket m_nextTicket;
+    bool m_stopping;
+    thread m_worker;
+};
+
+#endif // COMMANDEXECUTOR_HPP
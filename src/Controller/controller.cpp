@@ -21,6 +21,105 @@
 // edit: add functions to handle face and line operations
 // reason: to support face and line operations
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: handle the error codes returned by the model
+//       map the error codes onto response keys with a table
+// reason: every rejected input paid for a throw, an unwind and a chain
+//         of string comparisons
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: parse points with the PointParser class
+// reason: the regex was compiled again for every point
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: return the displayed faces, lines, points and statistics as
+//       typed payloads
+// reason: every point of every face was formatted into a string,
+//         even if the caller only needed the number of faces
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: list faces and lines in pages, count them, stream them
+// reason: to list models with millions of faces
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: run batches in the background, report their progress
+// reason: a large import or export froze the viewer
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: run read-only batches under a shared lock
+// reason: to answer the queries of several clients of the server at once
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: answer repeated queries from a cache
+// reason: to avoid computing the same responses on an unchanged model
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: record the metrics of the arguments, the responses and the files
+//       handle the DISPLAY_METRICS argument
+// reason: there was no way to tell which commands were slow
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add trace spans to HandleArguments and to every argument
+// reason: to see the commands next to the phases of the model
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: handle the DISPLAY_MEMORY argument, record the peak allocation
+//       of every argument
+// reason: to tell how much memory a model and a command use
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: create the instance thread-safely, publish the model as a
+//       snapshot, writers edit a copy and are serialized by a mutex
+// reason: queries waited for a whole import or edit, and two threads
+//         could create two instances
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: sum the statistics on the TaskScheduler, reset its counters
+//       with the metrics
+// reason: the statistics of a big model walked every element on one
+//         thread
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: take the statistics from Model3D::GetStatistics
+// reason: the statistics copied every point of the model and walked
+//         the elements three times
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: handle the FILE_STATISTICS argument
+// reason: to get the statistics of a file without importing it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the enclosed volume to the statistics, handle the
+//       DISPLAY_TOPOLOGY argument
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: start the clock and the peak before the copy of the model
+// reason: the copy for the first edit of a writer was not charged to
+//         the argument that made it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: reset and record the peak allocation only in writers
+// reason: the peak is global, queries running beside each other reset
+//         it under the argument of another batch
+// -----------------------------------------------------------
 
 #include "controller.hpp"
 #include <stdexcept>
@@ -33,20 +132,82 @@
 #include "../Model/Model3D/model3d.hpp"
 #include "../Message/argument.hpp"
 #include "../Message/response.hpp"
+#include "../Message/responsepayload.hpp"
+#include "pointparser.hpp"
+#include "../Model/Trace/tracer.hpp"
+#include "../Model/Memory/allocationcounter.hpp"
+#include "../Model/Parallel/taskscheduler.hpp"
 #include <string>
 #include <iostream>
 #include <sstream>
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
-#include <regex>
+#include <limits>
+#include <utility>
+#include <cstdlib>
+#include <cstdint>
+#include <cerrno>
+#include <fstream>
 
 using namespace std;
 using ArgKey = Argument::ArgumentKey;
 using ResKey = Response::ResponseKey;
 
-// Singleton pattern
-Controller* Controller::m_instance = nullptr;
+// -----------------------------------------------------------
+// [name] : ErrorResponse
+// [function] : build the response of an error code
+// [input] : the error code
+// [output] : the response with the mapped key and no values
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static Response ErrorResponse(ErrorCode code)
+{
+    return Response(Controller::ToResponseKey(code), {});
+}
+
+// -----------------------------------------------------------
+// [name] : StatisticsResponse
+// [function] : build the response of some statistics
+// [input] : the statistics of a model or a file
+// [output] : DISPLAY_STATISTICS with the counts, the sums, the volume
+//            of the bounding box and the enclosed volume
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static Response StatisticsResponse(const Model3D::Statistics& sums)
+{
+    vector<NumbersPayload::Entry> statistics = {
+        {"Number of faces", static_cast<double>(sums.Faces), true},
+        {"Total area", sums.TotalArea, false},
+        {"Number of lines", static_cast<double>(sums.Lines), true},
+        {"Total length", sums.TotalLength, false},
+        {"Number of points", static_cast<double>(sums.Points), true},
+        {"minimum_surrounding_cube_volume", sums.BoxVolume(), false},
+        {"Enclosed volume", sums.EnclosedVolume, false}
+    };
+    return Response(ResKey::DISPLAY_STATISTICS,
+                    make_shared<NumbersPayload>(statistics));
+}
+
+// -----------------------------------------------------------
+// [name] : FileSize
+// [function] : get the size of a file
+// [input] : the path of the file
+// [output] : the size in bytes, 0 if it cannot be opened
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t FileSize(const string& path)
+{
+    ifstream file(path, ios::binary | ios::ate);
+    if (!file.is_open()) {
+        return 0;
+    }
+    streamoff size = file.tellg();
+    return size > 0 ? static_cast<uint64_t>(size) : 0;
+}
 
 // -----------------------------------------------------------
 // [name] : GetInstance
@@ -56,19 +217,391 @@ Controller* Controller::m_instance = nullptr;
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: keep the instance in a static local variable
+// reason: two threads calling it first could both create an instance
+// -----------------------------------------------------------
 Controller* Controller::GetInstance()
 {
-    if (!m_instance)
-    {
-        m_instance = new Controller();
-    }
-    return m_instance;
+    // the first call constructs it, the others wait until it is done,
+    // it is destroyed when the program exits
+    static Controller instance;
+    return &instance;
 }
 
 // -----------------------------------------------------------
 // [name] : HandleArguments
-// [function] : handle the arguments passed from the viewer
+// [function] : handle the arguments passed from the viewer in order
+// [input] : vector of arguments, what to do after a failed argument
+// [output] : the responses to the viewer, one per executed argument
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<Response> Controller::HandleArguments(
+            const vector<Argument>& arguments, BatchMode mode)
+{
+    // includes the wait for the lock
+    TRACE_SCOPE("controller", "HandleArguments");
+    // queries read the published model without a lock, it is never
+    // changed, even while a writer works on the next one
+    if (IsReadOnly(arguments)) {
+        shared_ptr<Model3D> model = LoadModel();
+        return ExecuteArguments(arguments, mode, nullptr, model, false);
+    }
+    // every other batch waits for the running writer, e.g. for a batch
+    // running in the background
+    lock_guard<mutex> lock(m_writeMutex);
+    shared_ptr<Model3D> model = LoadModel();
+    vector<Response> responses = 
+        ExecuteArguments(arguments, mode, nullptr, model, true);
+    PublishModel(model);
+    return responses;
+}
+
+// -----------------------------------------------------------
+// [name] : HandleArgumentsAsync
+// [function] : queue the arguments on the worker thread
+// [input] : vector of arguments, what to do after a failed argument
+// [output] : the ticket of the batch
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Controller::Ticket Controller::HandleArgumentsAsync(
+            const vector<Argument>& arguments, BatchMode mode)
+{
+    return m_executor.Submit(
+        [this, arguments, mode](Progress& progress) {
+            lock_guard<mutex> lock(m_writeMutex);
+            // the import reads the progress through the member
+            m_progress = &progress;
+            shared_ptr<Model3D> model = LoadModel();
+            vector<Response> responses = 
+                ExecuteArguments(arguments, mode, &progress, model, true);
+            m_progress = nullptr;
+            // the queries answered from the old model until now
+            PublishModel(model);
+            return responses;
+        }, arguments.size());
+}
+
+// -----------------------------------------------------------
+// [name] : GetJobStatus
+// [function] : get the state and the progress of a background batch
+// [input] : the ticket, the status to fill
+// [output] : false if the ticket is unknown
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Controller::GetJobStatus(Ticket ticket, 
+                              CommandExecutor::JobStatus& status) const
+{
+    return m_executor.GetStatus(ticket, status);
+}
+
+// -----------------------------------------------------------
+// [name] : CancelJob
+// [function] : ask a background batch to stop
+// [input] : the ticket
+// [output] : false if the ticket is unknown or the batch is done
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Controller::CancelJob(Ticket ticket)
+{
+    return m_executor.Cancel(ticket);
+}
+
+// -----------------------------------------------------------
+// [name] : TryCollectJob
+// [function] : get the responses of a finished background batch
+// [input] : the ticket, the vector receiving the responses
+// [output] : false if the ticket is unknown or the batch is not done
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Controller::TryCollectJob(Ticket ticket, vector<Response>& responses)
+{
+    return m_executor.TryCollect(ticket, responses);
+}
+
+// -----------------------------------------------------------
+// [name] : CollectJob
+// [function] : wait for a background batch and get its responses
+// [input] : the ticket, the vector receiving the responses
+// [output] : false if the ticket is unknown
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Controller::CollectJob(Ticket ticket, vector<Response>& responses)
+{
+    return m_executor.Collect(ticket, responses);
+}
+
+// -----------------------------------------------------------
+// [name] : ExecuteArguments
+// [function] : execute the arguments in order
+// [input] : vector of arguments, what to do after a failed argument,
+//           the progress of a background batch or nullptr, the model,
+//           replaced by a copy before the first edit of a writer,
+//           true for a writer, which holds the writer mutex
+// [output] : the responses, one per executed argument
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<Response> Controller::ExecuteArguments(
+            const vector<Argument>& arguments, BatchMode mode,
+            Progress* progress, shared_ptr<Model3D>& model, bool writer)
+{
+    // the model the batch started with, it may be published already
+    const Model3D* published = model.get();
+    vector<Response> responses;
+    responses.reserve(arguments.size());
+    size_t begin = 0;
+    while (begin < arguments.size()) {
+        if (progress && progress->IsCancelled()) {
+            // the remaining arguments are not executed
+            responses.push_back(Response(ResKey::CANCELLED, {}));
+            if (m_metrics.IsEnabled()) {
+                m_metrics.RecordResponse(ResKey::CANCELLED);
+            }
+            break;
+        }
+        ArgKey key = arguments[begin].GetKey();
+        // one span per argument, or per run of a bulk operation
+        TRACE_SCOPE("controller", Argument::KeyName(key));
+        // find the run of consecutive arguments that can be coalesced
+        size_t end = begin + 1;
+        if (key == ArgKey::ADD_FACE || key == ArgKey::ADD_LINE) {
+            while (end < arguments.size() && 
+                   arguments[end].GetKey() == key) {
+                end++;
+            }
+        }
+        // the clock is only read while the metrics are sampled, the
+        // copy below is charged to the argument that needs it
+        bool sampled = m_metrics.IsEnabled();
+        uint64_t start = sampled ? Metrics::Now() : 0;
+        // the peak is of the whole program, only writers run one at a
+        // time, so the peak of a query beside them is not recorded
+        bool counted = sampled && writer && AllocationCounter::IsAvailable();
+        size_t base = 0;
+        if (counted) {
+            base = AllocationCounter::GetCurrentBytes();
+            AllocationCounter::ResetPeak();
+        }
+        // the published model may be read by queries at any time, it is
+        // copied before it is edited. the copy shares the faces and lines
+        if (model && model.get() == published && EditsModel(key)) {
+            model = make_shared<Model3D>(model->ShareElements());
+        }
+        size_t first = responses.size();
+        if (end - begin > 1 && key == ArgKey::ADD_FACE) {
+            AddFaces(arguments, begin, end, mode, responses, model);
+        }
+        else if (end - begin > 1 && key == ArgKey::ADD_LINE) {
+            AddLines(arguments, begin, end, mode, responses, model);
+        }
+        else {
+            responses.push_back(
+                HandleCachedArgument(arguments[begin], model));
+        }
+        if (sampled) {
+            // the executed arguments of a bulk operation share its time
+            size_t executed = responses.size() - first;
+            uint64_t duration = (Metrics::Now() - start) / 
+                                max<size_t>(executed, 1);
+            for (size_t i = 0; i < executed; i++) {
+                m_metrics.RecordArgument(arguments[begin + i].GetKey(),
+                                         duration);
+                m_metrics.RecordResponse(responses[first + i].GetKey());
+            }
+            // the peak of a bulk operation is the peak of its run
+            size_t peak = counted ? AllocationCounter::GetPeakBytes() : 0;
+            if (peak > base) {
+                m_metrics.RecordPeakBytes(key, peak - base);
+            }
+        }
+        // the bulk operations stop by themselves, so only the last
+        // response needs to be checked
+        if (mode == BatchMode::STOP_ON_ERROR && !responses.empty() && 
+            !responses.back().IsSuccess()) {
+            break;
+        }
+        if (progress) {
+            progress->AddSteps(end - begin);
+        }
+        begin = end;
+    }
+    return responses;
+}
+
+// -----------------------------------------------------------
+// [name] : GetCacheStatistics
+// [function] : get the counters and the size of the query cache
+// [input] : none
+// [output] : the statistics of the cache
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+QueryCache::Statistics Controller::GetCacheStatistics() const
+{
+    return m_queryCache.GetStatistics();
+}
+
+// -----------------------------------------------------------
+// [name] : SetCacheLimits
+// [function] : change the limits of the query cache
+// [input] : the maximum number of responses and of their values
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Controller::SetCacheLimits(size_t maxEntries, size_t maxRows)
+{
+    m_queryCache.SetLimits(maxEntries, maxRows);
+}
+
+// -----------------------------------------------------------
+// [name] : GetMetrics
+// [function] : get the metrics of the arguments, the responses and
+//              the files
+// [input] : none
+// [output] : the metrics
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Metrics& Controller::GetMetrics()
+{
+    return m_metrics;
+}
+
+// -----------------------------------------------------------
+// [name] : HandleCachedArgument
+// [function] : handle one argument, a read-only argument is answered
+//              from the cache if it was handled on the same version
+//              of the model
+// [input] : the argument, the model of the batch
+// [output] : the response to the viewer
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Response Controller::HandleCachedArgument(const Argument& argument,
+                                          shared_ptr<Model3D>& model)
+{
+    ArgKey key = argument.GetKey();
+    // the metrics and the memory change with every argument, and the
+    // statistics of a file do not depend on the model
+    if (!model || !IsReadOnly(key) || key == ArgKey::DISPLAY_METRICS ||
+        key == ArgKey::DISPLAY_MEMORY || key == ArgKey::FILE_STATISTICS) {
+        return HandleArgument(argument, model);
+    }
+    vector<string> values = argument.GetValues();
+    uint64_t version = model->GetVersion();
+    Response response(ResKey::UNKNOWN, {});
+    if (m_queryCache.Find(key, values, version, response)) {
+        return response;
+    }
+    response = HandleArgument(argument, model);
+    // errors are cheap to compute again
+    if (response.IsSuccess()) {
+        m_queryCache.Insert(key, values, version, response);
+    }
+    return response;
+}
+
+// -----------------------------------------------------------
+// [name] : IsReadOnly
+// [function] : check if an argument only reads the model
+// [input] : the argument key
+// [output] : true for the display and count arguments, and for
+//            DISPLAY_METRICS and FILE_STATISTICS, which do not use
+//            the model, and DISPLAY_MEMORY
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Controller::IsReadOnly(ArgKey key)
+{
+    return key == ArgKey::DISPLAY_ALL_FACES || 
+           key == ArgKey::DISPLAY_FACE_POINTS ||
+           key == ArgKey::DISPLAY_ALL_LINES || 
+           key == ArgKey::DISPLAY_LINE_POINTS ||
+           key == ArgKey::DISPLAY_STATISTICS || 
+           key == ArgKey::DISPLAY_TOPOLOGY ||
+           key == ArgKey::COUNT_FACES || key == ArgKey::COUNT_LINES ||
+           key == ArgKey::DISPLAY_METRICS ||
+           key == ArgKey::DISPLAY_MEMORY ||
+           key == ArgKey::FILE_STATISTICS;
+}
+
+// -----------------------------------------------------------
+// [name] : IsReadOnly
+// [function] : check if every argument of a batch only reads the model
 // [input] : vector of arguments
+// [output] : true if no argument changes the model
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Controller::IsReadOnly(const vector<Argument>& arguments)
+{
+    for (const Argument& argument : arguments) {
+        if (!IsReadOnly(argument.GetKey())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : EditsModel
+// [function] : check if an argument changes the model in place
+// [input] : the argument key
+// [output] : true for adding, deleting and modifying faces and lines,
+//            an import replaces the model and an export reads it
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Controller::EditsModel(ArgKey key)
+{
+    return key == ArgKey::ADD_FACE || key == ArgKey::ADD_LINE ||
+           key == ArgKey::DELETE_FACE || key == ArgKey::DELETE_LINE ||
+           key == ArgKey::MODIFY_FACE_POINT ||
+           key == ArgKey::MODIFY_LINE_POINT;
+}
+
+// -----------------------------------------------------------
+// [name] : LoadModel
+// [function] : get the published model
+// [input] : none
+// [output] : the model, nullptr if none was imported
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+shared_ptr<Model3D> Controller::LoadModel() const
+{
+    return atomic_load(&m_model);
+}
+
+// -----------------------------------------------------------
+// [name] : PublishModel
+// [function] : make a model the one read by the next queries
+// [input] : the model
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Controller::PublishModel(const shared_ptr<Model3D>& model)
+{
+    // the queries still reading the old model keep it alive
+    atomic_store(&m_model, model);
+}
+
+// -----------------------------------------------------------
+// [name] : HandleArgument
+// [function] : handle one argument passed from the viewer
+// [input] : the argument, the model of the batch
 // [output] : the response to the viewer
 // [author] : Huayu Chen
 // [date] : 2024/8/2
@@ -96,517 +629,821 @@ Controller* Controller::GetInstance()
 // edit: fix some bugs about exception handling
 // reason: to support handling some error
 // -----------------------------------------------------------
-Response Controller::HandleArguments(vector<Argument> arguments)
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: use the error codes of the model instead of exceptions
+//       check the number of values before reading them
+// reason: to reject invalid input without throwing
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: handle one argument, HandleArguments runs the batch
+// reason: to execute every argument of a batch
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: work on the model of the batch instead of the member
+// reason: queries read the published model while a writer edits a copy
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: sum the statistics on the TaskScheduler
+// reason: the statistics of a big model walked every element on one
+//         thread
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: take the statistics from Model3D::GetStatistics
+// reason: the statistics copied every point of the model and walked
+//         the elements three times
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: handle the FILE_STATISTICS argument
+// reason: to get the statistics of a file without importing it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: handle the DISPLAY_TOPOLOGY argument
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
+Response Controller::HandleArgument(const Argument& argument,
+                                    shared_ptr<Model3D>& model)
 {
     try {
-        ArgKey key = arguments[0].GetKey();
+        ArgKey key = argument.GetKey();
+        vector<string> values = argument.GetValues();
+        // number of values each key needs
+        size_t required = 0;
+        if (key == ArgKey::IMPORT_3D_MODEL || key == ArgKey::EXPORT_3D_MODEL
+            || key == ArgKey::DISPLAY_FACE_POINTS || key == ArgKey::DELETE_FACE
+            || key == ArgKey::DISPLAY_LINE_POINTS 
+            || key == ArgKey::DELETE_LINE 
+            || key == ArgKey::FILE_STATISTICS) {
+            required = 1;
+        }
+        else if (key == ArgKey::MODIFY_FACE_POINT || 
+                 key == ArgKey::MODIFY_LINE_POINT) {
+            required = 3;
+        }
+        if (values.size() < required) {
+            return ErrorResponse(ErrorCode::INVALID_INPUT);
+        }
+
         if (key == ArgKey::IMPORT_3D_MODEL) {
             // import 3D model
-            Import3DModel(arguments[0].GetValues()[0]);
+            ErrorCode code = Import3DModel(model, values[0]);
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
             return Response(ResKey::IMPORT_SUCCESS, {});
         }
         else if (key == ArgKey::EXPORT_3D_MODEL) {
             // export 3D model
-            Export3DModel(arguments[0].GetValues()[0]);
+            ErrorCode code = Export3DModel(model, values[0]);
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
             return Response(ResKey::EXPORT_SUCCESS, {});
         }
         else if (key == ArgKey::DISPLAY_ALL_FACES) {
             // get all faces
-            if (!m_model) {
-                throw runtime_error("There is no 3D model to display.");
-            }
-            vector<shared_ptr<Face3D>> faces = m_model->GetFaces();
-            vector<string> face_strings;
-            for (const shared_ptr<Face3D>& face_ptr : faces) {
-                string one_face_strings = "";
-                for (const Point3D& point : face_ptr->GetPoints()) {
-                    one_face_strings += point.ToString();
-                    // add a space between points
-                    one_face_strings += " ";
-                }
-                face_strings.push_back(one_face_strings);
-            }
-            return Response(ResKey::DISPLAY_ALL_FACES, face_strings);
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
+            }
+            const vector<shared_ptr<Face3D>>& faces = model->GetFaces();
+            // get the page, all faces without an offset and a limit
+            size_t offset = 0;
+            size_t limit = SIZE_MAX;
+            ErrorCode code = StringsToPage(values, faces.size(), offset, 
+                                           limit);
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
+            // share the faces, they are formatted when they are printed
+            return Response(ResKey::DISPLAY_ALL_FACES,
+                make_shared<ElementsPayload<Face3D>>(faces, offset, limit));
         }
         else if (key == ArgKey::DISPLAY_FACE_POINTS) {
             // check if model exists
-            if (!m_model) {
-                throw runtime_error("There is no 3D model to display.");
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
             }
             // get the face index
-            int index = stoi(arguments[0].GetValues()[0]);
-            if (index >= m_model->GetFaces().size() || index < 0) {
-                return Response(ResKey::INDEX_OUT_OF_RANGE, {});
+            Result<int> index = StringToIndex(values[0]);
+            if (!index.IsOk()) {
+                return ErrorResponse(index.GetError());
             }
-            // get the face points
-            vector<shared_ptr<Face3D>> faces = m_model->GetFaces();
-            vector<string> point_strings;
-            for (const Point3D& point : faces[index]->GetPoints()) {
-                point_strings.push_back(point.ToString());
+            const vector<shared_ptr<Face3D>>& faces = model->GetFaces();
+            if (index.GetValue() < 0 || 
+                index.GetValue() >= static_cast<int>(faces.size())) {
+                return ErrorResponse(ErrorCode::INDEX_OUT_OF_RANGE);
             }
-            return Response(ResKey::DISPLAY_FACE_POINTS, point_strings);
+            // get the face points
+            return Response(ResKey::DISPLAY_FACE_POINTS,
+                make_shared<PointsPayload>(
+                    faces[index.GetValue()]->GetPoints()));
         }
         else if (key == ArgKey::DISPLAY_ALL_LINES) {
             // check if model exists
-            if (!m_model) {
-                throw runtime_error("There is no 3D model to display.");
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
             }
             // get all lines
-            vector<shared_ptr<Line3D>> lines = m_model->GetLines();
-            vector<string> line_strings;
-            for (const shared_ptr<Line3D>& line_ptr : lines) {
-                string one_line_string = "";
-                for (const Point3D& point : line_ptr->GetPoints()) {
-                    one_line_string += point.ToString();
-                    one_line_string += " ";
-                }
-                line_strings.push_back(one_line_string);
-            }
-            return Response(ResKey::DISPLAY_ALL_LINES, line_strings);
+            const vector<shared_ptr<Line3D>>& lines = model->GetLines();
+            // get the page, all lines without an offset and a limit
+            size_t offset = 0;
+            size_t limit = SIZE_MAX;
+            ErrorCode code = StringsToPage(values, lines.size(), offset, 
+                                           limit);
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
+            return Response(ResKey::DISPLAY_ALL_LINES,
+                make_shared<ElementsPayload<Line3D>>(lines, offset, limit));
         }
         else if (key == ArgKey::DISPLAY_LINE_POINTS) {
             // check if model exists
-            if (!m_model) {
-                throw runtime_error("There is no 3D model to display.");
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
             }
             // get the line index
-            int index = stoi(arguments[0].GetValues()[0]);
-            if (index >= m_model->GetLines().size() || index < 0) {
-                return Response(ResKey::INDEX_OUT_OF_RANGE, {});
+            Result<int> index = StringToIndex(values[0]);
+            if (!index.IsOk()) {
+                return ErrorResponse(index.GetError());
             }
-            // get the line points
-            vector<shared_ptr<Line3D>> lines = m_model->GetLines();
-            vector<string> point_strings;
-            for (const Point3D& point : lines[index]->GetPoints()) {
-                point_strings.push_back(point.ToString());
+            const vector<shared_ptr<Line3D>>& lines = model->GetLines();
+            if (index.GetValue() < 0 || 
+                index.GetValue() >= static_cast<int>(lines.size())) {
+                return ErrorResponse(ErrorCode::INDEX_OUT_OF_RANGE);
             }
-            return Response(ResKey::DISPLAY_LINE_POINTS, point_strings);
+            // get the line points
+            return Response(ResKey::DISPLAY_LINE_POINTS,
+                make_shared<PointsPayload>(
+                    lines[index.GetValue()]->GetPoints()));
         }
         else if (key == ArgKey::DISPLAY_STATISTICS) {
-            if (!m_model) {
-                throw runtime_error("There is no 3D model to display.");
-            }
-            // get the number of faces, lines, and points
-            vector<shared_ptr<Face3D>> faces = m_model->GetFaces();
-            vector<shared_ptr<Line3D>> lines = m_model->GetLines();
-            vector<Point3D> points = m_model->GetPoints();
-            // get the total area of the faces
-            double total_area = 0.0;
-            for (const shared_ptr<Face3D>& face_ptr : faces) {
-                total_area += face_ptr->Area();
-            }
-            // get the total length of the lines
-            double total_length = 0.0;
-            for (const shared_ptr<Line3D>& line_ptr : lines) {
-                total_length += line_ptr->Length();
-            }
-            // get minimum and maximum x, y, and z values of the points
-            double min_x = numeric_limits<double>::max();
-            double max_x = numeric_limits<double>::min();
-            double min_y = numeric_limits<double>::max();
-            double max_y = numeric_limits<double>::min();
-            double min_z = numeric_limits<double>::max();
-            double max_z = numeric_limits<double>::min();
-            // get the minimum surrounding cube volume
-            for (const Point3D& point : points) {
-                if (point.X < min_x) {
-                    min_x = point.X;
-                }
-                if (point.X > max_x) {
-                    max_x = point.X;
-                }
-                if (point.Y < min_y) {
-                    min_y = point.Y;
-                }
-                if (point.Y > max_y) {
-                    max_y = point.Y;
-                }
-                if (point.Z < min_z) {
-                    min_z = point.Z;
-                }
-                if (point.Z > max_z) {
-                    max_z = point.Z;
-                }
-            }
-            double minimum_surrounding_cube_volume = 
-                (max_x - min_x) * (max_y - min_y) * (max_z - min_z);
-            // create the statistics
-            vector<string> statistics = {
-                "Number of faces: " + to_string(faces.size()),
-                "Total area: " + to_string(total_area),
-                "Number of lines: " + to_string(lines.size()),
-                "Total length: " + to_string(total_length),
-                "Number of points: " + to_string(points.size()),
-                "minimum_surrounding_cube_volume: " + 
-                    to_string(minimum_surrounding_cube_volume)
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
+            }
+            // one pass over the faces and lines on the TaskScheduler
+            return StatisticsResponse(model->GetStatistics());
+        }
+        else if (key == ArgKey::DISPLAY_TOPOLOGY) {
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
+            }
+            // the edges of the faces, found with hash tables
+            Model3D::Topology topology = model->GetTopology();
+            vector<NumbersPayload::Entry> entries = {
+                {"Number of vertices", 
+                    static_cast<double>(topology.Vertices), true},
+                {"Number of edges", static_cast<double>(topology.Edges), 
+                    true},
+                {"Boundary edges", 
+                    static_cast<double>(topology.BoundaryEdges), true},
+                {"Non-manifold edges", 
+                    static_cast<double>(topology.NonManifoldEdges), true},
+                {"Misoriented edges", 
+                    static_cast<double>(topology.MisorientedEdges), true},
+                {"Watertight", topology.IsWatertight() ? 1.0 : 0.0, true}
             };
-            return Response(ResKey::DISPLAY_STATISTICS, statistics);
+            return Response(ResKey::DISPLAY_TOPOLOGY,
+                make_shared<NumbersPayload>(entries));
+        }
+        else if (key == ArgKey::COUNT_FACES || key == ArgKey::COUNT_LINES) {
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
+            }
+            // only the number of elements, nothing is formatted
+            if (key == ArgKey::COUNT_FACES) {
+                return Response(ResKey::DISPLAY_FACE_COUNT,
+                    make_shared<NumbersPayload>(
+                        vector<NumbersPayload::Entry>{{"Number of faces", 
+                        static_cast<double>(model->GetFaces().size()), 
+                        true}}));
+            }
+            return Response(ResKey::DISPLAY_LINE_COUNT,
+                make_shared<NumbersPayload>(
+                    vector<NumbersPayload::Entry>{{"Number of lines", 
+                    static_cast<double>(model->GetLines().size()), 
+                    true}}));
         }
         else if (key == ArgKey::DELETE_FACE) {
             // get the face index
-            int index = stoi(arguments[0].GetValues()[0]);
-            DeleteFace(index);
+            Result<int> index = StringToIndex(values[0]);
+            if (!index.IsOk()) {
+                return ErrorResponse(index.GetError());
+            }
+            if (index.GetValue() < 0) {
+                return ErrorResponse(ErrorCode::INDEX_OUT_OF_RANGE);
+            }
+            ErrorCode code = DeleteFace(model, index.GetValue());
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
             return Response(ResKey::DELETE_FACE_SUCCESS, {});
         }
         else if (key == ArgKey::ADD_FACE) {
             // get the face points
-            try {
-                vector<Point3D> points = StringsToPoints(
-                                            arguments[0].GetValues());
-                AddFace(Face3D(points));
-            }
-            // handle invalid argument exception
-            catch (const invalid_argument& e) {
-                if (string(e.what()) == "Invalid number format.") {
-                    return Response(ResKey::INVALID_NUMBER_FORMAT, {});
-                }
-                else if (string(e.what()) == 
-                        "Exactly three numbers are required.") {
-                    return Response(ResKey::INPUT_NUMBER_ERROR, {});
-                }
-                else {
-                    return Response(ResKey::UNKNOWN, {});
-                }
-            }
-            
+            Result<vector<Point3D>> points = TryStringsToPoints(values);
+            if (!points.IsOk()) {
+                return ErrorResponse(points.GetError());
+            }
+            // build the face
+            Result<Face3D> face = Face3D::Create(points.GetValue());
+            if (!face.IsOk()) {
+                return ErrorResponse(face.GetError());
+            }
+            ErrorCode code = AddFace(model, face.GetValue());
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
             return Response(ResKey::ADD_FACE_SUCCESS, {});
         }
         else if (key == ArgKey::MODIFY_FACE_POINT) {
-            // get the face index
-            int face_index = stoi(arguments[0].GetValues()[0]);
-            // get the point index
-            int point_index = stoi(arguments[0].GetValues()[1]);
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
+            }
+            // get the face index and the point index
+            Result<int> face_index = StringToIndex(values[0]);
+            Result<int> point_index = StringToIndex(values[1]);
+            if (!face_index.IsOk() || !point_index.IsOk()) {
+                return ErrorResponse(ErrorCode::INVALID_INPUT);
+            }
+            // check the indices before parsing the new point
+            if (face_index.GetValue() < 0 || face_index.GetValue() >= 
+                    static_cast<int>(model->GetFaces().size()) ||
+                point_index.GetValue() < 0 || 
+                point_index.GetValue() >= static_cast<int>(Face3D::Size)) {
+                return ErrorResponse(ErrorCode::INDEX_OUT_OF_RANGE);
+            }
             // get the new point
-            if (face_index >= m_model->GetFaces().size() || face_index < 0) {
-                return Response(ResKey::INDEX_OUT_OF_RANGE, {});
-            }
-            // check if the point index is valid
-            if (point_index >= 
-                m_model->GetFaces()[face_index]->GetPoints().size() 
-                || point_index < 0) {
-                return Response(ResKey::INDEX_OUT_OF_RANGE, {});
-            }
-            Point3D new_point = StringsToPoints(
-                vector<string>{arguments[0].GetValues()[2]})[0];
-            ModifyFacePoint(face_index, point_index, new_point);
+            Result<Point3D> new_point = TryStringToPoint(values[2]);
+            if (!new_point.IsOk()) {
+                return ErrorResponse(new_point.GetError());
+            }
+            ErrorCode code = ModifyFacePoint(model, face_index.GetValue(), 
+                                point_index.GetValue(), new_point.GetValue());
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
             return Response(ResKey::MODIFY_FACE_POINT_SUCCESS, {});
         }
         else if (key == ArgKey::DELETE_LINE) {
             // get the line index
-            int index = stoi(arguments[0].GetValues()[0]);
-            DeleteLine(index);
+            Result<int> index = StringToIndex(values[0]);
+            if (!index.IsOk()) {
+                return ErrorResponse(index.GetError());
+            }
+            if (index.GetValue() < 0) {
+                return ErrorResponse(ErrorCode::INDEX_OUT_OF_RANGE);
+            }
+            ErrorCode code = DeleteLine(model, index.GetValue());
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
             return Response(ResKey::DELETE_LINE_SUCCESS, {});
         }
         else if (key == ArgKey::ADD_LINE) {
             // get the line points
-            vector<Point3D> points = StringsToPoints(
-                arguments[0].GetValues());
-            AddLine(Line3D(points));
+            Result<vector<Point3D>> points = TryStringsToPoints(values);
+            if (!points.IsOk()) {
+                return ErrorResponse(points.GetError());
+            }
+            // build the line
+            Result<Line3D> line = Line3D::Create(points.GetValue());
+            if (!line.IsOk()) {
+                return ErrorResponse(line.GetError());
+            }
+            ErrorCode code = AddLine(model, line.GetValue());
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
             return Response(ResKey::ADD_LINE_SUCCESS, {});
         }
         else if (key == ArgKey::MODIFY_LINE_POINT) {
-            // get the line index
-            int line_index = stoi(arguments[0].GetValues()[0]);
-            // get the point index
-            int point_index = stoi(arguments[0].GetValues()[1]);
+            if (!model) {
+                return ErrorResponse(ErrorCode::NO_3D_MODEL);
+            }
+            // get the line index and the point index
+            Result<int> line_index = StringToIndex(values[0]);
+            Result<int> point_index = StringToIndex(values[1]);
+            if (!line_index.IsOk() || !point_index.IsOk()) {
+                return ErrorResponse(ErrorCode::INVALID_INPUT);
+            }
+            // check the indices before parsing the new point
+            if (line_index.GetValue() < 0 || line_index.GetValue() >= 
+                    static_cast<int>(model->GetLines().size()) ||
+                point_index.GetValue() < 0 || 
+                point_index.GetValue() >= static_cast<int>(Line3D::Size)) {
+                return ErrorResponse(ErrorCode::INDEX_OUT_OF_RANGE);
+            }
             // get the new point
-            Point3D new_point = StringsToPoints(
-                vector<string>{arguments[0].GetValues()[2]})[0];
-            ModifyLinePoint(line_index, point_index, new_point);
+            Result<Point3D> new_point = TryStringToPoint(values[2]);
+            if (!new_point.IsOk()) {
+                return ErrorResponse(new_point.GetError());
+            }
+            ErrorCode code = ModifyLinePoint(model, line_index.GetValue(), 
+                                point_index.GetValue(), new_point.GetValue());
+            if (code != ErrorCode::NONE) {
+                return ErrorResponse(code);
+            }
             return Response(ResKey::MODIFY_LINE_POINT_SUCCESS, {});
         }
+        else if (key == ArgKey::DISPLAY_METRICS) {
+            return HandleMetricsArgument(values);
+        }
+        else if (key == ArgKey::DISPLAY_MEMORY) {
+            return HandleMemoryArgument(model);
+        }
+        else if (key == ArgKey::FILE_STATISTICS) {
+            return HandleFileStatisticsArgument(values[0]);
+        }
         else {
             return Response(ResKey::UNKNOWN, {});
         }
     }
-    catch (const exception& e) {
-        // handle exception here
-        // invalid argument exception
-        if (typeid(e) == typeid(invalid_argument)) {
-            // empty path exception
-            if (string(e.what()) == "Path should not be empty.") {
-                return Response(Response::ResponseKey::EMPTY_PATH, {});
-            }
-            // invalid path exception
-            if (string(e.what()) == "Path is not a valid OBJ file.") {
-                return Response(Response::ResponseKey::NOT_OBJ_PATH, {});
-            }
-            // invalid path exception
-            if (string(e.what()) == "Path does not exist.") {
-                return Response(Response::ResponseKey::NOT_EXIST_PATH, {});
-            }
-            // index out of range exception
-            if (string(e.what()) == "Index out of range") {
-                return Response(Response::ResponseKey::INDEX_OUT_OF_RANGE, {});
-            }
-            // face already exists exception
-            if (string(e.what()) == "Face already exists") {
-                return Response(Response::ResponseKey::DUPLICATE_FACE, {});
-            }
-            // points are not distinct exception
-            if (string(e.what()) == "The three points are not distinct") {
-                return Response(Response::ResponseKey::NOT_A_FACE, {});
-            }
-            // line already exists exception
-            if (string(e.what()) == "Line already exists") {
-                return Response(Response::ResponseKey::DUPLICATE_LINE, {});
-            }
-            // points are the same exception
-            if (string(e.what()) == "The two points are the same") {
-                return Response(Response::ResponseKey::NOT_A_LINE, {});
-            }
-            // invalid input exception
-            if (string(e.what()) == "Invalid input.") {
-                return Response(Response::ResponseKey::INVALID_INPUT, {});
-            }
-            // parse failed exception
-            if (string(e.what()) == "Failed to parse") {
-                return Response(Response::ResponseKey::PARSE_FAILED, {});
-            }
-            // points are not distinct or other related exceptions
-            if (string(e.what()) == "The three points are not distinct"
-                || string(e.what()) == "The point is on the line"
-                || string(e.what()) == "The two lines are not on the same plane"
-                || string(e.what()) == "The two lines are coincident"
-                || string(e.what()) == "Face3D must have 3 points") {
-                return Response(Response::ResponseKey::NOT_A_FACE, {});
-            }
-            // invalid number format exception
-            if (string(e.what()) == "Invalid number format.") {
-                return Response(
-                    Response::ResponseKey::INVALID_NUMBER_FORMAT, {});
-            }
-            // exactly three numbers required exception
-            if (string(e.what()) == "Exactly three numbers are required.") {
-                return Response(Response::ResponseKey::INPUT_NUMBER_ERROR, {});
-            }
-            // points are the same or other related exceptions
-            if (string(e.what()) == "The two points are the same"
-                || string(e.what()) == "Line3D must have 2 points"
-                || string(e.what()) == "The two points are the same") {
-                return Response(Response::ResponseKey::NOT_A_LINE, {});
-            }
-            // point must have 3 coordinates exception
-            if (string(e.what()) == "Point3D must have 3 coordinates") {
-                return Response(Response::ResponseKey::NOT_A_POINT, {});
-            }
-            // unknown invalid argument exception
-            return Response(
-                Response::ResponseKey::UNKNOWN_INVALID_ARGUMENT, {});
-        }
-        else if (typeid(e) == typeid(runtime_error)) {
-            // failed to import the 3D model exception
-            if (string(e.what()) == "Failed to import the 3D model.") {
-                return Response(Response::ResponseKey::IMPORT_FAILED, {});
-            }
-            // failed to export the 3D model exception
-            if (string(e.what()) == "Failed to export the 3D model.") {
-                return Response(Response::ResponseKey::EXPORT_FAILED, {});
-            }
-            // failed to delete the face exception
-            if (string(e.what()) == "Failed to delete the face.") {
-                return Response(Response::ResponseKey::DELETE_FACE_FAILED, {});
-            }
-            // failed to add the face exception
-            if (string(e.what()) == "Failed to add the face.") {
-                return Response(Response::ResponseKey::ADD_FACE_FAILED, {});
-            }
-            // failed to modify the face point exception
-            if (string(e.what()) == "Failed to modify the face point.") {
-                return Response(
-                    Response::ResponseKey::MODIFY_FACE_POINT_FAILED, {});
-            }
-            // failed to delete the line exception
-            if (string(e.what()) == "Failed to delete the line.") {
-                return Response(Response::ResponseKey::DELETE_LINE_FAILED, {});
-            }
-            // failed to add the line exception
-            if (string(e.what()) == "Failed to add the line.") {
-                return Response(Response::ResponseKey::ADD_LINE_FAILED, {});
-            }
-            // failed to modify the line point exception
-            if (string(e.what()) == "Failed to modify the line point.") {
-                return Response(
-                    Response::ResponseKey::MODIFY_LINE_POINT_FAILED, {});
-            }
-            // failed to open the file exception
-            if (string(e.what()) == "Failed to open the file") {
-                return Response(Response::ResponseKey::OPEN_FILE_FAILED, {});
-            }
-            // no 3D model to export exception
-            if (string(e.what()) == "There is no 3D model to export.") {
-                return Response(Response::ResponseKey::NO_MODEL_TO_EXPORT, {});
-            }
-            // no 3D model for various operations exception
-            if (string(e.what()) == 
-                "There is no 3D model to delete the face from." || 
-                string(e.what()) == 
-                "There is no 3D model to add the face to." || 
-                string(e.what()) == 
-                "There is no 3D model to modify the face point." || 
-                string(e.what()) == 
-                "There is no 3D model to delete the line from." || 
-                string(e.what()) == 
-                "There is no 3D model to add the line to." || 
-                string(e.what()) ==
-                "There is no 3D model to modify the line point." ||
-                string(e.what()) == 
-                "There is no 3D model to display."){
-                return Response(Response::ResponseKey::NO_3D_MODEL, {});
-            }
-            // unknown run time error exception
-            else {
-                return Response(
-                    Response::ResponseKey::UNKNOWN_RUN_TIME_ERROR, {});
+    // the model reports its errors as codes, only unexpected failures
+    // such as running out of memory end up here
+    catch (const invalid_argument&) {
+        return Response(ResKey::UNKNOWN_INVALID_ARGUMENT, {});
+    }
+    catch (const runtime_error&) {
+        return Response(ResKey::UNKNOWN_RUN_TIME_ERROR, {});
+    }
+    catch (const exception&) {
+        return Response(ResKey::UNKNOWN, {});
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : HandleMetricsArgument
+// [function] : read or control the metrics
+// [input] : the values of the argument, none to list the metrics,
+//           "json" to get them as JSON, "reset", "on" or "off"
+// [output] : DISPLAY_METRICS with the rows of the metrics, no values
+//            for "reset", "on" and "off", or INVALID_INPUT
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Response Controller::HandleMetricsArgument(const vector<string>& values)
+{
+    if (values.empty()) {
+        return Response(ResKey::DISPLAY_METRICS, m_metrics.GetRows());
+    }
+    if (values.size() > 1) {
+        return ErrorResponse(ErrorCode::INVALID_INPUT);
+    }
+    if (values[0] == "json") {
+        return Response(ResKey::DISPLAY_METRICS,
+                        vector<string>{m_metrics.GetJson()});
+    }
+    if (values[0] == "reset") {
+        m_metrics.Reset();
+        TaskScheduler::GetInstance().ResetStatistics();
+    }
+    else if (values[0] == "on" || values[0] == "off") {
+        m_metrics.SetEnabled(values[0] == "on");
+    }
+    else {
+        return ErrorResponse(ErrorCode::INVALID_INPUT);
+    }
+    return Response(ResKey::DISPLAY_METRICS, {});
+}
+
+// -----------------------------------------------------------
+// [name] : HandleMemoryArgument
+// [function] : list the bytes used by the model and the query cache
+// [input] : the model of the batch
+// [output] : DISPLAY_MEMORY with the bytes of every component, and of
+//            the heap if the allocations are counted
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Response Controller::HandleMemoryArgument(
+            const shared_ptr<Model3D>& model) const
+{
+    Model3D::MemoryUsage usage = {};
+    if (model) {
+        usage = model->GetMemoryUsage();
+    }
+    QueryCache::Statistics cache = m_queryCache.GetStatistics();
+    vector<NumbersPayload::Entry> entries = {
+        {"Points", static_cast<double>(usage.Points), true},
+        {"Point bytes", static_cast<double>(usage.PointBytes), true},
+        {"Coordinate bytes", static_cast<double>(usage.CoordinateBytes),
+            true},
+        {"Face bytes", static_cast<double>(usage.FaceBytes), true},
+        {"Line bytes", static_cast<double>(usage.LineBytes), true},
+        {"Control block bytes",
+            static_cast<double>(usage.ControlBlockBytes), true},
+        {"Pointer bytes", static_cast<double>(usage.PointerBytes), true},
+        {"Slack bytes", static_cast<double>(usage.SlackBytes), true},
+        {"Name bytes", static_cast<double>(usage.NameBytes), true},
+        {"Model bytes", static_cast<double>(usage.Total()), true},
+        {"Query cache bytes", static_cast<double>(cache.Bytes), true}
+    };
+    if (AllocationCounter::IsAvailable()) {
+        // the peak is reset by every argument, see the metrics for it
+        entries.push_back({"Heap bytes", static_cast<double>(
+            AllocationCounter::GetCurrentBytes()), true});
+    }
+    return Response(ResKey::DISPLAY_MEMORY,
+                    make_shared<NumbersPayload>(entries));
+}
+
+// -----------------------------------------------------------
+// [name] : HandleFileStatisticsArgument
+// [function] : compute the statistics of a file in one pass without
+//              importing it
+// [input] : the path of the OBJ file
+// [output] : DISPLAY_STATISTICS with the statistics of the file, or the
+//            response of the error an import of the file would give
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Response Controller::HandleFileStatisticsArgument(const string& path)
+{
+    bool sampled = m_metrics.IsEnabled();
+    uint64_t start = sampled ? Metrics::Now() : 0;
+    // the progress member belongs to the writer, a query may run beside
+    // it, so the file is read without a progress
+    Model3DObjImporter importer;
+    Result<Model3D::Statistics> statistics = 
+        importer.TryLoadStatistics(path);
+    if (!statistics.IsOk()) {
+        return ErrorResponse(statistics.GetError());
+    }
+    if (sampled) {
+        m_metrics.RecordImport(FileSize(path), Metrics::Now() - start);
+    }
+    return StatisticsResponse(statistics.GetValue());
+}
+
+// -----------------------------------------------------------
+// [name] : AddFaces
+// [function] : add the faces of consecutive ADD_FACE arguments 
+//              with one bulk operation
+// [input] : the arguments, the range [begin, end) of ADD_FACE arguments,
+//           the batch mode, the vector receiving the responses, the
+//           model of the batch
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Controller::AddFaces(const vector<Argument>& arguments, size_t begin,
+                size_t end, BatchMode mode, vector<Response>& responses,
+                shared_ptr<Model3D>& model)
+{
+    bool stop_on_error = mode == BatchMode::STOP_ON_ERROR;
+    // error code of every argument, NONE until it fails
+    vector<ErrorCode> codes;
+    codes.reserve(end - begin);
+    // the faces that were built and the arguments they come from
+    vector<Face3D> faces;
+    vector<size_t> owners;
+    faces.reserve(end - begin);
+    owners.reserve(end - begin);
+    // build the faces, in the same order of checks as HandleArgument
+    for (size_t i = begin; i < end; i++) {
+        Result<vector<Point3D>> points = 
+            TryStringsToPoints(arguments[i].GetValues());
+        ErrorCode code = points.GetError();
+        if (code == ErrorCode::NONE) {
+            Result<Face3D> face = Face3D::Create(points.GetValue());
+            code = face.GetError();
+            if (code == ErrorCode::NONE && !model) {
+                code = ErrorCode::NO_3D_MODEL;
+            }
+            if (code == ErrorCode::NONE) {
+                faces.push_back(face.GetValue());
+                owners.push_back(codes.size());
             }
         }
+        codes.push_back(code);
+        if (stop_on_error && code != ErrorCode::NONE) {
+            break;
+        }
+    }
+    // add the faces in one pass over the model
+    if (!faces.empty()) {
+        vector<ErrorCode> face_codes;
+        model->TryAddFaces(faces, face_codes, stop_on_error);
+        for (size_t i = 0; i < face_codes.size(); i++) {
+            codes[owners[i]] = face_codes[i];
+        }
+        // with stop on error, the bulk operation ends with the failed 
+        // face, the arguments after it are not executed
+        if (stop_on_error && !face_codes.empty() && 
+            face_codes.back() != ErrorCode::NONE) {
+            codes.resize(owners[face_codes.size() - 1] + 1);
+        }
+    }
+    // one response per executed argument
+    for (ErrorCode code : codes) {
+        if (code == ErrorCode::NONE) {
+            responses.push_back(Response(ResKey::ADD_FACE_SUCCESS, {}));
+        }
         else {
-            return Response(Response::ResponseKey::UNKNOWN, {});
+            responses.push_back(ErrorResponse(code));
         }
     }
 }
 
+// -----------------------------------------------------------
+// [name] : AddLines
+// [function] : add the lines of consecutive ADD_LINE arguments 
+//              with one bulk operation
+// [input] : the arguments, the range [begin, end) of ADD_LINE arguments,
+//           the batch mode, the vector receiving the responses, the
+//           model of the batch
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Controller::AddLines(const vector<Argument>& arguments, size_t begin,
+                size_t end, BatchMode mode, vector<Response>& responses,
+                shared_ptr<Model3D>& model)
+{
+    bool stop_on_error = mode == BatchMode::STOP_ON_ERROR;
+    // error code of every argument, NONE until it fails
+    vector<ErrorCode> codes;
+    codes.reserve(end - begin);
+    // the lines that were built and the arguments they come from
+    vector<Line3D> lines;
+    vector<size_t> owners;
+    lines.reserve(end - begin);
+    owners.reserve(end - begin);
+    // build the lines, in the same order of checks as HandleArgument
+    for (size_t i = begin; i < end; i++) {
+        Result<vector<Point3D>> points = 
+            TryStringsToPoints(arguments[i].GetValues());
+        ErrorCode code = points.GetError();
+        if (code == ErrorCode::NONE) {
+            Result<Line3D> line = Line3D::Create(points.GetValue());
+            code = line.GetError();
+            if (code == ErrorCode::NONE && !model) {
+                code = ErrorCode::NO_3D_MODEL;
+            }
+            if (code == ErrorCode::NONE) {
+                lines.push_back(line.GetValue());
+                owners.push_back(codes.size());
+            }
+        }
+        codes.push_back(code);
+        if (stop_on_error && code != ErrorCode::NONE) {
+            break;
+        }
+    }
+    // add the lines in one pass over the model
+    if (!lines.empty()) {
+        vector<ErrorCode> line_codes;
+        model->TryAddLines(lines, line_codes, stop_on_error);
+        for (size_t i = 0; i < line_codes.size(); i++) {
+            codes[owners[i]] = line_codes[i];
+        }
+        // with stop on error, the bulk operation ends with the failed 
+        // line, the arguments after it are not executed
+        if (stop_on_error && !line_codes.empty() && 
+            line_codes.back() != ErrorCode::NONE) {
+            codes.resize(owners[line_codes.size() - 1] + 1);
+        }
+    }
+    // one response per executed argument
+    for (ErrorCode code : codes) {
+        if (code == ErrorCode::NONE) {
+            responses.push_back(Response(ResKey::ADD_LINE_SUCCESS, {}));
+        }
+        else {
+            responses.push_back(ErrorResponse(code));
+        }
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : ToResponseKey
+// [function] : map an error code of the model onto a response key
+// [input] : the error code
+// [output] : the response key of the error
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ResKey Controller::ToResponseKey(ErrorCode code)
+{
+    // response keys of the error codes, in the order of the enum class
+    static const ResKey ERROR_RESPONSES[] = {
+        ResKey::UNKNOWN,                    // NONE
+        ResKey::EMPTY_PATH,                 // EMPTY_PATH
+        ResKey::NOT_OBJ_PATH,               // NOT_OBJ_PATH
+        ResKey::NOT_EXIST_PATH,             // NOT_EXIST_PATH
+        ResKey::OPEN_FILE_FAILED,           // OPEN_FILE_FAILED
+        ResKey::PARSE_FAILED,               // PARSE_FAILED
+        ResKey::INDEX_OUT_OF_RANGE,         // INDEX_OUT_OF_RANGE
+        ResKey::DUPLICATE_FACE,             // DUPLICATE_FACE
+        ResKey::DUPLICATE_LINE,             // DUPLICATE_LINE
+        ResKey::UNKNOWN_INVALID_ARGUMENT,   // DUPLICATE_POINT
+        ResKey::NOT_A_FACE,                 // NOT_A_FACE
+        ResKey::NOT_A_LINE,                 // NOT_A_LINE
+        ResKey::NOT_A_POINT,                // NOT_A_POINT
+        ResKey::INVALID_NUMBER_FORMAT,      // INVALID_NUMBER_FORMAT
+        ResKey::INPUT_NUMBER_ERROR,         // INPUT_NUMBER_ERROR
+        ResKey::INVALID_INPUT,              // INVALID_INPUT
+        ResKey::NO_3D_MODEL,                // NO_3D_MODEL
+        ResKey::NO_MODEL_TO_EXPORT,         // NO_MODEL_TO_EXPORT
+        ResKey::EXPORT_FAILED,              // EXPORT_FAILED
+        ResKey::CANCELLED                   // CANCELLED
+    };
+    static_assert(sizeof(ERROR_RESPONSES) / sizeof(ERROR_RESPONSES[0]) ==
+                  static_cast<unsigned int>(ErrorCode::COUNT),
+                  "every error code needs a response key");
+    unsigned int index = static_cast<unsigned int>(code);
+    if (index >= static_cast<unsigned int>(ErrorCode::COUNT)) {
+        return ResKey::UNKNOWN;
+    }
+    return ERROR_RESPONSES[index];
+}
+
 // -----------------------------------------------------------
 // [name] : Import3DModel
 // [function] : import a 3D model from a file
-// [input] : the path of the file
-// [output] : none
+// [input] : the model of the batch, replaced by the imported one, the
+//           path of the file
+// [output] : NONE or the error code of the importer
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
-void Controller::Import3DModel(const string& path)
+ErrorCode Controller::Import3DModel(shared_ptr<Model3D>& model,
+                                     const string& path)
 {
+    bool sampled = m_metrics.IsEnabled();
+    uint64_t start = sampled ? Metrics::Now() : 0;
     // Load the 3D model
     Model3DObjImporter importer;
-    m_model = make_shared<Model3D>(importer.Load(path));
-
+    Result<Model3D> loaded = importer.TryLoad(path, m_progress);
+    if (!loaded.IsOk()) {
+        return loaded.GetError();
+    }
+    if (sampled) {
+        uint64_t duration = Metrics::Now() - start;
+        m_metrics.RecordImport(FileSize(path), duration);
+    }
+    // hand the loaded faces and lines over without copying them
+    model = make_shared<Model3D>(move(loaded.GetValue()));
+    // the cached responses share the elements of the old model
+    m_queryCache.Clear();
+    return ErrorCode::NONE;
 }
 
 // -----------------------------------------------------------
 // [name] : Export3DModel
 // [function] : export a 3D model to a file
-// [input] : the path of the file
-// [output] : none
+// [input] : the model of the batch, the path of the file
+// [output] : NONE, NO_MODEL_TO_EXPORT, EMPTY_PATH, NOT_OBJ_PATH 
+//            or EXPORT_FAILED
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
-void Controller::Export3DModel(const string& path)
+ErrorCode Controller::Export3DModel(const shared_ptr<Model3D>& model,
+                                     const string& path)
 {
-    // Export the 3D model
-    if (!m_model) {
-        throw runtime_error("There is no 3D model to export.");
+    if (!model) {
+        return ErrorCode::NO_MODEL_TO_EXPORT;
+    }
+    // check the path before the exporter creates the file
+    if (path.empty()) {
+        return ErrorCode::EMPTY_PATH;
+    }
+    if (path.find(".obj") == string::npos) {
+        return ErrorCode::NOT_OBJ_PATH;
+    }
+    // Export the 3D model, the exporter still reports I/O errors 
+    // with exceptions
+    bool sampled = m_metrics.IsEnabled();
+    uint64_t start = sampled ? Metrics::Now() : 0;
+    try {
+        Model3DObjExporter exporter;
+        exporter.Save(path, *model);
     }
-    Model3DObjExporter exporter;
-    exporter.Save(path, *m_model);
-    // ...
+    catch (const exception&) {
+        return ErrorCode::EXPORT_FAILED;
+    }
+    if (sampled) {
+        uint64_t duration = Metrics::Now() - start;
+        m_metrics.RecordExport(FileSize(path), duration);
+    }
+    return ErrorCode::NONE;
 }
 
 // -----------------------------------------------------------
 // [name] : DeleteFace
 // [function] : delete a face from the 3D model
-// [input] : the index of the face to delete
-// [output] : none
+// [input] : the model of the batch, the index of the face to delete
+// [output] : NONE, NO_3D_MODEL or the error code of the model
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
-void Controller::DeleteFace(unsigned int FaceIndex)
+ErrorCode Controller::DeleteFace(shared_ptr<Model3D>& model,
+                                  unsigned int FaceIndex)
 {
-    // Delete the face
-    if (!m_model) {
-        throw runtime_error("There is no 3D model to delete the face from.");
+    if (!model) {
+        return ErrorCode::NO_3D_MODEL;
     }
-    m_model->DeleteFace(FaceIndex);
+    // Delete the face
+    return model->TryDeleteFace(FaceIndex);
 }
 
 // -----------------------------------------------------------
 // [name] : AddFace
 // [function] : add a face to the 3D model
-// [input] : the face to add
-// [output] : none
+// [input] : the model of the batch, the face to add
+// [output] : NONE, NO_3D_MODEL or the error code of the model
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
-void Controller::AddFace(const Face3D& face)
+ErrorCode Controller::AddFace(shared_ptr<Model3D>& model,
+                               const Face3D& face)
 {
-    if (!m_model) {
-        throw runtime_error("There is no 3D model to add the face to.");
+    if (!model) {
+        return ErrorCode::NO_3D_MODEL;
     }
     // Add the face
-    m_model->AddFace(face);
+    return model->TryAddFace(face);
 }
 
 // -----------------------------------------------------------
 // [name] : ModifyFacePoint
 // [function] : modify a point of a face in the 3D model
-// [input] : the index of the face, the index of the point, 
-//           and the new point
-// [output] : none
+// [input] : the model of the batch, the index of the face, the index
+//           of the point and the new point
+// [output] : NONE, NO_3D_MODEL or the error code of the model
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
-void Controller::ModifyFacePoint(
+ErrorCode Controller::ModifyFacePoint(shared_ptr<Model3D>& model,
     unsigned int FaceIndex, unsigned int PointIndex, const Point3D& NewPoint)
 {
-    if (!m_model) {
-        throw runtime_error("There is no 3D model to modify the face point.");
+    if (!model) {
+        return ErrorCode::NO_3D_MODEL;
     }
     // Modify the face point
-    m_model->ModifyFacePoint(FaceIndex, PointIndex, NewPoint);
+    return model->TryModifyFacePoint(FaceIndex, PointIndex, NewPoint);
 }
 
 // -----------------------------------------------------------
 // [name] : DeleteLine
 // [function] : delete a line from the 3D model
-// [input] : the index of the line to delete
-// [output] : none
+// [input] : the model of the batch, the index of the line to delete
+// [output] : NONE, NO_3D_MODEL or the error code of the model
 // [author] : Huayu Chen
 // [date] : 2024/8/3
 // -----------------------------------------------------------
-void Controller::DeleteLine(unsigned int LineIndex)
+ErrorCode Controller::DeleteLine(shared_ptr<Model3D>& model,
+                                  unsigned int LineIndex)
 {
-    if (!m_model) {
-        throw runtime_error("There is no 3D model to delete the line from.");
+    if (!model) {
+        return ErrorCode::NO_3D_MODEL;
     }
-    
     // Delete the line
-    m_model->DeleteLine(LineIndex);
-
+    return model->TryDeleteLine(LineIndex);
 }
 
 // -----------------------------------------------------------
 // [name] : AddLine
 // [function] : add a line to the 3D model
-// [input] : the line to add
-// [output] : none
+// [input] : the model of the batch, the line to add
+// [output] : NONE, NO_3D_MODEL or the error code of the model
 // [author] : Huayu Chen
 // [date] : 2024/8/3
 // -----------------------------------------------------------
-void Controller::AddLine(const Line3D& line)
+ErrorCode Controller::AddLine(shared_ptr<Model3D>& model,
+                               const Line3D& line)
 {
-    if (!m_model) {
-        throw runtime_error("There is no 3D model to add the line to.");
+    if (!model) {
+        return ErrorCode::NO_3D_MODEL;
     }
     // Add the line
-    m_model->AddLine(line);
+    return model->TryAddLine(line);
 }
 
 // -----------------------------------------------------------
 // [name] : ModifyLinePoint
 // [function] : modify a point of a line in the 3D model
-// [input] : the index of the line, the index of the point, 
-//           and the new point
-// [output] : none
+// [input] : the model of the batch, the index of the line, the index
+//           of the point and the new point
+// [output] : NONE, NO_3D_MODEL or the error code of the model
 // [author] : Huayu Chen
 // [date] : 2024/8/3
 // -----------------------------------------------------------
-void Controller::ModifyLinePoint(unsigned int LineIndex, 
-                unsigned int PointIndex, const Point3D& NewPoint)
+ErrorCode Controller::ModifyLinePoint(shared_ptr<Model3D>& model,
+                unsigned int LineIndex, unsigned int PointIndex,
+                const Point3D& NewPoint)
 {
-    if (!m_model) {
-        throw runtime_error("There is no 3D model to modify the line point.");
+    if (!model) {
+        return ErrorCode::NO_3D_MODEL;
     }
     // Modify the line point
-    m_model->ModifyLinePoint(LineIndex, PointIndex, NewPoint);
+    return model->TryModifyLinePoint(LineIndex, PointIndex, NewPoint);
 }
 
 // -----------------------------------------------------------
@@ -619,11 +1456,11 @@ void Controller::ModifyLinePoint(unsigned int LineIndex,
 // -----------------------------------------------------------
 vector<Point3D> Controller::StringsToPoints(
             const vector<string>& pointStrings) {
-    vector<Point3D> points;
-    for (const string& pointString : pointStrings) {
-        points.push_back(StringToPoint(pointString));
+    Result<vector<Point3D>> points = TryStringsToPoints(pointStrings);
+    if (!points.IsOk()) {
+        throw invalid_argument(ErrorMessage(points.GetError()));
     }
-    return points;
+    return move(points.GetValue());
 }
 
 // -----------------------------------------------------------
@@ -635,39 +1472,170 @@ vector<Point3D> Controller::StringsToPoints(
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 Point3D Controller::StringToPoint(const string& pointString) {
-    vector<double> numbers;
-    string trimmedInput = pointString;
-
-    // delete the leading and trailing spaces and parentheses
-    trimmedInput.erase(trimmedInput.begin(), find_if(trimmedInput.begin(), 
-        trimmedInput.end(), [](unsigned char ch) {  
-        return !isspace(ch) && ch != '(';
-    }));
-    // delete the trailing spaces and parentheses
-    trimmedInput.erase(find_if(trimmedInput.rbegin(), trimmedInput.rend(), 
-            [](unsigned char ch) {
-        return !isspace(ch) && ch != ')';
-    }).base(), trimmedInput.end());
-
-    // use regex to extract the numbers from the string
-    regex re("\\s*([-+]?[0-9]*\\.?[0-9]+)(?:\\s+|\\s*,\\s*|\\s*$)");
-    auto begin = sregex_iterator(trimmedInput.begin(), trimmedInput.end(), re);
-    auto end = sregex_iterator();
-    // convert the numbers to double
-    for (sregex_iterator i = begin; i != end; ++i) {
-        smatch match = *i;
-        try {
-            double num = stod(match.str());
-            numbers.push_back(num);
-        } catch (const invalid_argument& e) {
-            throw invalid_argument("Invalid number format.");
-        }
-    }
-    // check if the number of coordinates is correct
-    if (numbers.size() != 3) {
-        throw invalid_argument("Exactly three numbers are required.");
-    }
-    return Point3D(numbers[0], numbers[1], numbers[2]);
+    Result<Point3D> point = TryStringToPoint(pointString);
+    if (!point.IsOk()) {
+        throw invalid_argument(ErrorMessage(point.GetError()));
+    }
+    return point.GetValue();
+}
+
+// -----------------------------------------------------------
+// [name] : TryStringsToPoints
+// [function] : convert a vector of strings to a vector of points 
+//              without throwing
+// [input] : the vector of strings
+// [output] : the vector of points, or the error code of the first
+//            string that is not a point
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<vector<Point3D>> Controller::TryStringsToPoints(
+            const vector<string>& pointStrings) {
+    vector<Point3D> points;
+    points.reserve(pointStrings.size());
+    for (const string& pointString : pointStrings) {
+        Result<Point3D> point = TryStringToPoint(pointString);
+        if (!point.IsOk()) {
+            return point.GetError();
+        }
+        points.push_back(point.GetValue());
+    }
+    return points;
+}
+
+// -----------------------------------------------------------
+// [name] : TryStringToPoint
+// [function] : convert a string to a point without throwing
+// [input] : the string
+// [output] : the point, INVALID_NUMBER_FORMAT or INPUT_NUMBER_ERROR
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Point3D> Controller::TryStringToPoint(const string& pointString) {
+    return PointParser::Parse(pointString);
+}
+
+// -----------------------------------------------------------
+// [name] : StringToIndex
+// [function] : convert a string to an index without throwing
+// [input] : the string
+// [output] : the index, or INVALID_INPUT if the string is not an integer
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<int> Controller::StringToIndex(const string& indexString) {
+    const char* begin = indexString.c_str();
+    char* end = nullptr;
+    errno = 0;
+    long value = strtol(begin, &end, 10);
+    // stoi accepted trailing characters, keep accepting them
+    if (end == begin || errno == ERANGE || 
+        value < numeric_limits<int>::min() || 
+        value > numeric_limits<int>::max()) {
+        return ErrorCode::INVALID_INPUT;
+    }
+    return static_cast<int>(value);
+}
+
+// -----------------------------------------------------------
+// [name] : StringsToPage
+// [function] : read the optional offset and limit of a listing
+// [input] : the values of the argument, the number of elements,
+//           the offset and the limit to fill
+// [output] : NONE, INVALID_INPUT if a value is not a non-negative integer,
+//            INDEX_OUT_OF_RANGE if the offset is beyond the last element
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Controller::StringsToPage(const vector<string>& values,
+                                    size_t count, size_t& offset,
+                                    size_t& limit) {
+    offset = 0;
+    limit = SIZE_MAX;
+    if (values.size() > 0) {
+        Result<int> first = StringToIndex(values[0]);
+        if (!first.IsOk() || first.GetValue() < 0) {
+            return ErrorCode::INVALID_INPUT;
+        }
+        offset = static_cast<size_t>(first.GetValue());
+    }
+    if (values.size() > 1) {
+        Result<int> number = StringToIndex(values[1]);
+        if (!number.IsOk() || number.GetValue() < 0) {
+            return ErrorCode::INVALID_INPUT;
+        }
+        limit = static_cast<size_t>(number.GetValue());
+    }
+    // an offset equal to the count gives an empty page
+    if (offset > count) {
+        return ErrorCode::INDEX_OUT_OF_RANGE;
+    }
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : StreamElements
+// [function] : pass a page of faces or lines to a callback
+// [input] : the elements, the index of the first element, the maximum
+//           number of elements, the callback
+// [output] : NONE or INDEX_OUT_OF_RANGE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+static ErrorCode StreamElements(const vector<shared_ptr<Element>>& elements,
+                                size_t offset, size_t limit,
+                                const Controller::RowCallback& callback) {
+    if (offset > elements.size()) {
+        return ErrorCode::INDEX_OUT_OF_RANGE;
+    }
+    size_t end = offset + min(limit, elements.size() - offset);
+    // one buffer for all rows, its memory is reused
+    string row;
+    for (size_t i = offset; i < end; i++) {
+        row.clear();
+        ElementsPayload<Element>::AppendElement(*elements[i], row);
+        callback(i, row);
+    }
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : StreamFaces
+// [function] : pass the formatted faces to a callback one by one
+// [input] : the index of the first face, the maximum number of faces,
+//           the callback
+// [output] : NONE, NO_3D_MODEL or INDEX_OUT_OF_RANGE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Controller::StreamFaces(size_t offset, size_t limit,
+                                  const RowCallback& callback) const {
+    // the published model is never changed, no lock is needed
+    shared_ptr<Model3D> model = LoadModel();
+    if (!model) {
+        return ErrorCode::NO_3D_MODEL;
+    }
+    return StreamElements(model->GetFaces(), offset, limit, callback);
+}
+
+// -----------------------------------------------------------
+// [name] : StreamLines
+// [function] : pass the formatted lines to a callback one by one
+// [input] : the index of the first line, the maximum number of lines,
+//           the callback
+// [output] : NONE, NO_3D_MODEL or INDEX_OUT_OF_RANGE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Controller::StreamLines(size_t offset, size_t limit,
+                                  const RowCallback& callback) const {
+    // the published model is never changed, no lock is needed
+    shared_ptr<Model3D> model = LoadModel();
+    if (!model) {
+        return ErrorCode::NO_3D_MODEL;
+    }
+    return StreamElements(model->GetLines(), offset, limit, callback);
 }
 
 // -----------------------------------------------------------
@@ -678,12 +1646,16 @@ Point3D Controller::StringToPoint(const string& pointString) {
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: do not delete the instance
+// reason: the destructor deleted the object it was called on, the
+//         instance is a static variable of GetInstance now
+// -----------------------------------------------------------
 Controller::~Controller()
 {
-    if (m_instance)
-    {
-        delete m_instance;
-    }
 }
 
 
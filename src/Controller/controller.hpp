@@ -32,6 +32,84 @@
 // reason: to support handling some error
 //         and to support singleton pattern
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: return error codes from the model operations
+//       add ToResponseKey to map an error code onto a response key
+//       add Try versions of the string conversions
+// reason: failures were turned into responses by catching exceptions and
+//         comparing their messages with about 20 strings
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: execute every argument of the batch in HandleArguments
+//       return one response per argument
+//       add the BatchMode enum class
+//       add bulk adding of faces and lines
+// reason: only the first argument was executed, so every edit needed
+//         a round trip of its own
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: list faces and lines in pages, add counting them
+//       add StreamFaces and StreamLines
+// reason: listing a model with millions of faces built one response
+//         with all of them
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add HandleArgumentsAsync and the functions on its tickets
+//       guard the model with a mutex
+// reason: a large import or export froze the viewer until it was done
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add IsReadOnly, guard the model with a shared mutex
+// reason: to answer the queries of several clients of the server at once
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add a cache of the responses of read-only arguments
+//       add GetCacheStatistics and SetCacheLimits
+// reason: polling clients recomputed the same statistics and listings
+//         while the model did not change
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the metrics of the arguments, the responses and the files
+//       add the DISPLAY_METRICS argument and GetMetrics
+// reason: there was no way to tell which commands were slow
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the DISPLAY_MEMORY argument, record the peak allocation of
+//       every argument
+// reason: to tell how much memory a model and a command use
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: keep the instance in a static local variable of GetInstance
+//       publish the model as a snapshot, add LoadModel, PublishModel
+//       and EditsModel, replace the shared mutex with a writer mutex
+// reason: two threads could create two instances, and queries waited
+//         for a whole import or edit
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the FILE_STATISTICS argument
+// reason: to get the statistics of a file without importing it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the enclosed volume to the statistics, add the
+//       DISPLAY_TOPOLOGY argument
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: tell ExecuteArguments if it runs in a writer
+// reason: the peak allocation is only recorded in writers
+// -----------------------------------------------------------
 
 #ifndef CONTROLLER_HPP
 #define CONTROLLER_HPP
@@ -40,12 +118,20 @@
 #include <vector>
 #include <memory>
 #include <cstdlib>
+#include <cstdint>
+#include <functional>
+#include <mutex>
 #include "../Model/Element3D/face3d.hpp"
 #include "../Model/Element3D/point3d.hpp"
 #include "../Model/Element3D/line3d.hpp"
 #include "../Model/Model3D/model3d.hpp"
+#include "../Model/Result/result.hpp"
 #include "../Message/argument.hpp"
 #include "../Message/response.hpp"
+#include "../Model/Progress/progress.hpp"
+#include "commandexecutor.hpp"
+#include "querycache.hpp"
+#include "metrics.hpp"
 
 using namespace std;
 
@@ -58,9 +144,68 @@ using namespace std;
 // 1. The controller class in this program 
 //    is a class with only one instance, so the constructor is private
 //    and the only way to get an instance of the controller is to call the 
-//    static GetInstance() function.
+//    static GetInstance() function. it can be called from any thread,
+//    the instance is created by the first call.
 // 2. The operations on the model are encapsulated in the HandleArguments 
 //    function. Supported operations can be found in the Argument class.
+// 3. The model reports failures as error codes, ToResponseKey maps an error
+//    code onto the response key shown by the viewer with a table lookup.
+//    exceptions are only caught for unexpected failures.
+// 4. HandleArguments executes the arguments in order and returns one 
+//    response per executed argument. With BatchMode::STOP_ON_ERROR the 
+//    batch stops at the first failed argument, its response is the last
+//    one and the later arguments are not executed. With 
+//    BatchMode::CONTINUE_ON_ERROR every argument is executed.
+// 5. Consecutive ADD_FACE or ADD_LINE arguments are added to the model in
+//    one bulk operation, the responses are the same as if they were 
+//    executed one by one.
+// 6. DISPLAY_ALL_FACES and DISPLAY_ALL_LINES list a page of the elements
+//    if an offset and a limit are given, COUNT_FACES and COUNT_LINES only
+//    return the number of elements.
+// 7. StreamFaces and StreamLines pass the formatted rows one by one to a
+//    callback instead of building a response, the row is a buffer reused
+//    for every element and is only valid during the call.
+// 8. HandleArgumentsAsync queues a batch on a worker thread and returns
+//    a ticket at once. GetJobStatus reads the progress (bytes read,
+//    faces and lines built, arguments done), CancelJob stops the batch
+//    at the next check, a cancelled argument answers CANCELLED and the
+//    later ones are not executed. TryCollectJob and CollectJob return
+//    the responses. the batches run one after another, and a mutex
+//    makes HandleArguments wait for the running batch if it changes
+//    the model.
+// 9. the model is published as a snapshot that is never changed. a
+//    batch of read-only arguments (see IsReadOnly) and the streaming
+//    functions read the published model without a lock, so they run on
+//    several threads at once and do not wait for a writer. a writer
+//    batch copies the model before its first edit (see EditsModel),
+//    the copy shares the faces and lines, and publishes its model when
+//    it is done. the writers run one after another. a query started
+//    before a writer is done answers from the model before the batch
+// 10. the successful responses of read-only arguments are kept in a
+//    QueryCache for the version of the model, a repeated query on an
+//    unchanged model is answered without computing it again.
+//    GetCacheStatistics counts the hits and misses, SetCacheLimits
+//    bounds the cache, 0 entries turns it off
+// 11. while the sampling of the Metrics is on, the duration of every
+//    argument, the key of every response and the size and duration of
+//    every imported or exported file are recorded. the arguments of a
+//    bulk operation share its duration evenly. DISPLAY_METRICS reads
+//    and controls the metrics, it does not need a model and is never
+//    cached
+// 12. DISPLAY_MEMORY lists the bytes of the model by component and of
+//    the query cache, all 0 without a model, and the bytes on the heap
+//    if AllocationCounter::IsAvailable. it is never cached. with the
+//    counter, the peak allocation of every sampled argument is recorded
+//    in the metrics. the peak is of the whole program, so read-only
+//    batches running at once may add to each other's peaks
+// 13. FILE_STATISTICS reads an OBJ file once and answers the statistics
+//    of DISPLAY_STATISTICS for it without building or replacing the
+//    model, or the error an import of the file would give. it does not
+//    need a model and is never cached, the file may change
+// 14. DISPLAY_STATISTICS and FILE_STATISTICS end with the enclosed
+//    volume, see Model3D::GetStatistics. DISPLAY_TOPOLOGY answers the
+//    vertices, the edges, the boundary, non-manifold and misoriented
+//    edges and 1 if the model is watertight, 0 otherwise
 // [author] : Huayu Chen
 // [date] : 2024/7/31
 // -----------------------------------------------------------
@@ -68,16 +213,65 @@ using namespace std;
 class Controller
 {
 public:
+    // notes for the BatchMode enum class
+    // -----------------------------------------------------------
+    // [enum class name] : BatchMode
+    // [function] : define what happens after a failed argument of a batch
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -----------------------------------------------------------
+    enum class BatchMode {
+        // do not execute the arguments after the failed one
+        STOP_ON_ERROR,
+        // execute all arguments
+        CONTINUE_ON_ERROR
+    };
+
     // get instance of controller
     // singleton pattern, only one instance of controller is allowed
     static Controller* GetInstance();
     // handle the arguments passed from the viewer
-    // and return the response to the viewer
-    Response HandleArguments(vector<Argument> arguments);
+    // and return the responses to the viewer, one per executed argument
+    vector<Response> HandleArguments(const vector<Argument>& arguments,
+                        BatchMode mode = BatchMode::STOP_ON_ERROR);
+    // map an error code of the model onto the response key of the error
+    static Response::ResponseKey ToResponseKey(ErrorCode code);
+    // check if an argument only reads the model
+    static bool IsReadOnly(Argument::ArgumentKey key);
+    // check if every argument of a batch only reads the model
+    static bool IsReadOnly(const vector<Argument>& arguments);
+    // callback receiving the index and the formatted row of an element
+    using RowCallback = function<void(size_t index, const string& row)>;
+    // pass at most limit faces starting at offset to the callback
+    // return NONE, NO_3D_MODEL or INDEX_OUT_OF_RANGE if offset is
+    // beyond the last face
+    ErrorCode StreamFaces(size_t offset, size_t limit,
+                          const RowCallback& callback) const;
+    // pass at most limit lines starting at offset to the callback
+    ErrorCode StreamLines(size_t offset, size_t limit,
+                          const RowCallback& callback) const;
+    // ticket of a batch running in the background
+    using Ticket = CommandExecutor::Ticket;
+    // queue the arguments on the worker thread, return the ticket
+    Ticket HandleArgumentsAsync(const vector<Argument>& arguments,
+                        BatchMode mode = BatchMode::STOP_ON_ERROR);
+    // get the state and the progress of a batch
+    bool GetJobStatus(Ticket ticket, 
+                      CommandExecutor::JobStatus& status) const;
+    // ask a batch to stop
+    bool CancelJob(Ticket ticket);
+    // get the responses of a finished batch, false if it is not done
+    bool TryCollectJob(Ticket ticket, vector<Response>& responses);
+    // wait for a batch and get its responses
+    bool CollectJob(Ticket ticket, vector<Response>& responses);
+    // get the counters and the size of the query cache
+    QueryCache::Statistics GetCacheStatistics() const;
+    // change the limits of the query cache
+    void SetCacheLimits(size_t maxEntries, size_t maxRows);
+    // get the metrics of the arguments, the responses and the files
+    Metrics& GetMetrics();
 
 private:
-    // singleton pattern, the only instance
-    static Controller* m_instance;
     // private constructor, since it is a singleton pattern
     Controller() {} 
     // destructor
@@ -85,32 +279,91 @@ private:
     // delete copy constructor and assignment operator
     Controller(const Controller&) = delete; 
     void operator=(const Controller&) = delete; 
-    // functions to operate the model
-    // function 1: import 3D model from a file
-    void Import3DModel(const string& path);
+    // execute the arguments on a model, a writer must hold the writer
+    // mutex, the progress of a background batch, nullptr otherwise
+    vector<Response> ExecuteArguments(const vector<Argument>& arguments,
+                        BatchMode mode, Progress* progress,
+                        shared_ptr<Model3D>& model, bool writer);
+    // check if an argument changes the model in place
+    static bool EditsModel(Argument::ArgumentKey key);
+    // get the published model
+    shared_ptr<Model3D> LoadModel() const;
+    // publish the model of a writer
+    void PublishModel(const shared_ptr<Model3D>& model);
+    // handle one argument, from the cache if it is a repeated query
+    Response HandleCachedArgument(const Argument& argument,
+                                  shared_ptr<Model3D>& model);
+    // handle one argument
+    Response HandleArgument(const Argument& argument,
+                            shared_ptr<Model3D>& model);
+    // handle a DISPLAY_METRICS argument
+    Response HandleMetricsArgument(const vector<string>& values);
+    // handle a DISPLAY_MEMORY argument
+    Response HandleMemoryArgument(const shared_ptr<Model3D>& model) const;
+    // handle a FILE_STATISTICS argument
+    Response HandleFileStatisticsArgument(const string& path);
+    // handle the consecutive ADD_FACE or ADD_LINE arguments 
+    // [begin, end) of a batch with one bulk operation
+    void AddFaces(const vector<Argument>& arguments, size_t begin, 
+                  size_t end, BatchMode mode, vector<Response>& responses,
+                  shared_ptr<Model3D>& model);
+    void AddLines(const vector<Argument>& arguments, size_t begin, 
+                  size_t end, BatchMode mode, vector<Response>& responses,
+                  shared_ptr<Model3D>& model);
+    // functions to operate the model of a batch
+    // every function returns NONE on success or the error code
+    // function 1: import 3D model from a file, replacing the model
+    ErrorCode Import3DModel(shared_ptr<Model3D>& model, const string& path);
     // function 2: export 3D model to a file
-    void Export3DModel(const string& path);
+    ErrorCode Export3DModel(const shared_ptr<Model3D>& model,
+                            const string& path);
     // function 3: delete a face from the model
-    void DeleteFace(unsigned int FaceIndex);
+    ErrorCode DeleteFace(shared_ptr<Model3D>& model, unsigned int FaceIndex);
     // function 4: add a face to the model
-    void AddFace(const Face3D& face);
+    ErrorCode AddFace(shared_ptr<Model3D>& model, const Face3D& face);
     // function 5: modify a point of a face
-    void ModifyFacePoint(unsigned int FaceIndex, unsigned int PointIndex, 
+    ErrorCode ModifyFacePoint(shared_ptr<Model3D>& model,
+                        unsigned int FaceIndex, unsigned int PointIndex, 
                         const Point3D& point);
     // function 6: add a line to the model
-    void AddLine(const Line3D& line);
+    ErrorCode AddLine(shared_ptr<Model3D>& model, const Line3D& line);
     // function 7: delete a line from the model
-    void DeleteLine(unsigned int LineIndex);
+    ErrorCode DeleteLine(shared_ptr<Model3D>& model, unsigned int LineIndex);
     // function 8: modify a point of a line
-    void ModifyLinePoint(unsigned int LineIndex, unsigned int PointIndex, 
+    ErrorCode ModifyLinePoint(shared_ptr<Model3D>& model,
+                        unsigned int LineIndex, unsigned int PointIndex, 
                         const Point3D& point);
     // other functions about displaying the model is implemented in the viewer
-    // support operations on only one model 
+    // support operations on only one model, the published snapshot
+    // only read and written with atomic_load and atomic_store
     shared_ptr<Model3D> m_model;
+    // serializes the batches that change the model
+    mutex m_writeMutex;
+    // progress of the running background batch, nullptr otherwise
+    // only set under the writer mutex
+    Progress* m_progress = nullptr;
+    // runs the background batches
+    CommandExecutor m_executor;
+    // responses of read-only arguments for the version of the model
+    QueryCache m_queryCache;
+    // latency of the arguments, number of the responses, size of files
+    Metrics m_metrics;
     // convert a vector of strings to a vector of points
     static vector<Point3D> StringsToPoints(const vector<string>& pointStrings);
     // convert a string to a point
     static Point3D StringToPoint(const string& pointString);
+    // convert a vector of strings to a vector of points without throwing
+    static Result<vector<Point3D>> TryStringsToPoints(
+                const vector<string>& pointStrings);
+    // convert a string to a point without throwing, see PointParser
+    static Result<Point3D> TryStringToPoint(const string& pointString);
+    // convert a string to an index without throwing
+    static Result<int> StringToIndex(const string& indexString);
+    // read the optional offset and limit of a listing, the limit is
+    // SIZE_MAX without them
+    static ErrorCode StringsToPage(const vector<string>& values,
+                                   size_t count, size_t& offset,
+                                   size_t& limit);
 };
 
 #endif // CONTROLLER_HPP
\ No newline at end of file
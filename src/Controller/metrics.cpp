@@ -0,0 +1,592 @@
+// [file name] : metrics.cpp
+// [function] : implement the LatencyHistogram and Metrics classes
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the LatencyHistogram and Metrics classes
+// reason: to report the latency of every command
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: keep the peak allocation of every argument key
+// reason: to report how much memory a command allocated
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the counters of the TaskScheduler to the rows and the JSON
+// reason: to tune the number of threads and the grain of the tasks
+// -----------------------------------------------------------
+
+#include "metrics.hpp"
+#include "../Model/Parallel/taskscheduler.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+using namespace std;
+
+const unsigned int LatencyHistogram::SUB_BUCKET_BITS;
+const size_t LatencyHistogram::BUCKET_COUNT;
+const size_t Metrics::ARGUMENT_KEY_COUNT;
+const size_t Metrics::RESPONSE_KEY_COUNT;
+
+// the number of buckets of a power of two
+static const uint64_t SUB_BUCKETS = 1ull << LatencyHistogram::SUB_BUCKET_BITS;
+
+// -----------------------------------------------------------
+// [name] : LatencyHistogram
+// [function] : constructor of the LatencyHistogram class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+LatencyHistogram::LatencyHistogram() {
+    Reset();
+}
+
+// -----------------------------------------------------------
+// [name] : Record
+// [function] : count a duration
+// [input] : the duration in nanoseconds
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void LatencyHistogram::Record(uint64_t nanoseconds) {
+    m_buckets[BucketOf(nanoseconds)].fetch_add(1, memory_order_relaxed);
+    m_count.fetch_add(1, memory_order_relaxed);
+    m_sum.fetch_add(nanoseconds, memory_order_relaxed);
+    uint64_t current = m_min.load(memory_order_relaxed);
+    while (nanoseconds < current &&
+           !m_min.compare_exchange_weak(current, nanoseconds,
+                                        memory_order_relaxed)) {
+    }
+    current = m_max.load(memory_order_relaxed);
+    while (nanoseconds > current &&
+           !m_max.compare_exchange_weak(current, nanoseconds,
+                                        memory_order_relaxed)) {
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Reset
+// [function] : forget all durations
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void LatencyHistogram::Reset() {
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        m_buckets[i].store(0, memory_order_relaxed);
+    }
+    m_count.store(0, memory_order_relaxed);
+    m_sum.store(0, memory_order_relaxed);
+    m_min.store(UINT64_MAX, memory_order_relaxed);
+    m_max.store(0, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetCount, GetSum, GetMin, GetMax
+// [function] : get the number, the sum, the shortest and the longest
+//              of the durations
+// [input] : none
+// [output] : the value, 0 if there are no durations
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t LatencyHistogram::GetCount() const {
+    return m_count.load(memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::GetSum() const {
+    return m_sum.load(memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::GetMin() const {
+    uint64_t min = m_min.load(memory_order_relaxed);
+    return min == UINT64_MAX ? 0 : min;
+}
+
+uint64_t LatencyHistogram::GetMax() const {
+    return m_max.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetPercentile
+// [function] : get the duration below which the given percent of the
+//              durations are
+// [input] : the percentile in [0, 100]
+// [output] : the highest duration of the bucket holding the percentile,
+//            at most the longest duration, 0 if there are no durations
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t LatencyHistogram::GetPercentile(double percentile) const {
+    // count the buckets themselves, the total may be behind them
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        counts[i] = m_buckets[i].load(memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    if (percentile < 0) {
+        percentile = 0;
+    }
+    if (percentile > 100) {
+        percentile = 100;
+    }
+    // the rank of the duration, 1 for the shortest
+    uint64_t rank = static_cast<uint64_t>(
+        ceil(percentile / 100 * static_cast<double>(total)));
+    if (rank == 0) {
+        rank = 1;
+    }
+    uint64_t max = GetMax();
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += counts[i];
+        if (seen >= rank) {
+            uint64_t highest = HighestOf(i);
+            return highest < max ? highest : max;
+        }
+    }
+    return max;
+}
+
+// -----------------------------------------------------------
+// [name] : BucketOf
+// [function] : get the bucket of a duration
+// [input] : the duration in nanoseconds
+// [output] : the index of the bucket, below BUCKET_COUNT
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t LatencyHistogram::BucketOf(uint64_t nanoseconds) {
+    if (nanoseconds < SUB_BUCKETS) {
+        return static_cast<size_t>(nanoseconds);
+    }
+    // the position of the highest bit, found in 6 halving steps
+    unsigned int exponent = 0;
+    uint64_t rest = nanoseconds;
+    for (unsigned int shift = 32; shift > 0; shift /= 2) {
+        if ((rest >> shift) != 0) {
+            rest >>= shift;
+            exponent += shift;
+        }
+    }
+    // the bits below the highest one pick the bucket of the power
+    unsigned int lowBits = exponent - SUB_BUCKET_BITS;
+    size_t sub = static_cast<size_t>(
+        (nanoseconds >> lowBits) & (SUB_BUCKETS - 1));
+    return (lowBits + 1) * SUB_BUCKETS + sub;
+}
+
+// -----------------------------------------------------------
+// [name] : HighestOf
+// [function] : get the highest duration of a bucket
+// [input] : the index of the bucket
+// [output] : the duration in nanoseconds
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t LatencyHistogram::HighestOf(size_t bucket) {
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    unsigned int lowBits = static_cast<unsigned int>(
+        bucket / SUB_BUCKETS - 1);
+    uint64_t sub = bucket % SUB_BUCKETS;
+    uint64_t lowest = (SUB_BUCKETS + sub) << lowBits;
+    return lowest + ((1ull << lowBits) - 1);
+}
+
+// -----------------------------------------------------------
+// [name] : Metrics
+// [function] : constructor of the Metrics class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Metrics::Metrics() : m_enabled(true) {
+    Reset();
+}
+
+// -----------------------------------------------------------
+// [name] : SetEnabled
+// [function] : turn the sampling on or off
+// [input] : true to turn it on
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Metrics::SetEnabled(bool enabled) {
+    m_enabled.store(enabled, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : IsEnabled
+// [function] : check if the sampling is on
+// [input] : none
+// [output] : true if it is on
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Metrics::IsEnabled() const {
+    return m_enabled.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : Now
+// [function] : read a steady clock
+// [input] : none
+// [output] : the time in nanoseconds since an unspecified moment
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Metrics::Now() {
+    return static_cast<uint64_t>(
+        chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// -----------------------------------------------------------
+// [name] : RecordArgument
+// [function] : add the duration of an argument
+// [input] : the argument key, the duration in nanoseconds
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Metrics::RecordArgument(Argument::ArgumentKey key,
+                             uint64_t nanoseconds) {
+    size_t index = static_cast<size_t>(key);
+    if (index < ARGUMENT_KEY_COUNT) {
+        m_arguments[index].Record(nanoseconds);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : RecordResponse
+// [function] : count a response
+// [input] : the response key
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Metrics::RecordResponse(Response::ResponseKey key) {
+    size_t index = static_cast<size_t>(key);
+    if (index < RESPONSE_KEY_COUNT) {
+        m_responses[index].fetch_add(1, memory_order_relaxed);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : RecordPeakBytes
+// [function] : keep the peak allocation of an argument if it is the
+//              highest of its key
+// [input] : the argument key, the bytes allocated above the start of
+//           the argument
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Metrics::RecordPeakBytes(Argument::ArgumentKey key, uint64_t bytes) {
+    size_t index = static_cast<size_t>(key);
+    if (index >= ARGUMENT_KEY_COUNT) {
+        return;
+    }
+    uint64_t peak = m_peakBytes[index].load(memory_order_relaxed);
+    while (bytes > peak &&
+           !m_peakBytes[index].compare_exchange_weak(
+               peak, bytes, memory_order_relaxed)) {}
+}
+
+// -----------------------------------------------------------
+// [name] : RecordImport, RecordExport
+// [function] : add a file that was read or written
+// [input] : the size of the file, the duration in nanoseconds
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Metrics::RecordImport(uint64_t bytes, uint64_t nanoseconds) {
+    Record(m_import, bytes, nanoseconds);
+}
+
+void Metrics::RecordExport(uint64_t bytes, uint64_t nanoseconds) {
+    Record(m_export, bytes, nanoseconds);
+}
+
+// -----------------------------------------------------------
+// [name] : Record
+// [function] : add a file to a transfer
+// [input] : the transfer, the size of the file, the duration
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Metrics::Record(Transfer& transfer, uint64_t bytes,
+                     uint64_t nanoseconds) {
+    transfer.Count.fetch_add(1, memory_order_relaxed);
+    transfer.Bytes.fetch_add(bytes, memory_order_relaxed);
+    transfer.Nanoseconds.fetch_add(nanoseconds, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : Reset
+// [function] : forget everything that was recorded
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Metrics::Reset() {
+    for (size_t i = 0; i < ARGUMENT_KEY_COUNT; i++) {
+        m_arguments[i].Reset();
+        m_peakBytes[i].store(0, memory_order_relaxed);
+    }
+    for (size_t i = 0; i < RESPONSE_KEY_COUNT; i++) {
+        m_responses[i].store(0, memory_order_relaxed);
+    }
+    for (Transfer* transfer : {&m_import, &m_export}) {
+        transfer->Count.store(0, memory_order_relaxed);
+        transfer->Bytes.store(0, memory_order_relaxed);
+        transfer->Nanoseconds.store(0, memory_order_relaxed);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : GetHistogram
+// [function] : get the histogram of an argument key
+// [input] : the argument key
+// [output] : the histogram
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const LatencyHistogram& Metrics::GetHistogram(
+            Argument::ArgumentKey key) const {
+    return m_arguments[static_cast<size_t>(key)];
+}
+
+// -----------------------------------------------------------
+// [name] : GetResponseCount
+// [function] : get the number of responses of a key
+// [input] : the response key
+// [output] : the number of responses
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Metrics::GetResponseCount(Response::ResponseKey key) const {
+    size_t index = static_cast<size_t>(key);
+    return index < RESPONSE_KEY_COUNT
+        ? m_responses[index].load(memory_order_relaxed) : 0;
+}
+
+// -----------------------------------------------------------
+// [name] : GetPeakBytes
+// [function] : get the highest peak allocation of an argument key
+// [input] : the argument key
+// [output] : the bytes, 0 if none were recorded
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Metrics::GetPeakBytes(Argument::ArgumentKey key) const {
+    size_t index = static_cast<size_t>(key);
+    return index < ARGUMENT_KEY_COUNT
+        ? m_peakBytes[index].load(memory_order_relaxed) : 0;
+}
+
+// -----------------------------------------------------------
+// [name] : Milliseconds
+// [function] : format a duration in milliseconds
+// [input] : the duration in nanoseconds
+// [output] : the duration with 3 decimals
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static string Milliseconds(uint64_t nanoseconds) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.3f ms",
+             static_cast<double>(nanoseconds) / 1e6);
+    return buffer;
+}
+
+// -----------------------------------------------------------
+// [name] : BytesPerSecond
+// [function] : compute the throughput of a transfer
+// [input] : the bytes and the duration in nanoseconds
+// [output] : the bytes per second, 0 without a duration
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t BytesPerSecond(uint64_t bytes, uint64_t nanoseconds) {
+    if (nanoseconds == 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(static_cast<double>(bytes) * 1e9 /
+                                 static_cast<double>(nanoseconds));
+}
+
+// -----------------------------------------------------------
+// [name] : PeakBytes
+// [function] : format a peak allocation for a row
+// [input] : the bytes
+// [output] : the bytes after a comma, empty if none were recorded
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static string PeakBytes(uint64_t bytes) {
+    return bytes == 0 ? string() : ", peak " + to_string(bytes) + " bytes";
+}
+
+// -----------------------------------------------------------
+// [name] : GetRows
+// [function] : format the metrics for the viewer
+// [input] : none
+// [output] : one row per argument key and per response key that was
+//            used, one row per transfer and one for the scheduler
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<string> Metrics::GetRows() const {
+    vector<string> rows;
+    rows.push_back(string("sampling: ") + (IsEnabled() ? "on" : "off"));
+    for (size_t i = 0; i < ARGUMENT_KEY_COUNT; i++) {
+        const LatencyHistogram& histogram = m_arguments[i];
+        uint64_t count = histogram.GetCount();
+        if (count == 0) {
+            continue;
+        }
+        rows.push_back(
+            string(Argument::KeyName(static_cast<Argument::ArgumentKey>(i)))
+            + ": " + to_string(count) + " calls, mean "
+            + Milliseconds(histogram.GetSum() / count)
+            + ", p50 " + Milliseconds(histogram.GetPercentile(50))
+            + ", p90 " + Milliseconds(histogram.GetPercentile(90))
+            + ", p99 " + Milliseconds(histogram.GetPercentile(99))
+            + ", max " + Milliseconds(histogram.GetMax())
+            + PeakBytes(m_peakBytes[i].load(memory_order_relaxed)));
+    }
+    for (size_t i = 0; i < RESPONSE_KEY_COUNT; i++) {
+        uint64_t count = m_responses[i].load(memory_order_relaxed);
+        if (count != 0) {
+            rows.push_back(
+                string(Response::KeyName(
+                    static_cast<Response::ResponseKey>(i)))
+                + ": " + to_string(count) + " responses");
+        }
+    }
+    const char* names[] = {"import", "export"};
+    const Transfer* transfers[] = {&m_import, &m_export};
+    for (size_t i = 0; i < 2; i++) {
+        uint64_t count = transfers[i]->Count.load(memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        uint64_t bytes = transfers[i]->Bytes.load(memory_order_relaxed);
+        uint64_t time =
+            transfers[i]->Nanoseconds.load(memory_order_relaxed);
+        char buffer[128];
+        snprintf(buffer, sizeof(buffer),
+                 "%s: %llu files, %llu bytes, %.1f MB/s", names[i],
+                 static_cast<unsigned long long>(count),
+                 static_cast<unsigned long long>(bytes),
+                 static_cast<double>(BytesPerSecond(bytes, time)) / 1e6);
+        rows.push_back(buffer);
+    }
+    TaskScheduler::Statistics scheduler =
+        TaskScheduler::GetInstance().GetStatistics();
+    rows.push_back("scheduler: " + to_string(scheduler.Threads)
+        + " threads, " + to_string(scheduler.Tasks) + " tasks, "
+        + to_string(scheduler.Steals) + " steals, queue depth "
+        + to_string(scheduler.QueueDepth) + ", peak "
+        + to_string(scheduler.PeakQueueDepth));
+    return rows;
+}
+
+// -----------------------------------------------------------
+// [name] : GetJson
+// [function] : format the metrics as one JSON object
+// [input] : none
+// [output] : the object, the durations are in nanoseconds, e.g.
+//            {"enabled":true,"arguments":{"DISPLAY_STATISTICS":{
+//            "count":1,"sum_ns":..,"min_ns":..,"p50_ns":..,"p90_ns":..,
+//            "p99_ns":..,"max_ns":..,"peak_bytes":..}},"responses":{"DISPLAY_STATISTICS":
+//            1},"import":{"count":0,"bytes":0,"ns":0,
+//            "bytes_per_second":0},"export":{..},"scheduler":{
+//            "threads":4,"tasks":..,"steals":..,"queue_depth":..,
+//            "peak_queue_depth":..}}
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+string Metrics::GetJson() const {
+    string json = "{\"enabled\":";
+    json += IsEnabled() ? "true" : "false";
+    json += ",\"arguments\":{";
+    bool first = true;
+    for (size_t i = 0; i < ARGUMENT_KEY_COUNT; i++) {
+        const LatencyHistogram& histogram = m_arguments[i];
+        uint64_t count = histogram.GetCount();
+        if (count == 0) {
+            continue;
+        }
+        // the key names need no escaping
+        json += first ? "\"" : ",\"";
+        json += Argument::KeyName(static_cast<Argument::ArgumentKey>(i));
+        json += "\":{\"count\":" + to_string(count)
+              + ",\"sum_ns\":" + to_string(histogram.GetSum())
+              + ",\"min_ns\":" + to_string(histogram.GetMin())
+              + ",\"p50_ns\":" + to_string(histogram.GetPercentile(50))
+              + ",\"p90_ns\":" + to_string(histogram.GetPercentile(90))
+              + ",\"p99_ns\":" + to_string(histogram.GetPercentile(99))
+              + ",\"max_ns\":" + to_string(histogram.GetMax())
+              + ",\"peak_bytes\":"
+              + to_string(m_peakBytes[i].load(memory_order_relaxed)) + "}";
+        first = false;
+    }
+    json += "},\"responses\":{";
+    first = true;
+    for (size_t i = 0; i < RESPONSE_KEY_COUNT; i++) {
+        uint64_t count = m_responses[i].load(memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        json += first ? "\"" : ",\"";
+        json += Response::KeyName(static_cast<Response::ResponseKey>(i));
+        json += "\":" + to_string(count);
+        first = false;
+    }
+    json += "}";
+    const char* names[] = {"import", "export"};
+    const Transfer* transfers[] = {&m_import, &m_export};
+    for (size_t i = 0; i < 2; i++) {
+        uint64_t bytes = transfers[i]->Bytes.load(memory_order_relaxed);
+        uint64_t time =
+            transfers[i]->Nanoseconds.load(memory_order_relaxed);
+        json += ",\"" + string(names[i]) + "\":{\"count\":"
+              + to_string(transfers[i]->Count.load(memory_order_relaxed))
+              + ",\"bytes\":" + to_string(bytes)
+              + ",\"ns\":" + to_string(time)
+              + ",\"bytes_per_second\":"
+              + to_string(BytesPerSecond(bytes, time)) + "}";
+    }
+    TaskScheduler::Statistics scheduler =
+        TaskScheduler::GetInstance().GetStatistics();
+    json += ",\"scheduler\":{\"threads\":" + to_string(scheduler.Threads)
+          + ",\"tasks\":" + to_string(scheduler.Tasks)
+          + ",\"steals\":" + to_string(scheduler.Steals)
+          + ",\"queue_depth\":" + to_string(scheduler.QueueDepth)
+          + ",\"peak_queue_depth\":" + to_string(scheduler.PeakQueueDepth)
+          + "}}";
+    return json;
+}
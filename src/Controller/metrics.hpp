@@ -0,0 +1,190 @@
+// [file name] : metrics.hpp
+// [function] : declare the LatencyHistogram and Metrics classes
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init LatencyHistogram and Metrics classes
+// reason: there was no way to tell which commands were slow, or how
+//         fast models were read and written, without a profiler
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add RecordPeakBytes
+// reason: to report how much memory a command allocated
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: report the counters of the TaskScheduler
+// reason: to tune the number of threads and the grain of the tasks
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: note that only writers record the peak allocation
+// reason: the peak is global and queries run beside each other
+// -----------------------------------------------------------
+
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../Message/argument.hpp"
+#include "../Message/response.hpp"
+
+using namespace std;
+
+// notes on the class LatencyHistogram
+// -----------------------------------------------------------
+// [class name] : LatencyHistogram
+// [function] : count durations in buckets of bounded relative error
+// [notes on interface] :
+// 1. the durations are in nanoseconds. a duration below 16 has a bucket
+//    of its own, every larger power of two is split into 16 buckets,
+//    so a percentile is at most 1/16 above the real value and the
+//    whole range of uint64_t fits in BUCKET_COUNT buckets
+// 2. Record only increments atomic counters, it can be called from any
+//    thread without a lock. a percentile read while durations are
+//    recorded may miss the latest ones
+// 3. GetPercentile takes a percentile in [0, 100] and returns the
+//    highest duration of its bucket, never more than GetMax
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class LatencyHistogram
+{
+public:
+    // the buckets of a power of two are 2 ^ SUB_BUCKET_BITS
+    static const unsigned int SUB_BUCKET_BITS = 4;
+    // the number of buckets, 16 for the durations below 16
+    // and 16 for each power of two from 16 to 2 ^ 63
+    static const size_t BUCKET_COUNT =
+        (64 - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS;
+
+    // constructor, no durations
+    LatencyHistogram();
+    // count a duration
+    void Record(uint64_t nanoseconds);
+    // forget all durations
+    void Reset();
+    // number, sum, shortest and longest of the durations
+    uint64_t GetCount() const;
+    uint64_t GetSum() const;
+    uint64_t GetMin() const;
+    uint64_t GetMax() const;
+    // the duration below which the given percent of the durations are
+    uint64_t GetPercentile(double percentile) const;
+
+private:
+    // no copies, the counters are atomic
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    void operator=(const LatencyHistogram&) = delete;
+    // the bucket of a duration
+    static size_t BucketOf(uint64_t nanoseconds);
+    // the highest duration of a bucket
+    static uint64_t HighestOf(size_t bucket);
+
+    // private member variables
+    atomic<uint64_t> m_buckets[BUCKET_COUNT];
+    atomic<uint64_t> m_count;
+    atomic<uint64_t> m_sum;
+    atomic<uint64_t> m_min;
+    atomic<uint64_t> m_max;
+};
+
+// notes on the class Metrics
+// -----------------------------------------------------------
+// [class name] : Metrics
+// [function] : collect the latency of the arguments, the number of the
+//              responses and the throughput of import and export
+// [notes on interface] :
+// 1. RecordArgument adds the duration of an argument to the histogram
+//    of its key, RecordResponse counts a response of a key,
+//    RecordImport and RecordExport add the size and the duration of a
+//    file that was read or written
+// 2. the caller asks IsEnabled before it reads the clock, so turned
+//    off sampling costs one atomic load per batch. the Record functions
+//    still count what they are given
+// 3. GetRows formats the metrics for the viewer, one row per key that
+//    was used, GetJson formats them as one JSON object
+// 4. RecordPeakBytes keeps the highest peak allocation of an argument
+//    key, it is only given with AllocationCounter::IsAvailable and only
+//    for the arguments of batches that may edit the model, which run 
+//    one at a time. a read-only batch has no peak
+// 5. all functions can be called from any thread
+// 6. GetRows and GetJson also show the threads, tasks, steals and queue
+//    depth of the shared TaskScheduler, Reset leaves its counters, the
+//    constructor must not create the scheduler before it is configured
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class Metrics
+{
+public:
+    // constructor, sampling is on
+    Metrics();
+    // turn the sampling on or off
+    void SetEnabled(bool enabled);
+    // check if the sampling is on
+    bool IsEnabled() const;
+    // nanoseconds of a steady clock, for the durations
+    static uint64_t Now();
+    // add the duration of an argument
+    void RecordArgument(Argument::ArgumentKey key, uint64_t nanoseconds);
+    // count a response
+    void RecordResponse(Response::ResponseKey key);
+    // keep the peak allocation of an argument if it is the highest
+    void RecordPeakBytes(Argument::ArgumentKey key, uint64_t bytes);
+    // add a file that was read or written
+    void RecordImport(uint64_t bytes, uint64_t nanoseconds);
+    void RecordExport(uint64_t bytes, uint64_t nanoseconds);
+    // forget everything that was recorded
+    void Reset();
+    // get the histogram of an argument key
+    const LatencyHistogram& GetHistogram(Argument::ArgumentKey key) const;
+    // get the number of responses of a key
+    uint64_t GetResponseCount(Response::ResponseKey key) const;
+    // get the highest peak allocation of an argument key
+    uint64_t GetPeakBytes(Argument::ArgumentKey key) const;
+    // format the metrics, one row per used key
+    vector<string> GetRows() const;
+    // format the metrics as one JSON object
+    string GetJson() const;
+
+private:
+    // the files read or written
+    struct Transfer {
+        atomic<uint64_t> Count;
+        atomic<uint64_t> Bytes;
+        atomic<uint64_t> Nanoseconds;
+    };
+    // the number of argument and response keys
+    static const size_t ARGUMENT_KEY_COUNT =
+        static_cast<size_t>(Argument::ArgumentKey::UNKNOWN) + 1;
+    static const size_t RESPONSE_KEY_COUNT =
+        static_cast<size_t>(Response::ResponseKey::COUNT);
+    // no copies, the counters are atomic
+    Metrics(const Metrics&) = delete;
+    void operator=(const Metrics&) = delete;
+    // add a file to a transfer
+    static void Record(Transfer& transfer, uint64_t bytes,
+                       uint64_t nanoseconds);
+
+    // private member variables
+    atomic<bool> m_enabled;
+    LatencyHistogram m_arguments[ARGUMENT_KEY_COUNT];
+    atomic<uint64_t> m_peakBytes[ARGUMENT_KEY_COUNT];
+    atomic<uint64_t> m_responses[RESPONSE_KEY_COUNT];
+    Transfer m_import;
+    Transfer m_export;
+};
+
+#endif // METRICS_HPP
@@ -0,0 +1,251 @@
+// [file name] : pointparser.cpp
+// [function] : implement the PointParser class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the PointParser class
+// reason: to parse points without regex and without allocation
+// -----------------------------------------------------------
+
+#include "pointparser.hpp"
+#include <string>
+#include <vector>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+// from_chars for double needs a recent standard library,
+// older ones (e.g. libstdc++ before GCC 11) only have the integer version
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define POINTPARSER_HAS_FROM_CHARS 1
+#include <system_error>
+#endif
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : IsSpace
+// [function] : check if a character is whitespace, as isspace in "C" locale
+// [input] : a character
+// [output] : true if the character is whitespace
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool IsSpace(char ch) {
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' ||
+           ch == '\v' || ch == '\f';
+}
+
+// -----------------------------------------------------------
+// [name] : IsDigit
+// [function] : check if a character is a decimal digit
+// [input] : a character
+// [output] : true if the character is a digit
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool IsDigit(char ch) {
+    return ch >= '0' && ch <= '9';
+}
+
+// -----------------------------------------------------------
+// [name] : Parse
+// [function] : parse one point from a range of characters
+// [input] : the begin and the end of the characters,
+//           the array receiving the three coordinates
+// [output] : NONE, INVALID_NUMBER_FORMAT or INPUT_NUMBER_ERROR
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode PointParser::Parse(const char* begin, const char* end,
+                             double (&coordinates)[3]) {
+    // delete the leading spaces and parentheses
+    while (begin != end && (IsSpace(*begin) || *begin == '(')) {
+        ++begin;
+    }
+    // delete the trailing spaces and parentheses
+    while (end != begin && (IsSpace(end[-1]) || end[-1] == ')')) {
+        --end;
+    }
+    unsigned int count = 0;
+    const char* current = begin;
+    while (current != end) {
+        // read one number
+        const char* numberEnd = ScanNumber(current, end);
+        if (numberEnd == current) {
+            return ErrorCode::INVALID_NUMBER_FORMAT;
+        }
+        double value;
+        if (!ConvertNumber(current, numberEnd, value)) {
+            return ErrorCode::INVALID_NUMBER_FORMAT;
+        }
+        // keep counting after three numbers to report the right error
+        if (count < 3) {
+            coordinates[count] = value;
+        }
+        count++;
+        // skip the separator, whitespace or a comma with whitespace around
+        current = numberEnd;
+        while (current != end && IsSpace(*current)) {
+            ++current;
+        }
+        if (current != end && *current == ',') {
+            ++current;
+            while (current != end && IsSpace(*current)) {
+                ++current;
+            }
+        }
+        else if (current == numberEnd && current != end) {
+            // the number is followed directly by another character
+            return ErrorCode::INVALID_NUMBER_FORMAT;
+        }
+    }
+    // check if the number of coordinates is correct
+    if (count != 3) {
+        return ErrorCode::INPUT_NUMBER_ERROR;
+    }
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : Parse
+// [function] : parse one point from a string
+// [input] : the string
+// [output] : the point, INVALID_NUMBER_FORMAT or INPUT_NUMBER_ERROR
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Point3D> PointParser::Parse(const string& text) {
+    double coordinates[3];
+    ErrorCode code = Parse(text.data(), text.data() + text.size(),
+                           coordinates);
+    if (code != ErrorCode::NONE) {
+        return code;
+    }
+    return Point3D(coordinates[0], coordinates[1], coordinates[2]);
+}
+
+// -----------------------------------------------------------
+// [name] : ParseMany
+// [function] : parse the points of a buffer, one point per line
+// [input] : the begin and the end of the buffer, the vector receiving
+//           the points
+// [output] : NONE or the error code of the first point that fails
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode PointParser::ParseMany(const char* begin, const char* end,
+                                 vector<Point3D>& points) {
+    const char* lineBegin = begin;
+    while (lineBegin != end) {
+        // find the end of the line
+        const char* lineEnd = lineBegin;
+        while (lineEnd != end && *lineEnd != '\n' && *lineEnd != ';') {
+            ++lineEnd;
+        }
+        // skip blank lines
+        const char* first = lineBegin;
+        while (first != lineEnd && IsSpace(*first)) {
+            ++first;
+        }
+        if (first != lineEnd) {
+            double coordinates[3];
+            ErrorCode code = Parse(first, lineEnd, coordinates);
+            if (code != ErrorCode::NONE) {
+                return code;
+            }
+            points.push_back(
+                Point3D(coordinates[0], coordinates[1], coordinates[2]));
+        }
+        // move to the next line
+        lineBegin = lineEnd == end ? end : lineEnd + 1;
+    }
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : ParseMany
+// [function] : parse the points of a string buffer, one point per line
+// [input] : the buffer, the vector receiving the points
+// [output] : NONE or the error code of the first point that fails
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode PointParser::ParseMany(const string& text, vector<Point3D>& points) {
+    return ParseMany(text.data(), text.data() + text.size(), points);
+}
+
+// -----------------------------------------------------------
+// [name] : ScanNumber
+// [function] : find the end of a number, the accepted form is
+//              [-+]? ( [0-9]+ | [0-9]* '.' [0-9]+ )
+// [input] : the begin and the end of the characters
+// [output] : the end of the number, begin if there is no number
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const char* PointParser::ScanNumber(const char* begin, const char* end) {
+    const char* current = begin;
+    if (current != end && (*current == '-' || *current == '+')) {
+        ++current;
+    }
+    const char* integerBegin = current;
+    while (current != end && IsDigit(*current)) {
+        ++current;
+    }
+    bool hasIntegerPart = current != integerBegin;
+    if (current != end && *current == '.') {
+        const char* fractionBegin = ++current;
+        while (current != end && IsDigit(*current)) {
+            ++current;
+        }
+        // a fraction needs at least one digit
+        if (current == fractionBegin) {
+            return begin;
+        }
+        return current;
+    }
+    return hasIntegerPart ? current : begin;
+}
+
+// -----------------------------------------------------------
+// [name] : ConvertNumber
+// [function] : convert a number found by ScanNumber to a double
+// [input] : the begin and the end of the number, the converted value
+// [output] : false if the number is out of the range of double
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool PointParser::ConvertNumber(const char* begin, const char* end,
+                                double& value) {
+    // from_chars and the checks below do not take a plus sign
+    if (*begin == '+') {
+        ++begin;
+    }
+#ifdef POINTPARSER_HAS_FROM_CHARS
+    from_chars_result result = from_chars(begin, end, value);
+    return result.ec == errc() && result.ptr == end;
+#else
+    // strtod needs a terminated string, copy the number to the stack
+    char buffer[128];
+    size_t length = static_cast<size_t>(end - begin);
+    if (length >= sizeof(buffer)) {
+        return false;
+    }
+    memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+    char* parsedEnd = nullptr;
+    errno = 0;
+    value = strtod(buffer, &parsedEnd);
+    return errno != ERANGE && parsedEnd == buffer + length;
+#endif
+}
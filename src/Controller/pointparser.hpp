@@ -0,0 +1,73 @@
+// [file name] : pointparser.hpp
+// [function] : declare the PointParser class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init PointParser class
+//       add parsing of one point and of a buffer of many points
+// reason: Controller::StringToPoint compiled a regex on every call,
+//         scripted batches of faces spent most of their time there
+// -----------------------------------------------------------
+
+#ifndef POINTPARSER_HPP
+#define POINTPARSER_HPP
+
+#include <string>
+#include <vector>
+#include "../Model/Element3D/point3d.hpp"
+#include "../Model/Result/result.hpp"
+
+using namespace std;
+
+// notes about the class PointParser
+// -----------------------------------------------------------
+// [class name] : PointParser
+// [function] : parse 3D points typed by the user
+// [notes on interface] :
+// 1. all functions are static, the class only groups the parsers
+// 2. a point is three numbers separated by whitespace or by commas,
+//    optionally in parentheses, e.g. "(1, 2.5, -3)" or "1 2.5 -3".
+//    a number is an optional sign, digits and an optional fraction,
+//    such as "3", "-0.5" or ".5", exponents are not accepted
+// 3. errors are returned as error codes: INVALID_NUMBER_FORMAT if a token
+//    is not a number, INPUT_NUMBER_ERROR if there are not three numbers
+// 4. parsing into coordinates does not allocate memory, the numbers are
+//    converted with from_chars where the standard library provides it
+//    for doubles, and with strtod on a stack buffer otherwise
+// 5. ParseMany parses a buffer with one point per line, lines may also be
+//    separated by ';', blank lines are skipped
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class PointParser
+{
+public:
+    // parse one point from the characters [begin, end) into coordinates
+    static ErrorCode Parse(const char* begin, const char* end,
+                           double (&coordinates)[3]);
+    // parse one point from a string
+    static Result<Point3D> Parse(const string& text);
+    // parse the points of a buffer and append them to points
+    // on failure the points before the failed one are kept, so the
+    // failed point is the one at the index points.size()
+    static ErrorCode ParseMany(const char* begin, const char* end,
+                               vector<Point3D>& points);
+    // parse the points of a string buffer
+    static ErrorCode ParseMany(const string& text, vector<Point3D>& points);
+
+private:
+    // no instance is needed
+    PointParser() = delete;
+    // find the end of the number starting at begin, begin if there is none
+    static const char* ScanNumber(const char* begin, const char* end);
+    // convert the number [begin, end) found by ScanNumber to a double
+    static bool ConvertNumber(const char* begin, const char* end,
+                              double& value);
+};
+
+#endif // POINTPARSER_HPP
@@ -0,0 +1,218 @@
+// [file name] : querycache.cpp
+// [function] : implement the QueryCache class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the QueryCache class
+// reason: to answer repeated queries on an unchanged model at once
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: count the bytes of the entries
+// reason: to report the memory kept by the cache
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: ignore the versions older than the one of the entries
+// reason: a query on a model that was replaced meanwhile cleared the
+//         entries of the new model
+// -----------------------------------------------------------
+
+#include "querycache.hpp"
+#include <utility>
+
+using namespace std;
+
+const size_t QueryCache::DEFAULT_MAX_ENTRIES = 256;
+const size_t QueryCache::DEFAULT_MAX_ROWS = 1 << 20;
+
+// estimated bytes of a list node and of an index node besides the entry
+// and the key, two pointers each and a bucket for the index
+static const size_t NODE_BYTES = 5 * sizeof(void*) + sizeof(size_t);
+
+// -----------------------------------------------------------
+// [name] : QueryCache
+// [function] : constructor of the QueryCache class
+// [input] : the maximum number of entries and of values of all entries
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+QueryCache::QueryCache(size_t maxEntries, size_t maxRows)
+    : m_version(0), m_maxEntries(maxEntries), m_maxRows(maxRows),
+      m_rows(0), m_bytes(0), m_hits(0), m_misses(0), m_evictions(0) {}
+
+// -----------------------------------------------------------
+// [name] : Find
+// [function] : find the response of an argument
+// [input] : the argument key and values, the version of the model,
+//           the response to fill
+// [output] : true on a hit
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool QueryCache::Find(Argument::ArgumentKey key,
+                      const vector<string>& values, uint64_t version,
+                      Response& response) {
+    lock_guard<mutex> lock(m_mutex);
+    if (version < m_version) {
+        // the query reads a model that was replaced meanwhile
+        m_misses++;
+        return false;
+    }
+    if (version != m_version) {
+        // the model changed, no entry can be used again
+        ClearEntries();
+        m_version = version;
+    }
+    auto it = m_index.find(MakeKey(key, values));
+    if (it == m_index.end()) {
+        m_misses++;
+        return false;
+    }
+    // move the entry to the front, it is the most recently used now
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    response = it->second->Value;
+    m_hits++;
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Insert
+// [function] : keep the response of an argument
+// [input] : the argument key and values, the version of the model,
+//           the response
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void QueryCache::Insert(Argument::ArgumentKey key,
+                        const vector<string>& values, uint64_t version,
+                        const Response& response) {
+    size_t rows = response.GetValueCount();
+    lock_guard<mutex> lock(m_mutex);
+    if (m_maxEntries == 0 || rows > m_maxRows || version < m_version) {
+        return;
+    }
+    if (version != m_version) {
+        ClearEntries();
+        m_version = version;
+    }
+    string text = MakeKey(key, values);
+    // another thread may have answered the same query meanwhile
+    if (m_index.count(text) != 0) {
+        return;
+    }
+    // the key is kept twice, by the entry and by the index, and the
+    // response object is already a part of the entry
+    size_t bytes = sizeof(Entry) + NODE_BYTES + sizeof(string) +
+                   2 * ResponsePayload::HeapBytes(text) +
+                   response.GetMemoryUsage() - sizeof(Response);
+    m_entries.push_front(Entry{text, response, rows, bytes});
+    m_index[move(text)] = m_entries.begin();
+    m_rows += rows;
+    m_bytes += bytes;
+    Shrink();
+}
+
+// -----------------------------------------------------------
+// [name] : SetLimits
+// [function] : change the limits of the cache
+// [input] : the maximum number of entries and of values of all entries
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void QueryCache::SetLimits(size_t maxEntries, size_t maxRows) {
+    lock_guard<mutex> lock(m_mutex);
+    m_maxEntries = maxEntries;
+    m_maxRows = maxRows;
+    Shrink();
+}
+
+// -----------------------------------------------------------
+// [name] : Clear
+// [function] : drop all entries
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void QueryCache::Clear() {
+    lock_guard<mutex> lock(m_mutex);
+    ClearEntries();
+}
+
+// -----------------------------------------------------------
+// [name] : GetStatistics
+// [function] : get the counters and the size of the cache
+// [input] : none
+// [output] : the statistics
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+QueryCache::Statistics QueryCache::GetStatistics() const {
+    lock_guard<mutex> lock(m_mutex);
+    return Statistics{m_hits, m_misses, m_evictions, m_entries.size(),
+                      m_rows, m_bytes};
+}
+
+// -----------------------------------------------------------
+// [name] : MakeKey
+// [function] : make the key of an argument
+// [input] : the argument key and values
+// [output] : the key, the argument key followed by every value with
+//            its size, so different values never give the same key
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+string QueryCache::MakeKey(Argument::ArgumentKey key,
+                           const vector<string>& values) {
+    string text = to_string(static_cast<int>(key));
+    for (const string& value : values) {
+        text += ':';
+        text += to_string(value.size());
+        text += ':';
+        text += value;
+    }
+    return text;
+}
+
+// -----------------------------------------------------------
+// [name] : Shrink
+// [function] : drop the least recently used entries until the limits
+//              hold
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void QueryCache::Shrink() {
+    while (!m_entries.empty() &&
+           (m_entries.size() > m_maxEntries || m_rows > m_maxRows)) {
+        m_rows -= m_entries.back().Rows;
+        m_bytes -= m_entries.back().Bytes;
+        m_index.erase(m_entries.back().Key);
+        m_entries.pop_back();
+        m_evictions++;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : ClearEntries
+// [function] : drop all entries
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void QueryCache::ClearEntries() {
+    m_entries.clear();
+    m_index.clear();
+    m_rows = 0;
+    m_bytes = 0;
+}
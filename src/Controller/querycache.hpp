@@ -0,0 +1,131 @@
+// [file name] : querycache.hpp
+// [function] : declare the QueryCache class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init QueryCache class
+// reason: the statistics and the listings were computed again for every
+//         query, even if the model had not changed since the last one
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: count the bytes of the entries
+// reason: to report the memory kept by the cache
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: ignore the versions older than the one of the entries
+// reason: a query on a model that was replaced meanwhile cleared the
+//         entries of the new model
+// -----------------------------------------------------------
+
+#ifndef QUERYCACHE_HPP
+#define QUERYCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../Message/argument.hpp"
+#include "../Message/response.hpp"
+
+using namespace std;
+
+// notes on the class QueryCache
+// -----------------------------------------------------------
+// [class name] : QueryCache
+// [function] : remember the responses of read-only arguments for one
+//              version of the model
+// [notes on interface] :
+// 1. an entry is found by the argument key, the values and the version
+//    of the model. a newer version than the one of the entries clears
+//    the cache, so old responses do not keep an old model alive. an
+//    older version, of a query that still reads a replaced model, is
+//    a miss and its response is not kept
+// 2. the cache holds at most maxEntries responses with at most maxRows
+//    values together, the least recently used entries are dropped
+//    first. a response with more than maxRows values is not kept
+// 3. the responses share their payloads with the cache, a payload is
+//    never changed, so a hit costs a copy of a shared pointer
+// 4. GetStatistics counts the hits, the misses and the dropped entries.
+//    its Bytes are the keys, the responses and their payloads plus an
+//    estimate of the list and index nodes. a payload shared with a
+//    response given out is counted as if the cache owned it alone
+// 5. all functions can be called from any thread
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class QueryCache
+{
+public:
+    // counters and size of the cache
+    struct Statistics {
+        uint64_t Hits;
+        uint64_t Misses;
+        uint64_t Evictions;
+        size_t Entries;
+        size_t Rows;
+        size_t Bytes;
+    };
+    // default limits
+    static const size_t DEFAULT_MAX_ENTRIES;
+    static const size_t DEFAULT_MAX_ROWS;
+
+    // constructor, the limits of the cache, 0 entries turns it off
+    QueryCache(size_t maxEntries = DEFAULT_MAX_ENTRIES,
+               size_t maxRows = DEFAULT_MAX_ROWS);
+    // find the response of an argument for a version of the model
+    bool Find(Argument::ArgumentKey key, const vector<string>& values,
+              uint64_t version, Response& response);
+    // keep the response of an argument for a version of the model
+    void Insert(Argument::ArgumentKey key, const vector<string>& values,
+                uint64_t version, const Response& response);
+    // change the limits, dropping entries if needed
+    void SetLimits(size_t maxEntries, size_t maxRows);
+    // drop all entries, the counters are kept
+    void Clear();
+    // get the counters and the size
+    Statistics GetStatistics() const;
+
+private:
+    // a kept response
+    struct Entry {
+        string Key;
+        Response Value;
+        size_t Rows;
+        size_t Bytes;
+    };
+    // make the key of an argument
+    static string MakeKey(Argument::ArgumentKey key,
+                          const vector<string>& values);
+    // drop entries until the limits hold, the mutex must be locked
+    void Shrink();
+    // drop all entries, the mutex must be locked
+    void ClearEntries();
+
+    // private member variables
+    // the mutex guards all other members
+    mutable mutex m_mutex;
+    // the entries, most recently used first, and their index by key
+    list<Entry> m_entries;
+    unordered_map<string, list<Entry>::iterator> m_index;
+    // the version of the model the entries belong to
+    uint64_t m_version;
+    size_t m_maxEntries;
+    size_t m_maxRows;
+    size_t m_rows;
+    size_t m_bytes;
+    uint64_t m_hits;
+    uint64_t m_misses;
+    uint64_t m_evictions;
+};
+
+#endif // QUERYCACHE_HPP
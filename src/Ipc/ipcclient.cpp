@@ -0,0 +1,192 @@
+// [file name] : ipcclient.cpp
+// [function] : implement the IpcClient class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the IpcClient class
+// reason: to send arguments to the server from another process
+// -----------------------------------------------------------
+
+#include "ipcclient.hpp"
+#include "wireprotocol.hpp"
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : IpcClient
+// [function] : constructor of the IpcClient class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+IpcClient::IpcClient() : m_descriptor(-1) {}
+
+// -----------------------------------------------------------
+// [name] : ~IpcClient
+// [function] : destructor of the IpcClient class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+IpcClient::~IpcClient() {
+    Close();
+}
+
+#ifdef __linux__
+
+// -----------------------------------------------------------
+// [name] : Connect
+// [function] : connect to the server listening on a socket
+// [input] : the path of the socket, the string receiving the message
+//           of a failure
+// [output] : false on failure
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool IpcClient::Connect(const string& path, string& error) {
+    Close();
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        error = "the socket path is empty or too long";
+        return false;
+    }
+    memcpy(address.sun_path, path.c_str(), path.size());
+    m_descriptor = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (m_descriptor < 0 ||
+        connect(m_descriptor, reinterpret_cast<sockaddr*>(&address),
+                sizeof(address)) != 0) {
+        error = "cannot connect to " + path + ": " + strerror(errno);
+        Close();
+        return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Send
+// [function] : send a batch and wait for its responses
+// [input] : the arguments, what to do after a failed argument, the
+//           vector receiving the responses, the string receiving the
+//           message of a failure
+// [output] : false on failure
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool IpcClient::Send(const vector<Argument>& arguments,
+                     Controller::BatchMode mode,
+                     vector<Response>& responses, string& error) {
+    if (m_descriptor < 0) {
+        error = "not connected";
+        return false;
+    }
+    string frame;
+    WireProtocol::EncodeRequest(
+        arguments, mode == Controller::BatchMode::CONTINUE_ON_ERROR, frame);
+    size_t sent = 0;
+    while (sent < frame.size()) {
+        ssize_t result = send(m_descriptor, frame.data() + sent,
+                              frame.size() - sent, MSG_NOSIGNAL);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result < 0) {
+            error = string("send failed: ") + strerror(errno);
+            Close();
+            return false;
+        }
+        sent += static_cast<size_t>(result);
+    }
+
+    char header[4];
+    if (!ReadExactly(header, sizeof(header), error)) {
+        return false;
+    }
+    string body(WireProtocol::ReadBodySize(header), '\0');
+    if (!ReadExactly(&body[0], body.size(), error)) {
+        return false;
+    }
+    if (!WireProtocol::DecodeResponses(body.data(), body.size(),
+                                       responses)) {
+        error = "the reply of the server is malformed";
+        Close();
+        return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Close
+// [function] : close the connection
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcClient::Close() {
+    if (m_descriptor >= 0) {
+        close(m_descriptor);
+        m_descriptor = -1;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : ReadExactly
+// [function] : read a given number of bytes from the server
+// [input] : the buffer, the number of bytes, the string receiving the
+//           message of a failure
+// [output] : false if the connection failed or was closed
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool IpcClient::ReadExactly(char* buffer, size_t size, string& error) {
+    size_t received = 0;
+    while (received < size) {
+        ssize_t result = recv(m_descriptor, buffer + received,
+                              size - received, 0);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            error = result == 0 ? string("the server closed the connection")
+                                : string("recv failed: ") + strerror(errno);
+            Close();
+            return false;
+        }
+        received += static_cast<size_t>(result);
+    }
+    return true;
+}
+
+#else // the client needs Unix domain sockets
+
+bool IpcClient::Connect(const string& path, string& error) {
+    error = "the client is only supported on Linux";
+    return false;
+}
+
+bool IpcClient::Send(const vector<Argument>& arguments,
+                     Controller::BatchMode mode,
+                     vector<Response>& responses, string& error) {
+    error = "not connected";
+    return false;
+}
+
+void IpcClient::Close() {}
+
+#endif
@@ -0,0 +1,67 @@
+// [file name] : ipcclient.hpp
+// [function] : declare the IpcClient class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init IpcClient class
+// reason: to send arguments to the server from another process
+// -----------------------------------------------------------
+
+#ifndef IPCCLIENT_HPP
+#define IPCCLIENT_HPP
+
+#include <string>
+#include <vector>
+#include "../Controller/controller.hpp"
+#include "../Message/argument.hpp"
+#include "../Message/response.hpp"
+
+using namespace std;
+
+// notes on the class IpcClient
+// -----------------------------------------------------------
+// [class name] : IpcClient
+// [function] : send batches of arguments to an IpcServer
+// [notes on interface] :
+// 1. Connect opens the socket of the server, Send sends one batch and
+//    waits for its responses, as HandleArguments of the controller does
+// 2. the values of the responses are the rows formatted by the server,
+//    held in a StringsPayload
+// 3. the functions return false with a message if the connection fails
+//    or the reply is malformed, the connection is closed then
+// 4. the client needs Linux, elsewhere Connect fails
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class IpcClient
+{
+public:
+    // constructor, not connected
+    IpcClient();
+    // destructor, close the connection
+    ~IpcClient();
+    // connect to the server listening on a socket
+    bool Connect(const string& path, string& error);
+    // send a batch and wait for the responses
+    bool Send(const vector<Argument>& arguments, Controller::BatchMode mode,
+              vector<Response>& responses, string& error);
+    // close the connection
+    void Close();
+
+private:
+    // no copies, the object owns the socket
+    IpcClient(const IpcClient&) = delete;
+    void operator=(const IpcClient&) = delete;
+    // read exactly size bytes, false on failure
+    bool ReadExactly(char* buffer, size_t size, string& error);
+
+    // private member variables, the socket, -1 if not connected
+    int m_descriptor;
+};
+
+#endif // IPCCLIENT_HPP
@@ -0,0 +1,560 @@
+// [file name] : ipcserver.cpp
+// [function] : implement the IpcServer class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the IpcServer class
+// reason: to let several tools share the model of one process
+// -----------------------------------------------------------
+
+#include "ipcserver.hpp"
+#include "wireprotocol.hpp"
+#include <utility>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+using ResKey = Response::ResponseKey;
+
+// -----------------------------------------------------------
+// [name] : IpcServer
+// [function] : constructor of the IpcServer class
+// [input] : the controller, the path of the socket, the number of
+//           threads for the read-only batches
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+IpcServer::IpcServer(Controller* controller, const string& path,
+                     unsigned int workers)
+    : m_controller(controller), m_path(path), m_workers(workers),
+      m_listenDescriptor(-1), m_epollDescriptor(-1), m_wakeDescriptor(-1),
+      m_ownsPath(false), m_stopping(false), m_nextId(1) {}
+
+#ifdef __linux__
+
+// -----------------------------------------------------------
+// [name] : SystemError
+// [function] : describe the error of a failed system call
+// [input] : the name of the call
+// [output] : the message, e.g. "bind failed: Permission denied"
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static string SystemError(const char* call) {
+    return string(call) + " failed: " + strerror(errno);
+}
+
+// -----------------------------------------------------------
+// [name] : ~IpcServer
+// [function] : destructor of the IpcServer class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+IpcServer::~IpcServer() {
+    // the workers write to the eventfd, stop them first
+    m_readPool.reset();
+    m_writePool.reset();
+    CloseAll();
+}
+
+// -----------------------------------------------------------
+// [name] : Open
+// [function] : create the socket and the epoll instance
+// [input] : the string receiving the message of a failure
+// [output] : false on failure
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool IpcServer::Open(string& error) {
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (m_path.empty() || m_path.size() >= sizeof(address.sun_path)) {
+        error = "the socket path is empty or too long";
+        return false;
+    }
+    memcpy(address.sun_path, m_path.c_str(), m_path.size());
+    sockaddr* name = reinterpret_cast<sockaddr*>(&address);
+
+    // a socket file left by a server that ended is replaced, but not
+    // one a server still listens on or a file of another kind
+    struct stat info;
+    if (lstat(m_path.c_str(), &info) == 0) {
+        if (!S_ISSOCK(info.st_mode)) {
+            error = m_path + " exists and is not a socket";
+            return false;
+        }
+        int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        bool listening = probe >= 0 &&
+                         connect(probe, name, sizeof(address)) == 0;
+        if (probe >= 0) {
+            close(probe);
+        }
+        if (listening) {
+            error = "a server already listens on " + m_path;
+            return false;
+        }
+        unlink(m_path.c_str());
+    }
+
+    m_listenDescriptor = socket(AF_UNIX,
+                                SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (m_listenDescriptor < 0) {
+        error = SystemError("socket");
+        return false;
+    }
+    if (bind(m_listenDescriptor, name, sizeof(address)) != 0) {
+        error = SystemError("bind");
+        CloseAll();
+        return false;
+    }
+    m_ownsPath = true;
+    // nobody can connect before listen, so the mode is set in time
+    if (chmod(m_path.c_str(), S_IRUSR | S_IWUSR) != 0 ||
+        listen(m_listenDescriptor, SOMAXCONN) != 0) {
+        error = SystemError("listen");
+        CloseAll();
+        return false;
+    }
+    m_epollDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    m_wakeDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_epollDescriptor < 0 || m_wakeDescriptor < 0) {
+        error = SystemError("epoll_create1 or eventfd");
+        CloseAll();
+        return false;
+    }
+    for (int descriptor : {m_listenDescriptor, m_wakeDescriptor}) {
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.fd = descriptor;
+        if (epoll_ctl(m_epollDescriptor, EPOLL_CTL_ADD, descriptor,
+                      &event) != 0) {
+            error = SystemError("epoll_ctl");
+            CloseAll();
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Run
+// [function] : serve the clients until Stop is called
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::Run() {
+    if (m_epollDescriptor < 0) {
+        return;
+    }
+    m_readPool.reset(new WorkerPool(m_workers));
+    m_writePool.reset(new WorkerPool(1));
+    const int MAX_EVENTS = 64;
+    epoll_event events[MAX_EVENTS];
+    while (!m_stopping.load()) {
+        int count = epoll_wait(m_epollDescriptor, events, MAX_EVENTS, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        for (int i = 0; i < count; i++) {
+            int descriptor = events[i].data.fd;
+            uint32_t flags = events[i].events;
+            if (descriptor == m_listenDescriptor) {
+                AcceptConnections();
+            }
+            else if (descriptor == m_wakeDescriptor) {
+                // the replies are delivered after the loop
+                uint64_t value;
+                if (read(m_wakeDescriptor, &value, sizeof(value)) < 0) {
+                    continue;
+                }
+            }
+            else {
+                if (flags & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    ReadConnection(descriptor);
+                }
+                if ((flags & EPOLLOUT) && m_connections.count(descriptor)) {
+                    WriteConnection(descriptor);
+                }
+            }
+        }
+        DeliverCompletions();
+    }
+    // wait for the running batches, the queued ones are dropped
+    m_readPool.reset();
+    m_writePool.reset();
+    while (!m_connections.empty()) {
+        CloseConnection(m_connections.begin()->first);
+    }
+    m_completions.clear();
+}
+
+// -----------------------------------------------------------
+// [name] : Stop
+// [function] : ask Run to return, safe in a signal handler
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::Stop() {
+    m_stopping.store(true);
+    if (m_wakeDescriptor >= 0) {
+        uint64_t one = 1;
+        if (write(m_wakeDescriptor, &one, sizeof(one)) < 0) {
+            return;
+        }
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : AcceptConnections
+// [function] : accept all waiting clients
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::AcceptConnections() {
+    while (true) {
+        int descriptor = accept4(m_listenDescriptor, nullptr, nullptr,
+                                 SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (descriptor < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        Connection& connection = m_connections[descriptor];
+        connection.Id = m_nextId++;
+        connection.OutputSent = 0;
+        connection.Busy = false;
+        connection.Closing = false;
+        connection.Events = 0;
+        if (!WatchConnection(descriptor)) {
+            CloseConnection(descriptor);
+        }
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : ReadConnection
+// [function] : read all bytes received by a client
+// [input] : the descriptor of the client
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::ReadConnection(int descriptor) {
+    auto it = m_connections.find(descriptor);
+    if (it == m_connections.end()) {
+        return;
+    }
+    Connection& connection = it->second;
+    char buffer[65536];
+    while (true) {
+        ssize_t received = recv(descriptor, buffer, sizeof(buffer), 0);
+        if (received > 0) {
+            connection.Input.append(buffer, static_cast<size_t>(received));
+            continue;
+        }
+        if (received == 0) {
+            // the client sent everything, answer what it asked for
+            connection.Closing = true;
+            break;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        }
+        CloseConnection(descriptor);
+        return;
+    }
+    ProcessConnection(descriptor);
+}
+
+// -----------------------------------------------------------
+// [name] : WriteConnection
+// [function] : send the waiting bytes of a client
+// [input] : the descriptor of the client
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::WriteConnection(int descriptor) {
+    auto it = m_connections.find(descriptor);
+    if (it == m_connections.end()) {
+        return;
+    }
+    Connection& connection = it->second;
+    while (connection.OutputSent < connection.Output.size()) {
+        ssize_t sent = send(descriptor,
+                            connection.Output.data() + connection.OutputSent,
+                            connection.Output.size() - connection.OutputSent,
+                            MSG_NOSIGNAL);
+        if (sent >= 0) {
+            connection.OutputSent += static_cast<size_t>(sent);
+            continue;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        }
+        CloseConnection(descriptor);
+        return;
+    }
+    if (connection.OutputSent == connection.Output.size()) {
+        connection.Output.clear();
+        connection.OutputSent = 0;
+    }
+    ProcessConnection(descriptor);
+}
+
+// -----------------------------------------------------------
+// [name] : ProcessConnection
+// [function] : start the next complete request of a client, close the
+//              connection if it is finished, update the watched events
+// [input] : the descriptor of the client
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::ProcessConnection(int descriptor) {
+    auto it = m_connections.find(descriptor);
+    if (it == m_connections.end()) {
+        return;
+    }
+    Connection& connection = it->second;
+    const size_t header = WireProtocol::HEADER_SIZE;
+    while (!connection.Busy && connection.Input.size() >= header) {
+        uint32_t size = WireProtocol::ReadBodySize(connection.Input.data());
+        if (size > WireProtocol::MAX_REQUEST_SIZE) {
+            CloseConnection(descriptor);
+            return;
+        }
+        if (connection.Input.size() < header + size) {
+            break;
+        }
+        vector<Argument> arguments;
+        bool continueOnError = false;
+        bool valid = WireProtocol::DecodeRequest(
+            connection.Input.data() + header, size, arguments,
+            continueOnError);
+        connection.Input.erase(0, header + size);
+        if (!valid) {
+            // the frame is skipped, the next one can still be read
+            WireProtocol::EncodeResponses(
+                {Response(ResKey::INVALID_INPUT, {})}, connection.Output);
+            continue;
+        }
+        Controller::BatchMode mode =
+            continueOnError ? Controller::BatchMode::CONTINUE_ON_ERROR
+                            : Controller::BatchMode::STOP_ON_ERROR;
+        // queries share the model, the other batches wait for each other
+        WorkerPool& pool = Controller::IsReadOnly(arguments)
+                               ? *m_readPool : *m_writePool;
+        Controller* controller = m_controller;
+        uint64_t id = connection.Id;
+        pool.Post([this, controller, descriptor, id, mode,
+                   arguments = move(arguments)]() {
+            vector<Response> responses =
+                controller->HandleArguments(arguments, mode);
+            // the values are formatted on the worker thread
+            string frame;
+            if (!WireProtocol::EncodeResponses(responses, frame)) {
+                WireProtocol::EncodeResponses(
+                    {Response(ResKey::UNKNOWN_RUN_TIME_ERROR, {})}, frame);
+            }
+            Complete(descriptor, id, move(frame));
+        });
+        connection.Busy = true;
+    }
+    if (connection.Closing && !connection.Busy &&
+        connection.OutputSent == connection.Output.size()) {
+        CloseConnection(descriptor);
+        return;
+    }
+    if (!WatchConnection(descriptor)) {
+        CloseConnection(descriptor);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : DeliverCompletions
+// [function] : add the replies of the worker threads to their clients
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::DeliverCompletions() {
+    vector<Completion> completions;
+    {
+        lock_guard<mutex> lock(m_completionMutex);
+        completions.swap(m_completions);
+    }
+    for (Completion& completion : completions) {
+        auto it = m_connections.find(completion.Descriptor);
+        // the client may be gone, its descriptor reused by another one
+        if (it == m_connections.end() || it->second.Id != completion.Id) {
+            continue;
+        }
+        it->second.Output += completion.Frame;
+        it->second.Busy = false;
+        WriteConnection(completion.Descriptor);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : CloseConnection
+// [function] : forget a client and close its socket
+// [input] : the descriptor of the client
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::CloseConnection(int descriptor) {
+    auto it = m_connections.find(descriptor);
+    if (it == m_connections.end()) {
+        return;
+    }
+    if (it->second.Events != 0) {
+        epoll_ctl(m_epollDescriptor, EPOLL_CTL_DEL, descriptor, nullptr);
+    }
+    close(descriptor);
+    m_connections.erase(it);
+}
+
+// -----------------------------------------------------------
+// [name] : WatchConnection
+// [function] : watch the events a client is waiting for
+// [input] : the descriptor of the client
+// [output] : false if epoll failed
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool IpcServer::WatchConnection(int descriptor) {
+    Connection& connection = m_connections[descriptor];
+    // no reading while a request runs, so a client cannot queue up
+    // requests without bounds. a socket that is not watched at all is
+    // removed, epoll would keep reporting its hang-up
+    uint32_t events = 0;
+    if (!connection.Busy && !connection.Closing) {
+        events |= EPOLLIN;
+    }
+    if (connection.OutputSent < connection.Output.size()) {
+        events |= EPOLLOUT;
+    }
+    if (events == connection.Events) {
+        return true;
+    }
+    int result = 0;
+    if (events == 0) {
+        result = epoll_ctl(m_epollDescriptor, EPOLL_CTL_DEL, descriptor,
+                           nullptr);
+    }
+    else {
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = events;
+        event.data.fd = descriptor;
+        result = epoll_ctl(m_epollDescriptor,
+                           connection.Events == 0 ? EPOLL_CTL_ADD
+                                                  : EPOLL_CTL_MOD,
+                           descriptor, &event);
+    }
+    if (result != 0) {
+        return false;
+    }
+    connection.Events = events;
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Complete
+// [function] : queue a reply for the event loop and wake it up
+// [input] : the descriptor and the number of the client, the frame
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::Complete(int descriptor, uint64_t id, string frame) {
+    {
+        lock_guard<mutex> lock(m_completionMutex);
+        m_completions.push_back(Completion{descriptor, id, move(frame)});
+    }
+    uint64_t one = 1;
+    if (write(m_wakeDescriptor, &one, sizeof(one)) < 0) {
+        return;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : CloseAll
+// [function] : close every descriptor and remove the socket file
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void IpcServer::CloseAll() {
+    for (auto& entry : m_connections) {
+        close(entry.first);
+    }
+    m_connections.clear();
+    for (int* descriptor : {&m_listenDescriptor, &m_epollDescriptor,
+                            &m_wakeDescriptor}) {
+        if (*descriptor >= 0) {
+            close(*descriptor);
+            *descriptor = -1;
+        }
+    }
+    if (m_ownsPath) {
+        unlink(m_path.c_str());
+        m_ownsPath = false;
+    }
+}
+
+#else // the server needs epoll and Unix domain sockets
+
+IpcServer::~IpcServer() {}
+
+bool IpcServer::Open(string& error) {
+    error = "the server is only supported on Linux";
+    return false;
+}
+
+void IpcServer::Run() {}
+
+void IpcServer::Stop() {
+    m_stopping.store(true);
+}
+
+#endif
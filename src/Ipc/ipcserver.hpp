@@ -0,0 +1,144 @@
+// [file name] : ipcserver.hpp
+// [function] : declare the IpcServer class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init IpcServer class
+// reason: several tools on the same host each imported the same model,
+//         the server lets them share the model of one process
+// -----------------------------------------------------------
+
+#ifndef IPCSERVER_HPP
+#define IPCSERVER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../Controller/controller.hpp"
+#include "workerpool.hpp"
+
+using namespace std;
+
+// notes on the class IpcServer
+// -----------------------------------------------------------
+// [class name] : IpcServer
+// [function] : serve the controller to the clients of a Unix domain
+//              socket
+// [notes on interface] :
+// 1. Open creates the socket, Run serves the clients until Stop is
+//    called. the socket file is removed when the server is destroyed
+// 2. a client sends requests and gets one reply per request, in the
+//    frames of WireProtocol. a request is a batch of arguments, the
+//    reply holds the responses of HandleArguments
+// 3. one thread waits for all sockets with epoll and only reads and
+//    writes frames. the batches that only read the model run on a pool
+//    of worker threads, at the same time, the other batches run one
+//    after another on a thread of their own
+// 4. the requests of one client are answered in order, the next request
+//    of a client is started after the reply to the previous one. a
+//    malformed request is answered with INVALID_INPUT, a request larger
+//    than WireProtocol::MAX_REQUEST_SIZE closes the connection
+// 5. Stop can be called from any thread and from a signal handler
+// 6. the socket file is created with mode 0600, so only the user running
+//    the server can connect. relative paths of import and export are
+//    taken relative to the working directory of the server
+// 7. the server needs Linux, elsewhere Open fails
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class IpcServer
+{
+public:
+    // constructor, the controller to serve, the path of the socket and
+    // the number of threads for the read-only batches
+    IpcServer(Controller* controller, const string& path,
+              unsigned int workers);
+    // destructor, close the sockets and remove the socket file
+    ~IpcServer();
+    // create and bind the socket, false with a message on failure
+    bool Open(string& error);
+    // serve the clients until Stop is called
+    void Run();
+    // ask Run to return
+    void Stop();
+
+private:
+    // a connected client
+    struct Connection {
+        // number of the connection, the descriptors are reused
+        uint64_t Id;
+        // bytes received and not yet decoded
+        string Input;
+        // bytes of the replies not yet sent, from OutputSent on
+        string Output;
+        size_t OutputSent;
+        // a request of the client is executed
+        bool Busy;
+        // the client closed its side, the connection is closed after
+        // the last reply
+        bool Closing;
+        // events watched by epoll, 0 if the socket is not watched
+        uint32_t Events;
+    };
+    // a reply made by a worker thread
+    struct Completion {
+        int Descriptor;
+        uint64_t Id;
+        string Frame;
+    };
+    // no copies, the threads refer to the server
+    IpcServer(const IpcServer&) = delete;
+    void operator=(const IpcServer&) = delete;
+    // accept all waiting clients
+    void AcceptConnections();
+    // read all bytes received by a client
+    void ReadConnection(int descriptor);
+    // send the waiting bytes of a client
+    void WriteConnection(int descriptor);
+    // start the next complete request of a client, close a finished
+    // connection and update the events watched for it
+    void ProcessConnection(int descriptor);
+    // add the replies of the worker threads to their clients
+    void DeliverCompletions();
+    // forget a client and close its socket
+    void CloseConnection(int descriptor);
+    // watch the events a client is waiting for, false on failure
+    bool WatchConnection(int descriptor);
+    // queue a reply for the event loop, called by the worker threads
+    void Complete(int descriptor, uint64_t id, string frame);
+    // close every descriptor of the server
+    void CloseAll();
+
+    // private member variables
+    Controller* m_controller;
+    string m_path;
+    unsigned int m_workers;
+    // descriptors of the listening socket, the epoll instance and the
+    // eventfd waking up the event loop, -1 if not open
+    int m_listenDescriptor;
+    int m_epollDescriptor;
+    int m_wakeDescriptor;
+    // the socket file was created by the server
+    bool m_ownsPath;
+    atomic<bool> m_stopping;
+    // the clients by descriptor, only used by the event loop
+    unordered_map<int, Connection> m_connections;
+    uint64_t m_nextId;
+    // the replies made by the worker threads
+    mutex m_completionMutex;
+    vector<Completion> m_completions;
+    // pools for the read-only batches and for the other batches
+    unique_ptr<WorkerPool> m_readPool;
+    unique_ptr<WorkerPool> m_writePool;
+};
+
+#endif // IPCSERVER_HPP
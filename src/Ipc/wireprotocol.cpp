@@ -0,0 +1,329 @@
+// [file name] : wireprotocol.cpp
+// [function] : implement the WireProtocol class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the WireProtocol class
+// reason: to send arguments and responses over a Unix domain socket
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: take the last response key from the COUNT end marker
+// reason: the check had to be changed for every new response key
+// -----------------------------------------------------------
+
+#include "wireprotocol.hpp"
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+using namespace std;
+
+using ArgKey = Argument::ArgumentKey;
+using ResKey = Response::ResponseKey;
+
+const uint8_t WireProtocol::VERSION = 1;
+const size_t WireProtocol::HEADER_SIZE = 4;
+const uint32_t WireProtocol::MAX_REQUEST_SIZE = 16u << 20;
+
+// the last keys of the enum classes, a larger key is rejected
+static const ArgKey LAST_ARGUMENT_KEY = ArgKey::UNKNOWN;
+static const ResKey LAST_RESPONSE_KEY = static_cast<ResKey>(
+    static_cast<int>(ResKey::COUNT) - 1);
+// bit of the flags of a request
+static const uint8_t CONTINUE_ON_ERROR_FLAG = 1;
+
+// -----------------------------------------------------------
+// [name] : PutU8, PutU16, PutU32, PutU64
+// [function] : append a little-endian number to a buffer
+// [input] : the buffer, the number
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void PutU8(string& buffer, uint8_t value) {
+    buffer += static_cast<char>(value);
+}
+
+static void PutU16(string& buffer, uint16_t value) {
+    buffer += static_cast<char>(value & 0xFF);
+    buffer += static_cast<char>(value >> 8);
+}
+
+static void PutU32(string& buffer, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        buffer += static_cast<char>((value >> shift) & 0xFF);
+    }
+}
+
+static void PutU64(string& buffer, uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) {
+        buffer += static_cast<char>((value >> shift) & 0xFF);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : SetU32
+// [function] : overwrite a little-endian u32 written before
+// [input] : the buffer, the position of the number, the number
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void SetU32(string& buffer, size_t position, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        buffer[position + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : PutString
+// [function] : append a string with its size to a buffer
+// [input] : the buffer, the string
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void PutString(string& buffer, const string& text) {
+    PutU32(buffer, static_cast<uint32_t>(text.size()));
+    buffer += text;
+}
+
+// notes on the class WireReader
+// -----------------------------------------------------------
+// [class name] : WireReader
+// [function] : read the numbers and strings of a body in order
+// [notes on interface] :
+// 1. reading past the end of the body returns 0 or an empty string and
+//    clears IsOk, so a decoder checks IsOk once at the end
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+class WireReader
+{
+public:
+    // constructor, the body and its size
+    WireReader(const char* data, size_t size)
+        : m_data(reinterpret_cast<const unsigned char*>(data)),
+          m_size(size), m_position(0), m_ok(true) {}
+    // read a little-endian number of the given number of bytes
+    uint64_t Number(size_t bytes) {
+        if (!Has(bytes)) {
+            return 0;
+        }
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; i++) {
+            value |= static_cast<uint64_t>(m_data[m_position + i]) << (8 * i);
+        }
+        m_position += bytes;
+        return value;
+    }
+    // read a string with its size
+    string String() {
+        uint64_t size = Number(4);
+        if (!Has(size)) {
+            return string();
+        }
+        string text(reinterpret_cast<const char*>(m_data) + m_position,
+                    size);
+        m_position += size;
+        return text;
+    }
+    // check if a count of items of at least minimum bytes each can be
+    // in the rest of the body, so a bad count does not allocate
+    bool CanHold(uint64_t count, size_t minimum) {
+        if (count > (m_size - m_position) / minimum) {
+            m_ok = false;
+        }
+        return m_ok;
+    }
+    // check if nothing failed so far
+    bool IsOk() const { return m_ok; }
+    // check if the whole body was read
+    bool AtEnd() const { return m_position == m_size; }
+
+private:
+    // check if the rest of the body has the given number of bytes
+    bool Has(uint64_t bytes) {
+        if (!m_ok || bytes > m_size - m_position) {
+            m_ok = false;
+        }
+        return m_ok;
+    }
+
+    // private member variables, the body and the read position
+    const unsigned char* m_data;
+    size_t m_size;
+    size_t m_position;
+    bool m_ok;
+};
+
+// -----------------------------------------------------------
+// [name] : ReadBodySize
+// [function] : read the size of the body from a frame header
+// [input] : the header, HEADER_SIZE bytes
+// [output] : the size of the body
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint32_t WireProtocol::ReadBodySize(const char* header) {
+    WireReader reader(header, HEADER_SIZE);
+    return static_cast<uint32_t>(reader.Number(4));
+}
+
+// -----------------------------------------------------------
+// [name] : EncodeRequest
+// [function] : append the frame of a request to a buffer
+// [input] : the arguments, whether to continue after a failed argument,
+//           the buffer
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void WireProtocol::EncodeRequest(const vector<Argument>& arguments,
+                                 bool continueOnError, string& frame) {
+    size_t header = frame.size();
+    PutU32(frame, 0);
+    PutU8(frame, VERSION);
+    PutU8(frame, continueOnError ? CONTINUE_ON_ERROR_FLAG : 0);
+    PutU32(frame, static_cast<uint32_t>(arguments.size()));
+    for (const Argument& argument : arguments) {
+        PutU16(frame, static_cast<uint16_t>(argument.GetKey()));
+        vector<string> values = argument.GetValues();
+        PutU32(frame, static_cast<uint32_t>(values.size()));
+        for (const string& value : values) {
+            PutString(frame, value);
+        }
+    }
+    SetU32(frame, header,
+           static_cast<uint32_t>(frame.size() - header - HEADER_SIZE));
+}
+
+// -----------------------------------------------------------
+// [name] : DecodeRequest
+// [function] : decode the body of a request
+// [input] : the body and its size, the vector receiving the arguments,
+//           the flag receiving whether to continue after a failure
+// [output] : false if the body is malformed
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool WireProtocol::DecodeRequest(const char* body, size_t size,
+                                 vector<Argument>& arguments,
+                                 bool& continueOnError) {
+    WireReader reader(body, size);
+    if (reader.Number(1) != VERSION) {
+        return false;
+    }
+    uint8_t flags = static_cast<uint8_t>(reader.Number(1));
+    uint64_t count = reader.Number(4);
+    // an argument has at least its key and its number of values
+    if (!reader.CanHold(count, 6)) {
+        return false;
+    }
+    arguments.clear();
+    arguments.reserve(count);
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t key = reader.Number(2);
+        uint64_t valueCount = reader.Number(4);
+        if (key > static_cast<uint64_t>(LAST_ARGUMENT_KEY) ||
+            !reader.CanHold(valueCount, 4)) {
+            return false;
+        }
+        vector<string> values;
+        values.reserve(valueCount);
+        for (uint64_t j = 0; j < valueCount; j++) {
+            values.push_back(reader.String());
+        }
+        arguments.push_back(Argument(static_cast<ArgKey>(key),
+                                     move(values)));
+    }
+    continueOnError = (flags & CONTINUE_ON_ERROR_FLAG) != 0;
+    return reader.IsOk() && reader.AtEnd();
+}
+
+// -----------------------------------------------------------
+// [name] : EncodeResponses
+// [function] : append the frame of a reply to a buffer
+// [input] : the responses, the buffer
+// [output] : false if the reply is too large for a frame, the buffer
+//            is left as it was
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool WireProtocol::EncodeResponses(const vector<Response>& responses,
+                                   string& frame) {
+    size_t header = frame.size();
+    PutU32(frame, 0);
+    PutU8(frame, VERSION);
+    PutU32(frame, static_cast<uint32_t>(responses.size()));
+    for (const Response& response : responses) {
+        PutU16(frame, static_cast<uint16_t>(response.GetKey()));
+        PutU64(frame, response.GetFirstIndex());
+        size_t count = response.GetValueCount();
+        PutU32(frame, static_cast<uint32_t>(count));
+        for (size_t i = 0; i < count; i++) {
+            // format the value in place, then write its size before it
+            size_t position = frame.size();
+            PutU32(frame, 0);
+            response.AppendValue(i, frame);
+            SetU32(frame, position, static_cast<uint32_t>(
+                       frame.size() - position - 4));
+        }
+        if (frame.size() - header - HEADER_SIZE > UINT32_MAX) {
+            frame.resize(header);
+            return false;
+        }
+    }
+    SetU32(frame, header,
+           static_cast<uint32_t>(frame.size() - header - HEADER_SIZE));
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : DecodeResponses
+// [function] : decode the body of a reply
+// [input] : the body and its size, the vector receiving the responses
+// [output] : false if the body is malformed
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool WireProtocol::DecodeResponses(const char* body, size_t size,
+                                   vector<Response>& responses) {
+    WireReader reader(body, size);
+    if (reader.Number(1) != VERSION) {
+        return false;
+    }
+    uint64_t count = reader.Number(4);
+    // a response has at least its key, its first index and its count
+    if (!reader.CanHold(count, 14)) {
+        return false;
+    }
+    responses.clear();
+    responses.reserve(count);
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t key = reader.Number(2);
+        uint64_t firstIndex = reader.Number(8);
+        uint64_t valueCount = reader.Number(4);
+        if (key > static_cast<uint64_t>(LAST_RESPONSE_KEY) ||
+            !reader.CanHold(valueCount, 4)) {
+            return false;
+        }
+        if (valueCount == 0 && firstIndex == 0) {
+            responses.push_back(Response(static_cast<ResKey>(key), {}));
+            continue;
+        }
+        vector<string> rows;
+        rows.reserve(valueCount);
+        for (uint64_t j = 0; j < valueCount; j++) {
+            rows.push_back(reader.String());
+        }
+        responses.push_back(Response(static_cast<ResKey>(key),
+            make_shared<StringsPayload>(move(rows), firstIndex)));
+    }
+    return reader.IsOk() && reader.AtEnd();
+}
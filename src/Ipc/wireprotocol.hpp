@@ -0,0 +1,88 @@
+// [file name] : wireprotocol.hpp
+// [function] : declare the WireProtocol class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init WireProtocol class
+// reason: to send arguments and responses between the server and its
+//         clients over a Unix domain socket
+// -----------------------------------------------------------
+
+#ifndef WIREPROTOCOL_HPP
+#define WIREPROTOCOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../Message/argument.hpp"
+#include "../Message/response.hpp"
+
+using namespace std;
+
+// notes on the class WireProtocol
+// -----------------------------------------------------------
+// [class name] : WireProtocol
+// [function] : encode and decode the frames of the server
+// [notes on interface] :
+// 1. a frame is the size of its body as a 4 byte little-endian number,
+//    followed by the body. every number of the body is little-endian,
+//    a string is its size as a u32 followed by its bytes
+// 2. the body of a request is
+//        u8 version, u8 flags, u32 number of arguments,
+//        per argument: u16 key, u32 number of values, the values
+//    bit 0 of the flags asks to continue after a failed argument
+// 3. the body of a reply is
+//        u8 version, u32 number of responses,
+//        per response: u16 key, u64 first index, u32 number of values,
+//        the values
+//    the values are the formatted rows, the first index is the index of
+//    the first row in the model for a page of faces or lines
+// 4. the decoders check every size against the rest of the body and
+//    every key against its enum class, they return false for a body that
+//    is cut, too long, of another version or holds an unknown key
+// 5. a request larger than MAX_REQUEST_SIZE is rejected by the server,
+//    a reply larger than 4 GiB cannot be encoded, a large model should
+//    be listed in pages
+// 6. all functions are static, the class cannot be instantiated
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class WireProtocol
+{
+public:
+    // version written into every body
+    static const uint8_t VERSION;
+    // size of the frame header holding the size of the body
+    static const size_t HEADER_SIZE;
+    // largest body of a request the server accepts
+    static const uint32_t MAX_REQUEST_SIZE;
+    // read the size of the body from a frame header of HEADER_SIZE bytes
+    static uint32_t ReadBodySize(const char* header);
+    // append the frame of a request to a buffer
+    static void EncodeRequest(const vector<Argument>& arguments,
+                              bool continueOnError, string& frame);
+    // decode the body of a request, false if it is malformed
+    static bool DecodeRequest(const char* body, size_t size,
+                              vector<Argument>& arguments,
+                              bool& continueOnError);
+    // append the frame of a reply to a buffer, the values are formatted
+    // directly into it. false if the reply is too large for a frame
+    static bool EncodeResponses(const vector<Response>& responses,
+                                string& frame);
+    // decode the body of a reply, false if it is malformed
+    // the values are kept in a StringsPayload
+    static bool DecodeResponses(const char* body, size_t size,
+                                vector<Response>& responses);
+
+private:
+    // static class, no instance
+    WireProtocol() = delete;
+};
+
+#endif // WIREPROTOCOL_HPP
@@ -0,0 +1,109 @@
+// [file name] : workerpool.cpp
+// [function] : implement the WorkerPool class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the WorkerPool class
+// reason: to execute the requests of the server off its event loop
+// -----------------------------------------------------------
+
+#include "workerpool.hpp"
+#include <utility>
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : WorkerPool
+// [function] : constructor of the WorkerPool class
+// [input] : the number of threads, 0 is taken as 1
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+WorkerPool::WorkerPool(unsigned int threads) : m_stopping(false) {
+    if (threads == 0) {
+        threads = 1;
+    }
+    m_threads.reserve(threads);
+    for (unsigned int i = 0; i < threads; i++) {
+        m_threads.push_back(thread(&WorkerPool::WorkerLoop, this));
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : ~WorkerPool
+// [function] : destructor of the WorkerPool class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+WorkerPool::~WorkerPool() {
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+        m_queue.clear();
+    }
+    m_condition.notify_all();
+    for (thread& worker : m_threads) {
+        worker.join();
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Post
+// [function] : queue a task
+// [input] : the task
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void WorkerPool::Post(Task task) {
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queue.push_back(move(task));
+    }
+    m_condition.notify_one();
+}
+
+// -----------------------------------------------------------
+// [name] : GetThreadCount
+// [function] : get the number of threads
+// [input] : none
+// [output] : the number of threads
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+unsigned int WorkerPool::GetThreadCount() const {
+    return static_cast<unsigned int>(m_threads.size());
+}
+
+// -----------------------------------------------------------
+// [name] : WorkerLoop
+// [function] : run the queued tasks until the pool is destroyed
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void WorkerPool::WorkerLoop() {
+    while (true) {
+        Task task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() {
+                return m_stopping || !m_queue.empty();
+            });
+            if (m_stopping) {
+                return;
+            }
+            task = move(m_queue.front());
+            m_queue.pop_front();
+        }
+        task();
+    }
+}
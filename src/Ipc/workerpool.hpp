@@ -0,0 +1,71 @@
+// [file name] : workerpool.hpp
+// [function] : declare the WorkerPool class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init WorkerPool class
+// reason: to execute the requests of the server off its event loop
+// -----------------------------------------------------------
+
+#ifndef WORKERPOOL_HPP
+#define WORKERPOOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// notes on the class WorkerPool
+// -----------------------------------------------------------
+// [class name] : WorkerPool
+// [function] : run tasks on a fixed number of threads
+// [notes on interface] :
+// 1. the threads are started by the constructor, at least one
+// 2. Post queues a task, the tasks are started in the order they were
+//    posted, several of them run at once if there are several threads
+// 3. a task must not throw, an escaping exception ends the program
+// 4. the destructor drops the tasks that did not start and waits for
+//    the running ones
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class WorkerPool
+{
+public:
+    // a task of the pool
+    using Task = function<void()>;
+    // constructor, start the threads
+    explicit WorkerPool(unsigned int threads);
+    // destructor, drop the queued tasks and stop the threads
+    ~WorkerPool();
+    // queue a task
+    void Post(Task task);
+    // number of threads
+    unsigned int GetThreadCount() const;
+
+private:
+    // no copies, the threads refer to the pool
+    WorkerPool(const WorkerPool&) = delete;
+    void operator=(const WorkerPool&) = delete;
+    // body of the threads
+    void WorkerLoop();
+
+    // private member variables
+    // the mutex guards the queue and the stop flag
+    mutex m_mutex;
+    condition_variable m_condition;
+    deque<Task> m_queue;
+    bool m_stopping;
+    vector<thread> m_threads;
+};
+
+#endif // WORKERPOOL_HPP
@@ -10,6 +10,12 @@
 // edit: add implementation of the Argument class
 // reason: to support storing the arguments passed 
 //         from the viewer to the controller
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add KeyName function
+// reason: to name the commands in the metrics
+// -----------------------------------------------------------
 
 
 #include "argument.hpp"
@@ -57,6 +63,41 @@ vector<string> Argument::GetValues() const
     return valuesCopy;
 }
 
+// -----------------------------------------------------------
+// [name] : KeyName
+// [function] : get the name of an argument key
+// [input] : the argument key
+// [output] : the name of the key, a string literal
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const char* Argument::KeyName(ArgumentKey key)
+{
+    switch (key) {
+        case ArgumentKey::IMPORT_3D_MODEL: return "IMPORT_3D_MODEL";
+        case ArgumentKey::EXPORT_3D_MODEL: return "EXPORT_3D_MODEL";
+        case ArgumentKey::DISPLAY_ALL_FACES: return "DISPLAY_ALL_FACES";
+        case ArgumentKey::DELETE_FACE: return "DELETE_FACE";
+        case ArgumentKey::ADD_FACE: return "ADD_FACE";
+        case ArgumentKey::DISPLAY_FACE_POINTS: return "DISPLAY_FACE_POINTS";
+        case ArgumentKey::MODIFY_FACE_POINT: return "MODIFY_FACE_POINT";
+        case ArgumentKey::DISPLAY_ALL_LINES: return "DISPLAY_ALL_LINES";
+        case ArgumentKey::ADD_LINE: return "ADD_LINE";
+        case ArgumentKey::DELETE_LINE: return "DELETE_LINE";
+        case ArgumentKey::DISPLAY_LINE_POINTS: return "DISPLAY_LINE_POINTS";
+        case ArgumentKey::MODIFY_LINE_POINT: return "MODIFY_LINE_POINT";
+        case ArgumentKey::DISPLAY_STATISTICS: return "DISPLAY_STATISTICS";
+        case ArgumentKey::COUNT_FACES: return "COUNT_FACES";
+        case ArgumentKey::COUNT_LINES: return "COUNT_LINES";
+        case ArgumentKey::DISPLAY_METRICS: return "DISPLAY_METRICS";
+        case ArgumentKey::DISPLAY_MEMORY: return "DISPLAY_MEMORY";
+        case ArgumentKey::FILE_STATISTICS: return "FILE_STATISTICS";
+        case ArgumentKey::DISPLAY_TOPOLOGY: return "DISPLAY_TOPOLOGY";
+        case ArgumentKey::UNKNOWN: return "UNKNOWN";
+    }
+    return "UNKNOWN";
+}
+
 // -----------------------------------------------------------
 // [name] : ~Argument
 // [function] : virtual destructor of the Argument class
@@ -13,6 +13,32 @@
 // reason: to support storing the arguments passed
 //         from the viewer to the controller
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add COUNT_FACES and COUNT_LINES keys
+//       DISPLAY_ALL_FACES and DISPLAY_ALL_LINES take an offset and a limit
+// reason: to list huge models in pages and to count the elements only
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add DISPLAY_METRICS key and KeyName function
+// reason: to report the latency of every command
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add DISPLAY_MEMORY key
+// reason: to report the bytes used by the model
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add FILE_STATISTICS key
+// reason: to get the statistics of a file without importing it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add DISPLAY_TOPOLOGY key
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
 
 #ifndef ARGUMENT_HPP
 #define ARGUMENT_HPP
@@ -32,6 +58,19 @@ using namespace std;
 //    arguments passed
 // 2. there are constant getters to get the key and values
 // 3. the key is an enum class that defines all the possible argument names
+// 4. DISPLAY_ALL_FACES and DISPLAY_ALL_LINES take two optional values,
+//    the index of the first element and the maximum number of elements,
+//    all elements are listed without them
+// 5. DISPLAY_METRICS takes an optional value: none lists the metrics
+//    of the controller, "json" gives them as one JSON row, "reset"
+//    clears them, "on" and "off" turn the sampling on and off
+// 6. KeyName gives the name of a key, e.g. for the metrics
+// 7. DISPLAY_MEMORY takes no values, it lists the bytes used by the
+//    model, the query cache and, if they are counted, the heap
+// 8. FILE_STATISTICS takes the path of an OBJ file, it gives the
+//    statistics of DISPLAY_STATISTICS for the file without importing it
+// 9. DISPLAY_TOPOLOGY takes no values, it counts the vertices and edges
+//    of the faces and the edges that keep them from closing a solid
 // [author] : Huayu Chen
 // [date] : 2024/8/3
 // -----------------------------------------------------------
@@ -64,6 +103,12 @@ public:
         DISPLAY_LINE_POINTS,
         MODIFY_LINE_POINT,
         DISPLAY_STATISTICS,
+        COUNT_FACES,
+        COUNT_LINES,
+        DISPLAY_METRICS,
+        DISPLAY_MEMORY,
+        FILE_STATISTICS,
+        DISPLAY_TOPOLOGY,
         UNKNOWN
     };
     // constructor, argument key: the type of command, 
@@ -75,6 +120,8 @@ public:
     ArgumentKey GetKey() const;
     // getter for the values
     vector<string> GetValues() const;
+    // name of a key
+    static const char* KeyName(ArgumentKey key);
 private:
     // private member variables, key and values
     ArgumentKey m_key;
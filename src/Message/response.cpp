@@ -11,10 +11,52 @@
 // reason: to support storing the response from the controller
 //         to the viewer
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add IsSuccess function
+// reason: to let a batch of arguments stop at the first failed one
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add KeyName function
+// reason: to print the response keys in the script mode
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add typed payloads, GetValueCount, GetValue and GetPayload
+// reason: to format the values only when they are printed
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add AppendValue, GetFirstIndex and the count keys
+// reason: to list huge models in pages and to count the elements only
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the name of the CANCELLED key
+// reason: to report a background command stopped by the user
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the DISPLAY_METRICS key
+// reason: to report the latency of every command
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the DISPLAY_MEMORY key and GetMemoryUsage
+// reason: to report the bytes used by the model and the cached responses
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the DISPLAY_TOPOLOGY key
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
 
 
 #include "response.hpp"
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace std;
@@ -28,7 +70,7 @@ using namespace std;
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 Response::Response(ResponseKey key, vector<string> values) : 
-                m_key(key), m_values(values) {}
+                m_key(key), m_values(move(values)) {}
 
 // -----------------------------------------------------------
 // [name] : GetKey
@@ -54,8 +96,107 @@ Response::ResponseKey Response::GetKey() const
 // -----------------------------------------------------------
 vector<string> Response::GetValues() const
 {
-    vector<string> valuesCopy = m_values;
-    return valuesCopy;
+    if (!m_payload) {
+        vector<string> valuesCopy = m_values;
+        return valuesCopy;
+    }
+    // format every row of the payload
+    vector<string> values;
+    values.reserve(m_payload->Size());
+    for (size_t i = 0; i < m_payload->Size(); i++) {
+        values.push_back(m_payload->Format(i));
+    }
+    return values;
+}
+
+// -----------------------------------------------------------
+// [name] : GetValueCount
+// [function] : get the number of values of the response
+// [input] : none
+// [output] : the number of values, no value is formatted
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t Response::GetValueCount() const
+{
+    return m_payload ? m_payload->Size() : m_values.size();
+}
+
+// -----------------------------------------------------------
+// [name] : GetValue
+// [function] : get one value of the response
+// [input] : the index of the value
+// [output] : the value, formatted from the payload if there is one
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+string Response::GetValue(size_t index) const
+{
+    return m_payload ? m_payload->Format(index) : m_values[index];
+}
+
+// -----------------------------------------------------------
+// [name] : AppendValue
+// [function] : append one value of the response to a buffer
+// [input] : the index of the value, the buffer
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Response::AppendValue(size_t index, string& buffer) const
+{
+    if (m_payload) {
+        m_payload->AppendRow(index, buffer);
+    }
+    else {
+        buffer += m_values[index];
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : GetFirstIndex
+// [function] : get the index in the model of the first value
+// [input] : none
+// [output] : the index, 0 if the values are not a page of a list
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t Response::GetFirstIndex() const
+{
+    return m_payload ? m_payload->FirstIndex() : 0;
+}
+
+// -----------------------------------------------------------
+// [name] : GetPayload
+// [function] : get the typed payload of the response
+// [input] : none
+// [output] : the payload, nullptr if the values are strings
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const ResponsePayload* Response::GetPayload() const
+{
+    return m_payload.get();
+}
+
+// -----------------------------------------------------------
+// [name] : GetMemoryUsage
+// [function] : get the bytes used by the response
+// [input] : none
+// [output] : the bytes of the object, its values and its payload
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t Response::GetMemoryUsage() const
+{
+    size_t bytes = sizeof(Response) + m_values.capacity() * sizeof(string);
+    for (const string& value : m_values) {
+        bytes += ResponsePayload::HeapBytes(value);
+    }
+    if (m_payload) {
+        bytes += m_payload->MemoryUsage();
+    }
+    return bytes;
 }
 
 // -----------------------------------------------------------
@@ -67,3 +208,100 @@ vector<string> Response::GetValues() const
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 Response::~Response() {}
+
+// -----------------------------------------------------------
+// [name] : IsSuccess
+// [function] : check if the response reports a successful operation
+// [input] : none
+// [output] : true for the success and display keys, false for errors
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Response::IsSuccess() const
+{
+    switch (m_key) {
+        case ResponseKey::IMPORT_SUCCESS:
+        case ResponseKey::EXPORT_SUCCESS:
+        case ResponseKey::DELETE_FACE_SUCCESS:
+        case ResponseKey::ADD_FACE_SUCCESS:
+        case ResponseKey::MODIFY_FACE_POINT_SUCCESS:
+        case ResponseKey::DELETE_LINE_SUCCESS:
+        case ResponseKey::ADD_LINE_SUCCESS:
+        case ResponseKey::MODIFY_LINE_POINT_SUCCESS:
+        case ResponseKey::DISPLAY_ALL_FACES:
+        case ResponseKey::DISPLAY_FACE_POINTS:
+        case ResponseKey::DISPLAY_ALL_LINES:
+        case ResponseKey::DISPLAY_LINE_POINTS:
+        case ResponseKey::DISPLAY_STATISTICS:
+        case ResponseKey::DISPLAY_FACE_COUNT:
+        case ResponseKey::DISPLAY_LINE_COUNT:
+        case ResponseKey::DISPLAY_METRICS:
+        case ResponseKey::DISPLAY_MEMORY:
+        case ResponseKey::DISPLAY_TOPOLOGY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : KeyName
+// [function] : get the name of a response key
+// [input] : the response key
+// [output] : the name of the key, a string literal
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const char* Response::KeyName(ResponseKey key)
+{
+    switch (key) {
+        case ResponseKey::EMPTY_PATH: return "EMPTY_PATH";
+        case ResponseKey::NOT_OBJ_PATH: return "NOT_OBJ_PATH";
+        case ResponseKey::NOT_EXIST_PATH: return "NOT_EXIST_PATH";
+        case ResponseKey::IMPORT_SUCCESS: return "IMPORT_SUCCESS";
+        case ResponseKey::EXPORT_SUCCESS: return "EXPORT_SUCCESS";
+        case ResponseKey::DELETE_FACE_SUCCESS: return "DELETE_FACE_SUCCESS";
+        case ResponseKey::ADD_FACE_SUCCESS: return "ADD_FACE_SUCCESS";
+        case ResponseKey::MODIFY_FACE_POINT_SUCCESS: return "MODIFY_FACE_POINT_SUCCESS";
+        case ResponseKey::DELETE_LINE_SUCCESS: return "DELETE_LINE_SUCCESS";
+        case ResponseKey::ADD_LINE_SUCCESS: return "ADD_LINE_SUCCESS";
+        case ResponseKey::MODIFY_LINE_POINT_SUCCESS: return "MODIFY_LINE_POINT_SUCCESS";
+        case ResponseKey::UNKNOWN: return "UNKNOWN";
+        case ResponseKey::EXPORT_FAILED: return "EXPORT_FAILED";
+        case ResponseKey::IMPORT_FAILED: return "IMPORT_FAILED";
+        case ResponseKey::DISPLAY_ALL_FACES: return "DISPLAY_ALL_FACES";
+        case ResponseKey::DISPLAY_FACE_POINTS: return "DISPLAY_FACE_POINTS";
+        case ResponseKey::DISPLAY_ALL_LINES: return "DISPLAY_ALL_LINES";
+        case ResponseKey::DISPLAY_LINE_POINTS: return "DISPLAY_LINE_POINTS";
+        case ResponseKey::DISPLAY_STATISTICS: return "DISPLAY_STATISTICS";
+        case ResponseKey::UNKNOWN_INVALID_ARGUMENT: return "UNKNOWN_INVALID_ARGUMENT";
+        case ResponseKey::UNKNOWN_RUN_TIME_ERROR: return "UNKNOWN_RUN_TIME_ERROR";
+        case ResponseKey::ADD_FACE_FAILED: return "ADD_FACE_FAILED";
+        case ResponseKey::MODIFY_FACE_POINT_FAILED: return "MODIFY_FACE_POINT_FAILED";
+        case ResponseKey::DELETE_FACE_FAILED: return "DELETE_FACE_FAILED";
+        case ResponseKey::ADD_LINE_FAILED: return "ADD_LINE_FAILED";
+        case ResponseKey::MODIFY_LINE_POINT_FAILED: return "MODIFY_LINE_POINT_FAILED";
+        case ResponseKey::DELETE_LINE_FAILED: return "DELETE_LINE_FAILED";
+        case ResponseKey::INDEX_OUT_OF_RANGE: return "INDEX_OUT_OF_RANGE";
+        case ResponseKey::DUPLICATE_FACE: return "DUPLICATE_FACE";
+        case ResponseKey::DUPLICATE_LINE: return "DUPLICATE_LINE";
+        case ResponseKey::NOT_A_FACE: return "NOT_A_FACE";
+        case ResponseKey::NOT_A_LINE: return "NOT_A_LINE";
+        case ResponseKey::INVALID_NUMBER_FORMAT: return "INVALID_NUMBER_FORMAT";
+        case ResponseKey::NOT_A_POINT: return "NOT_A_POINT";
+        case ResponseKey::INPUT_NUMBER_ERROR: return "INPUT_NUMBER_ERROR";
+        case ResponseKey::INVALID_INPUT: return "INVALID_INPUT";
+        case ResponseKey::PARSE_FAILED: return "PARSE_FAILED";
+        case ResponseKey::OPEN_FILE_FAILED: return "OPEN_FILE_FAILED";
+        case ResponseKey::NO_MODEL_TO_EXPORT: return "NO_MODEL_TO_EXPORT";
+        case ResponseKey::NO_3D_MODEL: return "NO_3D_MODEL";
+        case ResponseKey::DISPLAY_FACE_COUNT: return "DISPLAY_FACE_COUNT";
+        case ResponseKey::DISPLAY_LINE_COUNT: return "DISPLAY_LINE_COUNT";
+        case ResponseKey::CANCELLED: return "CANCELLED";
+        case ResponseKey::DISPLAY_METRICS: return "DISPLAY_METRICS";
+        case ResponseKey::DISPLAY_MEMORY: return "DISPLAY_MEMORY";
+        case ResponseKey::DISPLAY_TOPOLOGY: return "DISPLAY_TOPOLOGY";
+        case ResponseKey::COUNT: break;
+    }
+    return "UNKNOWN";
+}
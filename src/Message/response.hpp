@@ -14,12 +14,60 @@
 //         to the viewer and provide a way to access the response
 //         values from the viewer
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add IsSuccess function
+// reason: to let a batch of arguments stop at the first failed one
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add KeyName function
+// reason: to print the response keys in the script mode
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add typed payloads, GetValueCount, GetValue and GetPayload
+// reason: listing a big model allocated a string for every face,
+//         the values are now formatted only when they are printed
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add AppendValue and GetFirstIndex
+//       add DISPLAY_FACE_COUNT and DISPLAY_LINE_COUNT keys
+// reason: to list huge models in pages and to count the elements only
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add CANCELLED key
+// reason: to report a background command stopped by the user
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add DISPLAY_METRICS key and the COUNT end marker
+// reason: to report the latency of every command and to count the
+//         responses of every key
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add DISPLAY_MEMORY key and GetMemoryUsage
+// reason: to report the bytes used by the model and the cached responses
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add DISPLAY_TOPOLOGY key
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
 
 #ifndef RESPONSE_HPP
 #define RESPONSE_HPP
 
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
+#include "responsepayload.hpp"
 
 using namespace std;
 
@@ -33,6 +81,18 @@ using namespace std;
 //    actual values returned for that response
 // 2. the key is an enum class that defines all the possible response names
 // 3. there are constant getters to get the key and values
+// 4. IsSuccess tells if the key is a success or a display key,
+//    every other key reports an error
+// 5. the values can also be given as a typed payload, which is formatted
+//    row by row only when GetValue or GetValues is called. callers that
+//    only print should use GetValueCount and GetValue, GetValues formats
+//    all rows at once. GetPayload gives the typed data, or nullptr if the
+//    values were given as strings
+// 6. AppendValue appends a value to a buffer that the caller reuses.
+//    GetFirstIndex is the index in the model of the first value when
+//    the values are a page of the faces or lines, 0 otherwise
+// 7. GetMemoryUsage is the number of bytes of the response, its values
+//    and its payload, the elements shared with the model are not counted
 // [author] : Huayu Chen
 // [date] : 2024/8/3
 // -----------------------------------------------------------
@@ -50,6 +110,7 @@ public:
     // 2. some error responses are added to handle invalid arguments 
     //    and runtime errors
     // 3. add new response names if the program needs to support more responses
+    //    before COUNT, which is the number of keys and not a response
     // [author] : Huayu Chen
     // [date] : 2024/8/3
     // -----------------------------------------------------------
@@ -94,20 +155,54 @@ public:
         OPEN_FILE_FAILED,
         NO_MODEL_TO_EXPORT,
         NO_3D_MODEL,
+        DISPLAY_FACE_COUNT,
+        DISPLAY_LINE_COUNT,
+        CANCELLED,
+        DISPLAY_METRICS,
+        DISPLAY_MEMORY,
+        DISPLAY_TOPOLOGY,
+        COUNT
     };
     // constructor, response key: the type of response,
     // values: the values returned for that response
     Response(ResponseKey key, vector<string> values);
+    // constructor, response key: the type of response,
+    // payload: the typed values, formatted when they are read
+    // a template, so that Response(key, {}) still means no values
+    template <class Payload>
+    Response(ResponseKey key, shared_ptr<Payload> payload) 
+        : m_key(key), m_payload(move(payload)) {
+        static_assert(is_base_of<ResponsePayload, Payload>::value,
+                      "the payload must derive from ResponsePayload");
+    }
     // virtual destructor
     virtual ~Response();
     // getter for the key
     ResponseKey GetKey() const;
-    // getter for the values
+    // getter for the values, all rows are formatted
     vector<string> GetValues() const;
+    // number of values
+    size_t GetValueCount() const;
+    // one value, the index must be below GetValueCount()
+    string GetValue(size_t index) const;
+    // append one value to a buffer
+    void AppendValue(size_t index, string& buffer) const;
+    // index in the model of the first value
+    size_t GetFirstIndex() const;
+    // getter for the typed payload, nullptr if there is none
+    const ResponsePayload* GetPayload() const;
+    // bytes of the response, its values and its payload
+    size_t GetMemoryUsage() const;
+    // check if the response reports a successful operation
+    bool IsSuccess() const;
+    // get the name of a response key, e.g. "ADD_FACE_SUCCESS"
+    static const char* KeyName(ResponseKey key);
 private:
     // private member variables, key and values
+    // the values are either strings or a payload
     ResponseKey m_key;
     vector<string> m_values;
+    shared_ptr<const ResponsePayload> m_payload;
 };
 
 #endif // RESPONSE_HPP
\ No newline at end of file
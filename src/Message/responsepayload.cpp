@@ -0,0 +1,408 @@
+// [file name] : responsepayload.cpp
+// [function] : implement the typed payloads of the Response class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the payload classes
+// reason: to format the values of a response only when they are printed
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: append the rows to a buffer, add pages of elements
+// reason: to list a part of a huge model without a string per row
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the StringsPayload class
+// reason: to hold the rows received from the server
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add MemoryUsage to every payload
+// reason: to count the bytes of the responses kept by the query cache
+// -----------------------------------------------------------
+
+#include "responsepayload.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : ~ResponsePayload
+// [function] : virtual destructor of the ResponsePayload class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ResponsePayload::~ResponsePayload() {}
+
+// -----------------------------------------------------------
+// [name] : HeapBytes
+// [function] : get the bytes a string allocated on the heap
+// [input] : the string
+// [output] : the capacity and the terminating zero, 0 if the
+//            characters are kept inside the string object
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t ResponsePayload::HeapBytes(const string& text) {
+    const char* object = reinterpret_cast<const char*>(&text);
+    if (text.data() >= object && text.data() < object + sizeof(string)) {
+        return 0;
+    }
+    return text.capacity() + 1;
+}
+
+// -----------------------------------------------------------
+// [name] : Format
+// [function] : convert one row into a string
+// [input] : the index of the row
+// [output] : the row
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+string ResponsePayload::Format(size_t index) const {
+    string row;
+    AppendRow(index, row);
+    return row;
+}
+
+// -----------------------------------------------------------
+// [name] : FirstIndex
+// [function] : get the index of the first row in the whole list
+// [input] : none
+// [output] : 0, a payload holding a page overrides it
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t ResponsePayload::FirstIndex() const {
+    return 0;
+}
+
+// -----------------------------------------------------------
+// [name] : AppendPoint
+// [function] : append a point to a buffer in the form of Point::ToString
+// [input] : the point, the buffer
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void AppendPoint(const Point3D& point, string& buffer) {
+    // "%f" is the format of to_string, which Point::ToString uses
+    char text[3 * 320 + 8];
+    int length = snprintf(text, sizeof(text), "(%f, %f, %f)",
+                          point.X, point.Y, point.Z);
+    if (length < 0 || length >= static_cast<int>(sizeof(text))) {
+        buffer += point.ToString();
+        return;
+    }
+    buffer.append(text, static_cast<size_t>(length));
+}
+
+// -----------------------------------------------------------
+// [name] : ElementsPayload
+// [function] : constructor of the ElementsPayload class
+// [input] : the elements of the model, the index of the first element
+//           of the page and the maximum number of elements
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+ElementsPayload<Element>::ElementsPayload(
+    const vector<shared_ptr<Element>>& elements, size_t offset, size_t limit)
+    : m_firstIndex(min(offset, elements.size())) {
+    // copy the pointers of the page only
+    size_t count = min(limit, elements.size() - m_firstIndex);
+    m_elements.assign(elements.begin() + m_firstIndex,
+                      elements.begin() + m_firstIndex + count);
+}
+
+// -----------------------------------------------------------
+// [name] : Size
+// [function] : get the number of elements
+// [input] : none
+// [output] : the number of elements
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+size_t ElementsPayload<Element>::Size() const {
+    return m_elements.size();
+}
+
+// -----------------------------------------------------------
+// [name] : MemoryUsage
+// [function] : get the bytes owned by the payload
+// [input] : none
+// [output] : the bytes of the object and its pointers, the elements are
+//            shared with the model
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+size_t ElementsPayload<Element>::MemoryUsage() const {
+    return sizeof(*this) + 
+           m_elements.capacity() * sizeof(shared_ptr<Element>);
+}
+
+// -----------------------------------------------------------
+// [name] : AppendRow
+// [function] : append the points of one element to a buffer
+// [input] : the index of the element in the page, the buffer
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+void ElementsPayload<Element>::AppendRow(size_t index,
+                                         string& buffer) const {
+    AppendElement(*m_elements[index], buffer);
+}
+
+// -----------------------------------------------------------
+// [name] : FirstIndex
+// [function] : get the index of the first element of the page
+// [input] : none
+// [output] : the index in the model
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+size_t ElementsPayload<Element>::FirstIndex() const {
+    return m_firstIndex;
+}
+
+// -----------------------------------------------------------
+// [name] : AppendElement
+// [function] : append the points of an element to a buffer
+// [input] : the element, the buffer
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+void ElementsPayload<Element>::AppendElement(const Element& element,
+                                             string& buffer) {
+    for (unsigned int i = 0; i < Element::Size; i++) {
+        AppendPoint(element.At(i), buffer);
+        // add a space between points
+        buffer += ' ';
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : At
+// [function] : get an element by index
+// [input] : the index of the element
+// [output] : a read-only reference to the element
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+const Element& ElementsPayload<Element>::At(size_t index) const {
+    return *m_elements[index];
+}
+
+// explicit instantiations for the elements of the model
+template class ElementsPayload<Face3D>;
+template class ElementsPayload<Line3D>;
+
+// -----------------------------------------------------------
+// [name] : PointsPayload
+// [function] : constructor of the PointsPayload class
+// [input] : the points
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+PointsPayload::PointsPayload(vector<Point3D> points)
+    : m_points(move(points)) {}
+
+// -----------------------------------------------------------
+// [name] : Size
+// [function] : get the number of points
+// [input] : none
+// [output] : the number of points
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t PointsPayload::Size() const {
+    return m_points.size();
+}
+
+// -----------------------------------------------------------
+// [name] : MemoryUsage
+// [function] : get the bytes owned by the payload
+// [input] : none
+// [output] : the bytes of the object and its points
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t PointsPayload::MemoryUsage() const {
+    return sizeof(*this) + m_points.capacity() * sizeof(Point3D);
+}
+
+// -----------------------------------------------------------
+// [name] : AppendRow
+// [function] : append one point to a buffer
+// [input] : the index of the point, the buffer
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void PointsPayload::AppendRow(size_t index, string& buffer) const {
+    AppendPoint(m_points[index], buffer);
+}
+
+// -----------------------------------------------------------
+// [name] : At
+// [function] : get a point by index
+// [input] : the index of the point
+// [output] : a read-only reference to the point
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const Point3D& PointsPayload::At(size_t index) const {
+    return m_points[index];
+}
+
+// -----------------------------------------------------------
+// [name] : NumbersPayload
+// [function] : constructor of the NumbersPayload class
+// [input] : the named numbers
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+NumbersPayload::NumbersPayload(vector<Entry> entries)
+    : m_entries(move(entries)) {}
+
+// -----------------------------------------------------------
+// [name] : Size
+// [function] : get the number of entries
+// [input] : none
+// [output] : the number of entries
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t NumbersPayload::Size() const {
+    return m_entries.size();
+}
+
+// -----------------------------------------------------------
+// [name] : MemoryUsage
+// [function] : get the bytes owned by the payload
+// [input] : none
+// [output] : the bytes of the object and its entries, the names are
+//            string literals
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t NumbersPayload::MemoryUsage() const {
+    return sizeof(*this) + m_entries.capacity() * sizeof(Entry);
+}
+
+// -----------------------------------------------------------
+// [name] : AppendRow
+// [function] : append one named number to a buffer
+// [input] : the index of the entry, the buffer
+// [output] : none, "name: value" is appended
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void NumbersPayload::AppendRow(size_t index, string& buffer) const {
+    const Entry& entry = m_entries[index];
+    buffer += entry.Name;
+    buffer += ": ";
+    if (entry.IsCount) {
+        buffer += to_string(static_cast<unsigned long long>(entry.Value));
+    }
+    else {
+        buffer += to_string(entry.Value);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : At
+// [function] : get an entry by index
+// [input] : the index of the entry
+// [output] : a read-only reference to the entry
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const NumbersPayload::Entry& NumbersPayload::At(size_t index) const {
+    return m_entries[index];
+}
+
+// -----------------------------------------------------------
+// [name] : StringsPayload
+// [function] : constructor of the StringsPayload class
+// [input] : the rows, the index of the first row in the whole list
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+StringsPayload::StringsPayload(vector<string> rows, size_t firstIndex)
+    : m_rows(move(rows)), m_firstIndex(firstIndex) {}
+
+// -----------------------------------------------------------
+// [name] : Size
+// [function] : get the number of rows
+// [input] : none
+// [output] : the number of rows
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t StringsPayload::Size() const {
+    return m_rows.size();
+}
+
+// -----------------------------------------------------------
+// [name] : MemoryUsage
+// [function] : get the bytes owned by the payload
+// [input] : none
+// [output] : the bytes of the object and its rows
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t StringsPayload::MemoryUsage() const {
+    size_t bytes = sizeof(*this) + m_rows.capacity() * sizeof(string);
+    for (const string& row : m_rows) {
+        bytes += HeapBytes(row);
+    }
+    return bytes;
+}
+
+// -----------------------------------------------------------
+// [name] : AppendRow
+// [function] : append one row to a buffer
+// [input] : the index of the row, the buffer
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void StringsPayload::AppendRow(size_t index, string& buffer) const {
+    buffer += m_rows[index];
+}
+
+// -----------------------------------------------------------
+// [name] : FirstIndex
+// [function] : get the index of the first row in the whole list
+// [input] : none
+// [output] : the index given to the constructor
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t StringsPayload::FirstIndex() const {
+    return m_firstIndex;
+}
@@ -0,0 +1,235 @@
+// [file name] : responsepayload.hpp
+// [function] : declare the typed payloads of the Response class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init ResponsePayload class and its derived classes
+//       ElementsPayload, PointsPayload and NumbersPayload
+// reason: the controller formatted every point of every face into strings
+//         for each listing, even if the caller only needed the counts
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add AppendRow and FirstIndex
+//       add a page of elements to ElementsPayload
+// reason: to list a part of a huge model and to format rows into a
+//         reused buffer
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add StringsPayload class
+// reason: to hold the rows of a response received from the server,
+//         which are already formatted
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add MemoryUsage
+// reason: to count the bytes of the responses kept by the query cache
+// -----------------------------------------------------------
+
+#ifndef RESPONSEPAYLOAD_HPP
+#define RESPONSEPAYLOAD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Model/Element3D/point3d.hpp"
+#include "../Model/Element3D/face3d.hpp"
+#include "../Model/Element3D/line3d.hpp"
+
+using namespace std;
+
+// notes for the ResponsePayload class
+// -----------------------------------------------------------
+// [class name] : ResponsePayload
+// [function] : hold the values of a response as typed data
+// [notes on interface] :
+// 1. this is an abstract class, a payload is a list of rows, Size gives
+//    the number of rows and Format converts one row into the string the
+//    viewer prints
+// 2. a row is formatted only when Format is called, so building a payload
+//    does not allocate a string per value
+// 3. a payload is never modified after it is built, so responses can
+//    share it
+// 4. AppendRow appends a row to a buffer, so a caller printing many rows
+//    can reuse one string. Format returns the row as a new string
+// 5. a payload may hold a page of a longer list, FirstIndex is the index
+//    of its first row in the whole list
+// 6. MemoryUsage is the number of bytes the payload owns, data shared
+//    with the model, e.g. the elements, is not counted
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class ResponsePayload
+{
+public:
+    // number of rows of the payload
+    virtual size_t Size() const = 0;
+    // append one row to a buffer, the index must be below Size()
+    virtual void AppendRow(size_t index, string& buffer) const = 0;
+    // convert one row into a string, the index must be below Size()
+    string Format(size_t index) const;
+    // index of the first row in the whole list, 0 if it is not a page
+    virtual size_t FirstIndex() const;
+    // bytes owned by the payload
+    virtual size_t MemoryUsage() const = 0;
+    // bytes a string allocated on the heap, 0 for a short string kept
+    // inside the string object
+    static size_t HeapBytes(const string& text);
+    // virtual destructor
+    virtual ~ResponsePayload();
+};
+
+// notes for the ElementsPayload class
+// -----------------------------------------------------------
+// [class name] : ElementsPayload
+// [function] : hold a list of faces or lines of the model
+// [notes on interface] :
+// 1. the payload shares the elements with the model, copying it copies
+//    pointers only. the model replaces an element instead of changing it,
+//    so the payload keeps showing the elements as they were when the
+//    response was built
+// 2. a row lists the points of one element, each followed by a space
+// 3. the payload can hold a page of the elements, given by the index of
+//    the first element and the maximum number of elements
+// 4. the template is explicitly instantiated in the source file for
+//    Face3D and Line3D
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+template <class Element>
+class ElementsPayload : public ResponsePayload
+{
+public:
+    // constructor, init with the elements of the model, or a page of
+    // at most limit elements starting at offset
+    ElementsPayload(const vector<shared_ptr<Element>>& elements,
+                    size_t offset = 0, size_t limit = SIZE_MAX);
+    // number of elements
+    size_t Size() const override;
+    // the points of one element
+    void AppendRow(size_t index, string& buffer) const override;
+    // index of the first element in the model
+    size_t FirstIndex() const override;
+    // bytes of the pointers, the elements are shared with the model
+    size_t MemoryUsage() const override;
+    // read-only access to an element
+    const Element& At(size_t index) const;
+    // append the points of an element to a buffer, as in a row
+    static void AppendElement(const Element& element, string& buffer);
+
+private:
+    // private member variables, the shared elements and the index of
+    // the first one in the model
+    vector<shared_ptr<Element>> m_elements;
+    size_t m_firstIndex;
+};
+
+// notes for the PointsPayload class
+// -----------------------------------------------------------
+// [class name] : PointsPayload
+// [function] : hold a list of points, e.g. the points of one face
+// [notes on interface] :
+// 1. a row is one point in the form of Point::ToString
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class PointsPayload : public ResponsePayload
+{
+public:
+    // constructor, init with the points
+    PointsPayload(vector<Point3D> points);
+    // number of points
+    size_t Size() const override;
+    // one point
+    void AppendRow(size_t index, string& buffer) const override;
+    // bytes of the points
+    size_t MemoryUsage() const override;
+    // read-only access to a point
+    const Point3D& At(size_t index) const;
+
+private:
+    // private member variables, the points
+    vector<Point3D> m_points;
+};
+
+// notes for the NumbersPayload class
+// -----------------------------------------------------------
+// [class name] : NumbersPayload
+// [function] : hold a list of named numbers, e.g. the statistics
+// [notes on interface] :
+// 1. a row is "name: value", counts are printed without a fraction,
+//    other values as by to_string
+// 2. the names must be string literals, they are not copied
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class NumbersPayload : public ResponsePayload
+{
+public:
+    // one named number
+    struct Entry {
+        const char* Name;
+        double Value;
+        bool IsCount;
+    };
+    // constructor, init with the named numbers
+    NumbersPayload(vector<Entry> entries);
+    // number of entries
+    size_t Size() const override;
+    // one named number
+    void AppendRow(size_t index, string& buffer) const override;
+    // bytes of the entries
+    size_t MemoryUsage() const override;
+    // read-only access to an entry
+    const Entry& At(size_t index) const;
+
+private:
+    // private member variables, the entries
+    vector<Entry> m_entries;
+};
+
+// notes for the StringsPayload class
+// -----------------------------------------------------------
+// [class name] : StringsPayload
+// [function] : hold rows that are already formatted
+// [notes on interface] :
+// 1. the rows are kept as they are given, e.g. the rows of a response
+//    received by the client of the server
+// 2. the index of the first row can be given, so a page of faces or
+//    lines keeps its indices in the model
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class StringsPayload : public ResponsePayload
+{
+public:
+    // constructor, init with the rows and the index of the first row
+    StringsPayload(vector<string> rows, size_t firstIndex = 0);
+    // number of rows
+    size_t Size() const override;
+    // one row
+    void AppendRow(size_t index, string& buffer) const override;
+    // index of the first row in the whole list
+    size_t FirstIndex() const override;
+    // bytes of the rows
+    size_t MemoryUsage() const override;
+
+private:
+    // private member variables, the rows and the index of the first one
+    vector<string> m_rows;
+    size_t m_firstIndex;
+};
+
+#endif // RESPONSEPAYLOAD_HPP
@@ -0,0 +1,187 @@
+// [file name] : element3dvalidator.cpp
+// [function] : implement the Element3DValidator class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the Element3DValidator class
+// reason: to support validating faces and lines in bulk
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: gather the points through the indices of the elements, report
+//       bad indices, do not test collinearity
+// reason: the importer validates the indices of a file in bulk with it
+// -----------------------------------------------------------
+
+#include "element3dvalidator.hpp"
+#include <array>
+#include <vector>
+#include <cmath>
+
+using namespace std;
+
+// two coordinates closer than this are the same, as in Point::operator==
+static const double SAME_POINT_TOLERANCE = 1e-6;
+
+// -----------------------------------------------------------
+// [name] : MarkBadIndices
+// [function] : flag the elements with an index outside the vertices
+// [input] : the elements, the range to check, the number of vertices,
+//           the flags, one per element of the range
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <size_t N>
+static void MarkBadIndices(const vector<array<int, N>>& elements,
+                           size_t first, size_t last, int vertexCount,
+                           vector<unsigned char>& flags) {
+    for (size_t i = first; i < last; i++) {
+        unsigned char bad = 0;
+        for (int index : elements[i]) {
+            bad |= (index < 1) | (index > vertexCount);
+        }
+        flags[i - first] = bad;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : GatherCoordinates
+// [function] : copy one point of every element into three coordinate arrays
+// [input] : the vertices, the elements, the range to gather, the index
+//           of the point, the flags of the bad elements, the three arrays
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <size_t N>
+static void GatherCoordinates(const vector<Point3D>& vertices,
+                              const vector<array<int, N>>& elements,
+                              size_t first, size_t last, unsigned int point,
+                              const vector<unsigned char>& bad,
+                              vector<double>& xs, vector<double>& ys,
+                              vector<double>& zs) {
+    size_t n = last - first;
+    xs.resize(n);
+    ys.resize(n);
+    zs.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        if (bad[i]) {
+            // the points of a bad element are set apart from each other,
+            // so it is only reported for its index
+            xs[i] = point;
+            ys[i] = 0.0;
+            zs[i] = 0.0;
+            continue;
+        }
+        const Point3D& p = vertices[elements[first + i][point] - 1];
+        xs[i] = p.X;
+        ys[i] = p.Y;
+        zs[i] = p.Z;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : MarkSamePoints
+// [function] : flag the elements whose two given points are the same
+// [input] : the coordinate arrays of the two points, the flags
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void MarkSamePoints(const vector<double>& ax, const vector<double>& ay,
+                           const vector<double>& az, const vector<double>& bx,
+                           const vector<double>& by, const vector<double>& bz,
+                           vector<unsigned char>& flags) {
+    size_t n = flags.size();
+    // no branch in the loop body, so that it can be vectorized
+    for (size_t i = 0; i < n; i++) {
+        unsigned char same =
+            (fabs(ax[i] - bx[i]) <= SAME_POINT_TOLERANCE) &
+            (fabs(ay[i] - by[i]) <= SAME_POINT_TOLERANCE) &
+            (fabs(az[i] - bz[i]) <= SAME_POINT_TOLERANCE);
+        flags[i] |= same;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : CollectReports
+// [function] : list the defects of the elements of a range in order
+// [input] : the index of the first element, the flags of the bad
+//           indices and of the duplicate points
+// [output] : a vector of reports, one per degenerate element
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static vector<Element3DValidator::Report> CollectReports(
+            size_t first, const vector<unsigned char>& bad,
+            const vector<unsigned char>& duplicate) {
+    using Defect = Element3DValidator::Defect;
+    vector<Element3DValidator::Report> reports;
+    for (size_t i = 0; i < bad.size(); i++) {
+        if (bad[i]) {
+            reports.push_back({first + i, Defect::BAD_INDEX});
+        }
+        else if (duplicate[i]) {
+            reports.push_back({first + i, Defect::DUPLICATE_POINTS});
+        }
+    }
+    return reports;
+}
+
+// -----------------------------------------------------------
+// [name] : ValidateFaces
+// [function] : find the faces with a bad index or duplicate points
+// [input] : the vertices, the 1-based indices of the faces, the range
+//           of faces to check
+// [output] : a vector of reports, one per degenerate face
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<Element3DValidator::Report> Element3DValidator::ValidateFaces(
+            const vector<Point3D>& vertices,
+            const vector<array<int, 3>>& faces, size_t first, size_t last) {
+    size_t n = last - first;
+    vector<unsigned char> bad(n, 0);
+    MarkBadIndices(faces, first, last, static_cast<int>(vertices.size()),
+                   bad);
+    vector<double> ax, ay, az, bx, by, bz, cx, cy, cz;
+    GatherCoordinates(vertices, faces, first, last, 0, bad, ax, ay, az);
+    GatherCoordinates(vertices, faces, first, last, 1, bad, bx, by, bz);
+    GatherCoordinates(vertices, faces, first, last, 2, bad, cx, cy, cz);
+    // flag the faces that have two equal points
+    vector<unsigned char> duplicate(n, 0);
+    MarkSamePoints(ax, ay, az, bx, by, bz, duplicate);
+    MarkSamePoints(ax, ay, az, cx, cy, cz, duplicate);
+    MarkSamePoints(bx, by, bz, cx, cy, cz, duplicate);
+    return CollectReports(first, bad, duplicate);
+}
+
+// -----------------------------------------------------------
+// [name] : ValidateLines
+// [function] : find the lines with a bad index or two equal points
+// [input] : the vertices, the 1-based indices of the lines, the range
+//           of lines to check
+// [output] : a vector of reports, one per degenerate line
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<Element3DValidator::Report> Element3DValidator::ValidateLines(
+            const vector<Point3D>& vertices,
+            const vector<array<int, 2>>& lines, size_t first, size_t last) {
+    size_t n = last - first;
+    vector<unsigned char> bad(n, 0);
+    MarkBadIndices(lines, first, last, static_cast<int>(vertices.size()),
+                   bad);
+    vector<double> ax, ay, az, bx, by, bz;
+    GatherCoordinates(vertices, lines, first, last, 0, bad, ax, ay, az);
+    GatherCoordinates(vertices, lines, first, last, 1, bad, bx, by, bz);
+    // flag the lines that have two equal points
+    vector<unsigned char> duplicate(n, 0);
+    MarkSamePoints(ax, ay, az, bx, by, bz, duplicate);
+    return CollectReports(first, bad, duplicate);
+}
@@ -0,0 +1,96 @@
+// [file name] : element3dvalidator.hpp
+// [function] : declare the Element3DValidator class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init Element3DValidator class
+//       add bulk validation of faces and lines
+// reason: elements built with the Unchecked constructors need to be checked
+//         in bulk, and a list of defects is more useful than one exception
+//         for the first bad element
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: validate faces and lines given by indices into the vertices
+//       instead of built elements, report bad indices, drop the
+//       collinear faces
+// reason: the importer checks the indices of a file before it builds the
+//         elements, the elements were only checked one at a time.
+//         Face3D::Validate accepts collinear faces, so the validator
+//         must not reject them either
+// -----------------------------------------------------------
+
+#ifndef ELEMENT3DVALIDATOR_HPP
+#define ELEMENT3DVALIDATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "point3d.hpp"
+
+using namespace std;
+
+// notes about the class Element3DValidator
+// -----------------------------------------------------------
+// [class name] : Element3DValidator
+// [function] : find degenerate faces and lines in bulk
+// [notes on interface] :
+// 1. all functions are static, the class only groups the validators
+// 2. a face or a line is given by the 1-based indices of its points in
+//    the vertices, as in an OBJ file. the elements from first to last
+//    are checked, so a caller can split the work into chunks
+// 3. the validators apply the same rules as Face3D::Validate and
+//    Line3D::Validate, two points closer than 1e-6 in every coordinate
+//    are the same point. an index outside the vertices is reported as
+//    BAD_INDEX
+// 4. the coordinates are copied into contiguous arrays first, so that the
+//    point comparisons run as a branch-free loop the compiler can vectorize
+// 5. the result lists every defect in order with the index of the
+//    element, an empty result means that all elements are valid
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class Element3DValidator
+{
+public:
+    // notes for the Defect enum class
+    // -----------------------------------------------------------
+    // [enum class name] : Defect
+    // [function] : define the kinds of degenerate elements
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -----------------------------------------------------------
+    enum class Defect {
+        // an index of the element is not one of the vertices
+        BAD_INDEX,
+        // two points of the element are the same
+        DUPLICATE_POINTS
+    };
+    // one degenerate element
+    struct Report {
+        // index of the element in the validated vector
+        size_t Index;
+        // what is wrong with the element
+        Defect Kind;
+    };
+
+    // find the degenerate faces from first to last
+    static vector<Report> ValidateFaces(const vector<Point3D>& vertices,
+                                        const vector<array<int, 3>>& faces,
+                                        size_t first, size_t last);
+    // find the degenerate lines from first to last
+    static vector<Report> ValidateLines(const vector<Point3D>& vertices,
+                                        const vector<array<int, 2>>& lines,
+                                        size_t first, size_t last);
+
+private:
+    // no instance is needed
+    Element3DValidator() = delete;
+};
+
+#endif // ELEMENT3DVALIDATOR_HPP
@@ -10,11 +10,42 @@
 // edit: add implementation of the Face3D class
 // reason: to support storing the 3D face
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: use the Predicates class in IsPointOnFacePlane
+// reason: the old check built a matrix on the heap 
+//         and failed on zero components
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: cache the unit normal, the plane offset and the area of the face
+//       rewrite distance, angle and parallelism queries with the cache
+// reason: every query rebuilt the normal from Vector temporaries and 
+//         wrapped it in a Line3D, some of them even twice
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: derive from FixedSizePoint3DContainer<3>
+//       compare the points in place in IsSameFace
+// reason: to store the three points without a heap allocation
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add unchecked constructors
+// reason: to skip the validation of trusted points in bulk construction
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add Validate and Create, override TryModifyPoint
+// reason: to let the model reject invalid faces without exceptions
+// -----------------------------------------------------------
 
 #include "face3d.hpp"
 #include "line3d.hpp"
 #include "point3d.hpp"
+#include "predicates.hpp"
 #include <stdexcept>
+#include <array>
 #include <vector>
 #include <algorithm>
 #include <cmath>
@@ -30,8 +61,10 @@ using namespace std;
 // [author] : Huayu Chen
 // [date] : 2024/8/4
 // -----------------------------------------------------------
-Face3D::Face3D() : FixedSizePoint3DContainer(
-                        {Point3D(), Point3D(), Point3D()}) {}
+Face3D::Face3D() : FixedSizePoint3DContainer<3>(
+                        array<Point3D, 3>{{Point3D(), Point3D(), Point3D()}}) {
+    UpdatePlane();
+}
 
 
 // -----------------------------------------------------------
@@ -44,11 +77,12 @@ Face3D::Face3D() : FixedSizePoint3DContainer(
 // -----------------------------------------------------------
 Face3D::Face3D(const Point3D& point1, const Point3D& point2, 
              const Point3D& point3) : 
-    FixedSizePoint3DContainer({point1, point2, point3}) {
-        // check if the three points are distinct
-    if (point1 == point2 || point1 == point3 || point2 == point3) {
+    FixedSizePoint3DContainer<3>(array<Point3D, 3>{{point1, point2, point3}}) {
+    // check if the three points are distinct
+    if (Validate(point1, point2, point3) != ErrorCode::NONE) {
         throw invalid_argument("The three points are not distinct");
     }
+    UpdatePlane();
 }
 
 // -----------------------------------------------------------
@@ -70,11 +104,13 @@ Face3D::~Face3D() {}
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Face3D::Face3D(const Point3D& point, const Line3D& line) : 
-    FixedSizePoint3DContainer({point, line.GetPoint(0), line.GetPoint(1)}) {
+    FixedSizePoint3DContainer<3>(
+                        array<Point3D, 3>{{point, line.At(0), line.At(1)}}) {
         // check if the point is on the line
     if (line.IsPointOnLine(point)) {
         throw invalid_argument("The point is on the line");
     }
+    UpdatePlane();
 }
 
 // -----------------------------------------------------------
@@ -86,8 +122,8 @@ Face3D::Face3D(const Point3D& point, const Line3D& line) :
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Face3D::Face3D(const Line3D& line1, const Line3D& line2) : 
-    FixedSizePoint3DContainer({line1.GetPoint(0), line1.GetPoint(1), 
-                               line2.GetPoint(1)}) {
+    FixedSizePoint3DContainer<3>(array<Point3D, 3>{{line1.At(0), line1.At(1), 
+                                                   line2.At(1)}}) {
     // check if the two lines are on the same plane
     if (!line1.OnSamePlane(line2)) {
         throw invalid_argument("The two lines are not on the same plane");
@@ -101,6 +137,7 @@ Face3D::Face3D(const Line3D& line1, const Line3D& line2) :
         line2.GetPoint(1) == line1.GetPoint(1)) {
         ModifyPoint(2, line2.GetPoint(0));
     }
+    UpdatePlane();
 }
 
 // -----------------------------------------------------------
@@ -112,16 +149,46 @@ Face3D::Face3D(const Line3D& line1, const Line3D& line2) :
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Face3D::Face3D(const vector<Point3D>& points) : 
-    FixedSizePoint3DContainer(points) {
+    FixedSizePoint3DContainer<3>(points) {
     // check if the number of points is 3
     if (points.size() != 3) {
         throw invalid_argument("Face3D must have 3 points");
     }
     // check if the three points are distinct
-    if (points[0] == points[1] || points[0] == points[2] || 
-        points[1] == points[2]) {
+    if (Validate(points[0], points[1], points[2]) != ErrorCode::NONE) {
         throw invalid_argument("The three points are not distinct");
     }
+    UpdatePlane();
+}
+
+// -----------------------------------------------------------
+// [name] : Face3D
+// [function] : constructor of the Face3D class without validation
+// [input] : three points of class Point3D, the Unchecked tag
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Face3D::Face3D(const Point3D& point1, const Point3D& point2, 
+               const Point3D& point3, Unchecked) : 
+    FixedSizePoint3DContainer<3>(array<Point3D, 3>{{point1, point2, point3}}) {
+    UpdatePlane();
+}
+
+// -----------------------------------------------------------
+// [name] : Face3D
+// [function] : constructor of the Face3D class without validation
+// [input] : two lines, the Unchecked tag
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Face3D::Face3D(const Line3D& line1, const Line3D& line2, Unchecked) : 
+    FixedSizePoint3DContainer<3>(array<Point3D, 3>{{line1.At(0), line1.At(1), 
+        // take the point of the second line that is not shared 
+        // with the first line
+        line1.IsPoint3DInContainer(line2.At(1)) ? line2.At(0) : line2.At(1)}}) {
+    UpdatePlane();
 }
 
 // -----------------------------------------------------------
@@ -151,25 +218,136 @@ Face3D& Face3D::operator=(const Face3D& face) {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Line3D Face3D::PerpendicularLine() const {
-    // get the normal vector of the face
-    // the normal vector is the cross product of two vectors on the face
-    // the two vectors are the two edges of the face
-    Vector vector1 = GetPoint(0).ToVector();
-    Vector vector2 = GetPoint(1).ToVector();
-    Vector vector3 = GetPoint(2).ToVector();
-    Vector vector4 = vector2 - vector1;
-    Vector vector5 = vector3 - vector1;
-    Vector normal = vector4.Cross(vector5);
-    Point3D point = GetPoint(0);
-    // the perpendicular line is defined by the normal vector 
-    // and a point on the face
-    try {
-        Line3D line(point, Point3D((point.ToVector() + normal).GetData()));
-        return line;
+    // the perpendicular line is defined by the cached unit normal
+    // and the first point of the face
+    const Point3D& point = At(0);
+    return Line3D(point, Point3D(point.X + m_rNormalX, point.Y + m_rNormalY, 
+                                 point.Z + m_rNormalZ));
+}
+
+// -----------------------------------------------------------
+// [name] : TryModifyPoint
+// [function] : modify a point of the face and refresh the plane cache
+// [input] : an unsigned int index and a Point3D object
+// [output] : the error code of FixedSizePoint3DContainer::TryModifyPoint
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Face3D::TryModifyPoint(unsigned int index, const Point3D& point) {
+    ErrorCode code = FixedSizePoint3DContainer<3>::TryModifyPoint(index, point);
+    if (code == ErrorCode::NONE) {
+        UpdatePlane();
     }
-    catch (exception& e) {
-        throw e;
+    return code;
+}
+
+// -----------------------------------------------------------
+// [name] : Validate
+// [function] : check if three points make a face
+// [input] : three points of class Point3D
+// [output] : NONE if the points are distinct, NOT_A_FACE otherwise
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Face3D::Validate(const Point3D& point1, const Point3D& point2, 
+                           const Point3D& point3) {
+    if (point1 == point2 || point1 == point3 || point2 == point3) {
+        return ErrorCode::NOT_A_FACE;
     }
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : Create
+// [function] : build a face from a vector of points without throwing
+// [input] : a vector of points
+// [output] : the face, or NOT_A_FACE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Face3D> Face3D::Create(const vector<Point3D>& points) {
+    // check if the number of points is 3
+    if (points.size() != 3) {
+        return ErrorCode::NOT_A_FACE;
+    }
+    // check if the three points are distinct
+    ErrorCode code = Validate(points[0], points[1], points[2]);
+    if (code != ErrorCode::NONE) {
+        return code;
+    }
+    // the points are checked, skip the validation of the constructor
+    return Face3D(points[0], points[1], points[2], Unchecked());
+}
+
+// -----------------------------------------------------------
+// [name] : UpdatePlane
+// [function] : recompute the cached unit normal, plane offset and 
+//              doubled area from the three points of the face
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Face3D::UpdatePlane() {
+    const Point3D& p0 = At(0);
+    const Point3D& p1 = At(1);
+    const Point3D& p2 = At(2);
+    // the normal is the cross product of the two edges from the first point
+    double ux = p1.X - p0.X, uy = p1.Y - p0.Y, uz = p1.Z - p0.Z;
+    double vx = p2.X - p0.X, vy = p2.Y - p0.Y, vz = p2.Z - p0.Z;
+    double nx = uy * vz - uz * vy;
+    double ny = uz * vx - ux * vz;
+    double nz = ux * vy - uy * vx;
+    // the length of the cross product is twice the area of the face
+    m_rDoubleArea = sqrt(nx * nx + ny * ny + nz * nz);
+    // a degenerate face has no normal, keep the zero vector
+    if (m_rDoubleArea > 0) {
+        nx /= m_rDoubleArea;
+        ny /= m_rDoubleArea;
+        nz /= m_rDoubleArea;
+    }
+    m_rNormalX = nx;
+    m_rNormalY = ny;
+    m_rNormalZ = nz;
+    // the plane is n . x = offset
+    m_rOffset = nx * p0.X + ny * p0.Y + nz * p0.Z;
+}
+
+// -----------------------------------------------------------
+// [name] : GetNormal
+// [function] : get the unit normal vector of the face
+// [input] : none
+// [output] : a Vector object
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Vector Face3D::GetNormal() const {
+    return Vector({m_rNormalX, m_rNormalY, m_rNormalZ});
+}
+
+// -----------------------------------------------------------
+// [name] : GetPlaneOffset
+// [function] : get the offset d of the face plane n . x = d
+// [input] : none
+// [output] : a double value
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+double Face3D::GetPlaneOffset() const {
+    return m_rOffset;
+}
+
+// -----------------------------------------------------------
+// [name] : SignedDistance
+// [function] : get the signed distance from the face plane to a point
+// [input] : a Point3D object
+// [output] : a double value
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+double Face3D::SignedDistance(const Point3D& point) const {
+    return m_rNormalX * point.X + m_rNormalY * point.Y 
+         + m_rNormalZ * point.Z - m_rOffset;
 }
 
 // -----------------------------------------------------------
@@ -181,12 +359,12 @@ Line3D Face3D::PerpendicularLine() const {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 bool Face3D::IsParallel(const Face3D& face) const {
-    // check if the two faces are parallel
-    // the two faces are parallel if the normal vectors 
-    // of the faces are parallel
-    Line3D line1 = PerpendicularLine();
-    Line3D line2 = face.PerpendicularLine();
-    return line1.IsParallel(line2) && !IsCoincidentTo(face);
+    // the two faces are parallel if the cross product of the unit normals
+    // vanishes and the faces are not coincident
+    double cx = m_rNormalY * face.m_rNormalZ - m_rNormalZ * face.m_rNormalY;
+    double cy = m_rNormalZ * face.m_rNormalX - m_rNormalX * face.m_rNormalZ;
+    double cz = m_rNormalX * face.m_rNormalY - m_rNormalY * face.m_rNormalX;
+    return cx * cx + cy * cy + cz * cz < 1e-12 && !IsCoincidentTo(face);
 }
 
 // -----------------------------------------------------------
@@ -198,12 +376,9 @@ bool Face3D::IsParallel(const Face3D& face) const {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 bool Face3D::IsPerpendicular(const Face3D& face) const {
-    // check if the two faces are perpendicular
-    // the two faces are perpendicular if the normal vectors
-    // of the faces are perpendicular
-    Line3D line1 = PerpendicularLine();
-    Line3D line2 = face.PerpendicularLine();
-    return line1.IsPerpendicular(line2);
+    // the two faces are perpendicular if the unit normals are orthogonal
+    return fabs(m_rNormalX * face.m_rNormalX + m_rNormalY * face.m_rNormalY 
+              + m_rNormalZ * face.m_rNormalZ) < 1e-6;
 }
 
 // -----------------------------------------------------------
@@ -217,9 +392,9 @@ bool Face3D::IsPerpendicular(const Face3D& face) const {
 bool Face3D::IsCoincidentTo(const Face3D& face) const {
     // check if the two faces are coincident
     // the two faces are coincident if they are on the same plane
-    return face.IsPointOnFacePlane(GetPoint(0)) && 
-           face.IsPointOnFacePlane(GetPoint(1)) && 
-           face.IsPointOnFacePlane(GetPoint(2));
+    return face.IsPointOnFacePlane(At(0)) && 
+           face.IsPointOnFacePlane(At(1)) && 
+           face.IsPointOnFacePlane(At(2));
 }
 
 // -----------------------------------------------------------
@@ -231,16 +406,9 @@ bool Face3D::IsCoincidentTo(const Face3D& face) const {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 bool Face3D::IsPointOnFacePlane(const Point3D& point) const {
-    Vector vector1 = GetPoint(0).ToVector() - point.ToVector();
-    Vector vector2 = GetPoint(1).ToVector() - point.ToVector();
-    Vector vector3 = GetPoint(2).ToVector() - point.ToVector();
-    // check if the three vectors are linearly dependent
-    // if they are linearly dependent, the point is on the face plane
-    if (!Vector::IsLinearIndependent(
-            vector<Vector>({vector1, vector2, vector3}))) {
-        return true;
-    }
-    return false;
+    // the point is on the face plane if it is coplanar 
+    // with the three points of the face
+    return Predicates::IsCoplanar(At(0), At(1), At(2), point);
 }
 
 // -----------------------------------------------------------
@@ -253,10 +421,10 @@ bool Face3D::IsPointOnFacePlane(const Point3D& point) const {
 // -----------------------------------------------------------
 double Face3D::Angle(const Face3D& face) const {
     // the angle between two faces is the angle between the normal vectors
-    // of the faces
-    Line3D line1 = PerpendicularLine();
-    Line3D line2 = face.PerpendicularLine();
-    return line1.AngleFrom(line2);
+    // of the faces, clamp the cosine against rounding errors
+    double cosAngle = m_rNormalX * face.m_rNormalX + m_rNormalY * 
+                      face.m_rNormalY + m_rNormalZ * face.m_rNormalZ;
+    return acos(max(-1.0, min(1.0, cosAngle)));
 }
 
 // -----------------------------------------------------------
@@ -268,8 +436,6 @@ double Face3D::Angle(const Face3D& face) const {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 double Face3D::Distance(const Face3D& face) const {
-    // the distance between two faces is the distance between the two points
-    // on the faces that are perpendicular to each other
     // check if the two faces are coincident
     if (IsCoincidentTo(face)) {
         return 0;
@@ -278,18 +444,9 @@ double Face3D::Distance(const Face3D& face) const {
     if (!IsParallel(face)) {
         throw invalid_argument("The two faces are not parallel");
     }
-    Point3D PerpendicularPoint1 = PerpendicularLine().GetPoint(0);
-    Point3D PerpendicularPoint2 = PerpendicularLine().GetPoint(1);
-    // the normal vector of the face is the vector between the two points
-    // on the face that are perpendicular to each other
-    Vector normal = PerpendicularPoint1.ToVector() - 
-                    PerpendicularPoint2.ToVector();
-    Point3D PointOnPlane1 = GetPoint(0);
-    Point3D PointOnPlane2 = face.GetPoint(0);
-    // the distance is the projection of the vector between the two points
-    // on the face plane onto the normal vector of the face
-    Vector crossPlane = PointOnPlane1.ToVector() - PointOnPlane2.ToVector();
-    return crossPlane.Dot(normal) / normal.Norm();
+    // the distance is the signed distance from the current plane
+    // to any point of the other face
+    return SignedDistance(face.At(0));
 }
 
 // -----------------------------------------------------------
@@ -302,26 +459,8 @@ double Face3D::Distance(const Face3D& face) const {
 // -----------------------------------------------------------
 double Face3D::Distance(const Point3D& point) const {
     // the distance between a face and a point is the projection of the vector
-    // between the point and the face plane onto the normal vector of the face
-
-    // check if the point is on the face plane
-    if (IsPointOnFacePlane(point)) {
-        return 0;
-    }
-    Line3D line = PerpendicularLine();
-    Point3D PerpendicularPoint1 = line.GetPoint(0);
-    Point3D PerpendicularPoint2 = line.GetPoint(1);
-    // the normal vector of the face is the vector between the two points
-    // on the face that are perpendicular to each other
-    Vector normal = PerpendicularPoint1.ToVector() - 
-                    PerpendicularPoint2.ToVector();
-    // the distance is the projection of the vector between the point and the
-    // face plane onto the normal vector of the face
-    
-    // the vector between the point and the face plane is the vector between
-    // the point and the first point of the face
-    Vector crossPlane = GetPoint(0).ToVector() - point.ToVector();
-    return crossPlane.Dot(normal) / normal.Norm();
+    // between the face plane and the point onto the unit normal of the face
+    return SignedDistance(point);
 }
 
 // -----------------------------------------------------------
@@ -333,11 +472,14 @@ double Face3D::Distance(const Point3D& point) const {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 bool Face3D::IsParallel(const Line3D& line) const {
-    Line3D normal = PerpendicularLine();
     // the face is parallel to the line if the normal vector of the face
     // is perpendicular to the line and the line is not on the face plane
-    return normal.IsPerpendicular(line) && 
-            !IsPointOnFacePlane(line.GetPoint(0));
+    const Point3D& p1 = line.At(0);
+    const Point3D& p2 = line.At(1);
+    double dx = p2.X - p1.X, dy = p2.Y - p1.Y, dz = p2.Z - p1.Z;
+    double dot = m_rNormalX * dx + m_rNormalY * dy + m_rNormalZ * dz;
+    return fabs(dot) < 1e-6 * sqrt(dx * dx + dy * dy + dz * dz) && 
+            !IsPointOnFacePlane(p1);
 }
 
 // -----------------------------------------------------------
@@ -349,24 +491,13 @@ bool Face3D::IsParallel(const Line3D& line) const {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 double Face3D::Distance(const Line3D& line) const {
-    // the distance between a face and a line is the projection of the vector
-    // between the line and the face plane onto the normal vector of the face
     // check if the line is parallel to the face
     if (!IsParallel(line)) {
         throw invalid_argument("The line is not parallel to the face");
     }
-    Point3D PerpendicularPoint1 = PerpendicularLine().GetPoint(0);
-    Point3D PerpendicularPoint2 = PerpendicularLine().GetPoint(1);
-    // the normal vector of the face is the vector between the two points
-    // on the face that are perpendicular to each other
-    Vector normal = PerpendicularPoint1.ToVector() - 
-                    PerpendicularPoint2.ToVector();
-    Point3D PointOnPlane1 = GetPoint(0);
-    Point3D PointOnPlane2 = line.GetPoint(0);
-    // the distance is the projection of the vector between the line and the
-    // face plane onto the normal vector of the face
-    Vector crossPlane = PointOnPlane1.ToVector() - PointOnPlane2.ToVector();
-    return crossPlane.Dot(normal) / normal.Norm();
+    // the distance is the signed distance from the face plane
+    // to any point of the line
+    return SignedDistance(line.At(0));
 }
 
 // -----------------------------------------------------------
@@ -378,14 +509,9 @@ double Face3D::Distance(const Line3D& line) const {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 double Face3D::Area() const {
-    // the area of the face is the half of the cross product of two vectors
-    // on the face
-    Vector vector1 = GetPoint(0).ToVector();
-    Vector vector2 = GetPoint(1).ToVector();
-    Vector vector3 = GetPoint(2).ToVector();
-    Vector vector4 = vector2 - vector1;
-    Vector vector5 = vector3 - vector1;
-    return 0.5 * vector4.Cross(vector5).Norm();
+    // the area of the face is the half of the length of the cross product
+    // of two edges, which is cached
+    return 0.5 * m_rDoubleArea;
 }
 
 // -----------------------------------------------------------
@@ -398,13 +524,8 @@ double Face3D::Area() const {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 bool Face3D::IsSameFace(const Face3D& face1, const Face3D& face2) {
-    vector<Point3D> points1 = face1.GetPoints();
-    vector<Point3D> points2 = face2.GetPoints();
     // check if the two faces have the same three points
-    for (const Point3D& point : points1) {
-        if (find(points2.begin(), points2.end(), point) == points2.end()) {
-            return false;
-        }
-    }
-    return true;
+    return face2.IsPoint3DInContainer(face1.At(0)) && 
+           face2.IsPoint3DInContainer(face1.At(1)) && 
+           face2.IsPoint3DInContainer(face1.At(2));
 }
\ No newline at end of file
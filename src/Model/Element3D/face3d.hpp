@@ -12,6 +12,24 @@
 //       add some common math functions
 // reason: to support various operations on face3d
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: cache the unit normal, the plane offset and the area
+//       add GetNormal, GetPlaneOffset and SignedDistance
+//       override ModifyPoint to refresh the cache
+// reason: to make distance, angle and area queries a few flops
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add unchecked constructors
+// reason: to skip the validation of trusted points in bulk construction
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add Validate and Create, which report errors without exceptions
+//       override TryModifyPoint instead of ModifyPoint
+// reason: to let the model reject invalid faces without exceptions
+// -----------------------------------------------------------
 
 #ifndef FACE3D_HPP
 #define FACE3D_HPP
@@ -23,6 +41,7 @@
 #include "line3d.hpp"
 #include <string>
 #include "fixedsizepoint3dcontainer.hpp"
+#include "../Result/result.hpp"
 
 using namespace std;
 
@@ -36,12 +55,15 @@ using namespace std;
 //    and angle calculation
 // 3. the class is derived from the FixedSizePoint3DContainer class, which means
 //    that the face can be represented by a fixed number of points
+// 4. the unit normal, the plane offset and the area are computed when the
+//    face is built and refreshed by ModifyPoint, the normal of a degenerate
+//    face is the zero vector
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
 
 
-class Face3D : public FixedSizePoint3DContainer
+class Face3D : public FixedSizePoint3DContainer<3>
 {
 public:
     // constructor 0: default constructor
@@ -54,10 +76,24 @@ public:
     Face3D(const Line3D& line1, const Line3D& line2);
     // constructor 4: three points in a vector
     Face3D(const vector<Point3D>& points);
+    // constructor 5: three trusted points, no validation
+    Face3D(const Point3D& point1, const Point3D& point2, const Point3D& point3,
+           Unchecked);
+    // constructor 6: two trusted lines with a common point, no validation
+    Face3D(const Line3D& line1, const Line3D& line2, Unchecked);
     // virtual destructor
     virtual ~Face3D();
     // assignment operator
     Face3D& operator=(const Face3D& face);
+    // modify a point by index and refresh the cached plane
+    ErrorCode TryModifyPoint(unsigned int index, 
+                             const Point3D& point) override;
+    // check if three points make a face, NONE or NOT_A_FACE
+    static ErrorCode Validate(const Point3D& point1, const Point3D& point2, 
+                              const Point3D& point3);
+    // build a face from three points in a vector without throwing,
+    // NOT_A_FACE if there are not three distinct points
+    static Result<Face3D> Create(const vector<Point3D>& points);
 
     // check if the face is parallel to another face
     bool IsParallel(const Face3D& face) const;
@@ -77,13 +113,31 @@ public:
     double Distance(const Point3D& point) const;
     // calculate the distance between a face and a line
     double Distance(const Line3D& line) const;
+    // get the signed distance from the face plane to a point
+    double SignedDistance(const Point3D& point) const;
     // get the normal vector of the face
     Line3D PerpendicularLine() const;
+    // get the unit normal vector of the face
+    Vector GetNormal() const;
+    // get the offset d of the face plane n . x = d
+    double GetPlaneOffset() const;
     // get the area of the face defined by the three points
     double Area() const;
     // check if the two faces are identical in that 
     // the three points are the same
     static bool IsSameFace(const Face3D& face1, const Face3D& face2);
+
+private:
+    // recompute the cached plane from the three points
+    void UpdatePlane();
+    // the unit normal of the face plane
+    double m_rNormalX;
+    double m_rNormalY;
+    double m_rNormalZ;
+    // the offset of the face plane n . x = offset
+    double m_rOffset;
+    // the length of the cross product of two edges, twice the area
+    double m_rDoubleArea;
 };
 
 #endif // FACE3D_HPP
@@ -18,42 +18,103 @@
 // reason: to support converting the container to a string 
 //         for display and output to a stream
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add At function
+// reason: to support reading a point without copying it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: make ModifyPoint virtual
+// reason: to let derived classes refresh the data cached from the points
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: turn the class into the template FixedSizePoint3DContainer<N>
+//       store the points in a std::array instead of a vector
+//       make Size a compile-time constant
+// reason: lines always hold 2 points and faces always hold 3, the vector
+//         cost one heap allocation and one indirection per element
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the Unchecked tag type
+// reason: to select the constructors of lines and faces that skip 
+//         validation when the input is trusted
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryModifyPoint, which returns an error code
+//       ModifyPoint is no longer virtual, it throws on the error code
+// reason: to let the model modify points without exceptions
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: move the definitions of the template from the source file into
+//       the header, remove the explicit instantiations
+// reason: GetPoint, At, IsPoint3DInContainer and the comparisons are 
+//         called for every element, defined in the source file they 
+//         could not be inlined or unrolled by the callers
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: point the Unchecked tag to the validation of the importer
+// reason: Element3DValidator checks indices, not built elements
+// -----------------------------------------------------------
 
 #ifndef FIXEDSIZEPOINT3DCONTAINER_HPP
 #define FIXEDSIZEPOINT3DCONTAINER_HPP
 
+#include <array>
 #include <vector>
 #include <string>
 #include <ostream>
+#include <stdexcept>
 
 #include "point3d.hpp"
+#include "../Result/result.hpp"
 
 using namespace std;
 
+// tag type passed to the constructors of Line3D and Face3D to skip the
+// validation of the points, for trusted input such as generated meshes
+// or the elements of a file whose indices were checked in bulk with
+// Element3DValidator before
+struct Unchecked {};
+
 // notes for the FixedSizePoint3DContainer class
 // -----------------------------------------------------------
 // [class name] : FixedSizePoint3DContainer
 // [function] : store a fixed number of 3D points in a container
 // [notes on interface] :
-// 1. since the container is fixed size, the number of points in the container
-//    is determined by the size of the vector passed to the constructor, and 
-//    cannot be changed, so there is no function to add or delete points.
+// 1. the container is a class template, the number of points N is a 
+//    template argument and cannot be changed, so there is no function to 
+//    add or delete points. the points are stored in a std::array, 
+//    so the container itself does not allocate on the heap.
 // 2. there are constant getters to get the points and a point by index, and 
 //    a function to modify a point by index.
 // 3. there is a function to convert the container to a vector of strings, 
 //    each string represents a point.
 // 4. the container can be output to a stream.
+// 5. TryModifyPoint reports INDEX_OUT_OF_RANGE or DUPLICATE_POINT without
+//    throwing, ModifyPoint throws invalid_argument on the same errors. 
+//    derived classes override TryModifyPoint to refresh cached data.
+// 6. the template is defined in this header, so it can be used with 
+//    any N and its small functions are inlined into the callers.
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
 
 
+template <unsigned int N>
 class FixedSizePoint3DContainer
 {
 public:
+    // constructor, init with an array of exactly N points
+    FixedSizePoint3DContainer(const array<Point3D, N>& points);
     // constructor, init with a vector of points
-    // no default constructor, the size of the container is determined by the 
-    // size of the vector passed to the constructor
+    // the first N points are copied, missing points are left at the origin,
+    // derived classes check the number of points themselves
     FixedSizePoint3DContainer(const vector<Point3D>& points);
     // copy constructor
     FixedSizePoint3DContainer(const FixedSizePoint3DContainer& container);
@@ -61,8 +122,12 @@ public:
     vector<Point3D> GetPoints() const;
     // getter of a point by index
     Point3D GetPoint(unsigned int index) const;
-    // modify a point by index
+    // read-only reference to a point by index, no copy is made
+    const Point3D& At(unsigned int index) const;
+    // modify a point by index, throw on failure
     void ModifyPoint(unsigned int index, const Point3D& point);
+    // modify a point by index, return the error code on failure
+    virtual ErrorCode TryModifyPoint(unsigned int index, const Point3D& point);
     // convert the container to a vector of strings
     vector<string> ToStrings() const;
     // support output to a stream
@@ -75,18 +140,256 @@ public:
     bool IsPoint3DInContainer(const Point3D& point) const;
     // virtual destructor
     virtual ~FixedSizePoint3DContainer();
-    // getter of size
-    const unsigned int& Size{m_uiSize};
-    // support output to a stream
-    friend ostream& operator<<(ostream& os, 
-                            const FixedSizePoint3DContainer& container);
-
+    // size of the container
+    static const unsigned int Size {N};
 
 private:
-    // private member variables, a vector of points 
-    // and the size of the container
-    vector<Point3D> m_points;
-    unsigned int m_uiSize;
+    // private member variables, a fixed size array of points
+    array<Point3D, N> m_points;
 };
 
+// -----------------------------------------------------------
+// [name] : FixedSizePoint3DContainer
+// [function] : constructor of the FixedSizePoint3DContainer class
+// [input] : an array of N Point3D
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <unsigned int N>
+FixedSizePoint3DContainer<N>::FixedSizePoint3DContainer(
+            const array<Point3D, N>& points) : m_points(points) {}
+
+// -----------------------------------------------------------
+// [name] : FixedSizePoint3DContainer
+// [function] : constructor of the FixedSizePoint3DContainer class
+// [input] : a vector of Point3D
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+FixedSizePoint3DContainer<N>::FixedSizePoint3DContainer(
+            const vector<Point3D>& points) {
+    // copy at most N points, the rest stay at the origin
+    for (unsigned int i = 0; i < N && i < points.size(); i++) {
+        m_points[i] = points[i];
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : FixedSizePoint3DContainer
+// [function] : copy constructor of the FixedSizePoint3DContainer class
+// [input] : a FixedSizePoint3DContainer object
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+FixedSizePoint3DContainer<N>::FixedSizePoint3DContainer(
+            const FixedSizePoint3DContainer& container) : 
+    m_points(container.m_points) {}
+
+// -----------------------------------------------------------
+// [name] : GetPoints
+// [function] : get the points in the container
+// [input] : none
+// [output] : a vector of Point3D
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+vector<Point3D> FixedSizePoint3DContainer<N>::GetPoints() const {
+    vector<Point3D> pointsCopy(m_points.begin(), m_points.end());
+    return pointsCopy;
+}
+
+// -----------------------------------------------------------
+// [name] : GetPoint
+// [function] : get a point in the container by index
+// [input] : an unsigned int index
+// [output] : a Point3D object
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+Point3D FixedSizePoint3DContainer<N>::GetPoint(unsigned int index) const {
+    // check if the index is out of range
+    if (index >= N) {
+        throw out_of_range("Index out of range");
+    }
+    return m_points[index];
+}
+
+// -----------------------------------------------------------
+// [name] : At
+// [function] : get a read-only reference to a point in the container
+// [input] : an unsigned int index
+// [output] : a const reference to a Point3D object
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <unsigned int N>
+const Point3D& FixedSizePoint3DContainer<N>::At(unsigned int index) const {
+    // check if the index is out of range
+    if (index >= N) {
+        throw out_of_range("Index out of range");
+    }
+    return m_points[index];
+}
+
+// -----------------------------------------------------------
+// [name] : ModifyPoint
+// [function] : modify a point in the container by index
+// [input] : an unsigned int index and a Point3D object
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+void FixedSizePoint3DContainer<N>::ModifyPoint(unsigned int index, 
+            const Point3D& point) {
+    ErrorCode code = TryModifyPoint(index, point);
+    if (code != ErrorCode::NONE) {
+        throw invalid_argument(ErrorMessage(code));
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : TryModifyPoint
+// [function] : modify a point in the container by index without throwing
+// [input] : an unsigned int index and a Point3D object
+// [output] : NONE on success, INDEX_OUT_OF_RANGE or DUPLICATE_POINT
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <unsigned int N>
+ErrorCode FixedSizePoint3DContainer<N>::TryModifyPoint(unsigned int index, 
+            const Point3D& point) {
+    // check if the index is out of range
+    if (index >= N) {
+        return ErrorCode::INDEX_OUT_OF_RANGE;
+    }
+    // check if the point already exists in the container
+    if (IsPoint3DInContainer(point)) {
+        return ErrorCode::DUPLICATE_POINT;
+    }
+    // modify m_points, assign as Point3D so that X, Y and Z follow
+    m_points[index] = point;
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : ToStrings
+// [function] : convert the container to a vector of strings
+// [input] : none
+// [output] : a vector of strings
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+vector<string> FixedSizePoint3DContainer<N>::ToStrings() const {
+    vector<string> pointStrings;
+    pointStrings.reserve(N);
+    // convert each point to a string
+    for (const Point3D& point : m_points) {
+        pointStrings.push_back(point.ToString());
+    }
+    return pointStrings;
+}
+
+// -----------------------------------------------------------
+// [name] : operator<<
+// [function] : overload the output operator for the class
+// [input] : an ostream object and a FixedSizePoint3DContainer object
+// [output] : an ostream object
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+ostream& FixedSizePoint3DContainer<N>::operator<<(ostream& os) const {
+    // output each point in the container
+    for (const Point3D& point : m_points) {
+        os << point << " ";
+    }
+    return os;
+}
+
+// -----------------------------------------------------------
+// [name] : operator==
+// [function] : overload the equal operator for the class
+// [input] : a FixedSizePoint3DContainer object
+// [output] : a boolean value
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+bool FixedSizePoint3DContainer<N>::operator==(
+            const FixedSizePoint3DContainer& container) const {
+    for (unsigned int i = 0; i < N; i++) {
+        if (m_points[i] != container.m_points[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : operator!=
+// [function] : overload the not equal operator for the class
+// [input] : a FixedSizePoint3DContainer object
+// [output] : a boolean value
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+bool FixedSizePoint3DContainer<N>::operator!=(const FixedSizePoint3DContainer& 
+            container) const {
+    return !(*this == container);
+}
+
+// -----------------------------------------------------------
+// [name] : ~FixedSizePoint3DContainer
+// [function] : destructor of the FixedSizePoint3DContainer class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+FixedSizePoint3DContainer<N>::~FixedSizePoint3DContainer() {}
+
+// -----------------------------------------------------------
+// [name] : operator<<
+// [function] : overload the output operator for the class
+// [input] : an ostream object and a FixedSizePoint3DContainer object
+// [output] : an ostream object
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+ostream& operator<<(ostream& os, const FixedSizePoint3DContainer<N>& container) {
+    return container.operator<<(os);
+}
+
+// -----------------------------------------------------------
+// [name] : IsPoint3DInContainer
+// [function] : check if a Point3D object is in the container
+// [input] : a Point3D object
+// [output] : a boolean value
+// [author] : Huayu Chen
+// [date] : 2024/8/3
+// -----------------------------------------------------------
+template <unsigned int N>
+bool FixedSizePoint3DContainer<N>::IsPoint3DInContainer(
+            const Point3D& point) const {
+    // N is a compile-time constant, so the loop is unrolled
+    for (unsigned int i = 0; i < N; i++) {
+        if (m_points[i] == point) {
+            return true;
+        }
+    }
+    return false;
+}
+
 #endif // FIXEDSIZEPOINT3DCONTAINER_HPP
\ No newline at end of file
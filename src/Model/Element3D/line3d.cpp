@@ -10,10 +10,35 @@
 // edit: add implementation of the Line3D class
 // reason: to support storing the 3D line
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: use the Predicates class in IsParallel, IsCoincidentTo
+//       and OnSamePlane
+// reason: the old checks divided component-wise and built a matrix
+//         on the heap, they failed on zero components
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: derive from FixedSizePoint3DContainer<2>
+//       compare the points in place in IsSameSegment and Length
+// reason: to store the two points without a heap allocation
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add an unchecked constructor
+// reason: to skip the validation of trusted points in bulk construction
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add Validate and Create
+// reason: to let the model reject invalid lines without exceptions
+// -----------------------------------------------------------
 
 #include "line3d.hpp"
 #include "point3d.hpp"
 #include "vector.hpp"
+#include "predicates.hpp"
+#include <array>
 #include <vector>
 #include <stdexcept>
 #include <cmath>
@@ -29,7 +54,8 @@ using namespace std;
 // [author] : Huayu Chen
 // [date] : 2024/8/3
 // -----------------------------------------------------------
-Line3D::Line3D() : FixedSizePoint3DContainer({Point3D(), Point3D()}) {}
+Line3D::Line3D() : FixedSizePoint3DContainer<2>(
+                        array<Point3D, 2>{{Point3D(), Point3D()}}) {}
 
 // -----------------------------------------------------------
 // [name] : Line3D
@@ -40,9 +66,9 @@ Line3D::Line3D() : FixedSizePoint3DContainer({Point3D(), Point3D()}) {}
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 Line3D::Line3D(const Point3D& point1, const Point3D& point2) : 
-    FixedSizePoint3DContainer({point1, point2}) {
+    FixedSizePoint3DContainer<2>(array<Point3D, 2>{{point1, point2}}) {
         // Check if the two points are the same
-        if (point1 == point2) {
+        if (Validate(point1, point2) != ErrorCode::NONE) {
             throw invalid_argument("The two points are the same");
         }
     }
@@ -56,17 +82,65 @@ Line3D::Line3D(const Point3D& point1, const Point3D& point2) :
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 Line3D::Line3D(const vector<Point3D>& points) : 
-            FixedSizePoint3DContainer(points) {
+            FixedSizePoint3DContainer<2>(points) {
     // Check if the number of points is not 2
     if (points.size() != 2) {
         throw invalid_argument("Line3D must have 2 points");
     }
     // Check if the two points are the same
-    if (points[0] == points[1]) {
+    if (Validate(points[0], points[1]) != ErrorCode::NONE) {
         throw invalid_argument("The two points are the same");
     }
 }
 
+// -----------------------------------------------------------
+// [name] : Line3D
+// [function] : constructor of the Line3D class without validation
+// [input] : const Point3D& point1, const Point3D& point2, the Unchecked tag
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Line3D::Line3D(const Point3D& point1, const Point3D& point2, Unchecked) : 
+    FixedSizePoint3DContainer<2>(array<Point3D, 2>{{point1, point2}}) {}
+
+// -----------------------------------------------------------
+// [name] : Validate
+// [function] : check if two points make a line
+// [input] : const Point3D& point1, const Point3D& point2
+// [output] : NONE if the points are distinct, NOT_A_LINE otherwise
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Line3D::Validate(const Point3D& point1, const Point3D& point2) {
+    if (point1 == point2) {
+        return ErrorCode::NOT_A_LINE;
+    }
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : Create
+// [function] : build a line from a vector of points without throwing
+// [input] : a vector of Point3D
+// [output] : the line, or NOT_A_LINE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Line3D> Line3D::Create(const vector<Point3D>& points) {
+    // Check if the number of points is not 2
+    if (points.size() != 2) {
+        return ErrorCode::NOT_A_LINE;
+    }
+    // Check if the two points are the same
+    ErrorCode code = Validate(points[0], points[1]);
+    if (code != ErrorCode::NONE) {
+        return code;
+    }
+    // the points are checked, skip the validation of the constructor
+    return Line3D(points[0], points[1], Unchecked());
+}
+
 // -----------------------------------------------------------
 // [name] : operator=
 // [function] : assignment operator of the Line3D class
@@ -197,17 +271,10 @@ Point3D Line3D::Intersection(const Line3D& line) const {
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 bool Line3D::IsParallel(const Line3D& line) const {
-    // Get the vectors for the points on the two lines
-    Vector vector1 = GetPoint(0).ToVector();
-    Vector vector2 = GetPoint(1).ToVector();
-    Vector vector3 = line.GetPoint(0).ToVector();
-    Vector vector4 = line.GetPoint(1).ToVector();
-    // Vector from the first point on the first line to the 
-    // second point on the first line
-    Vector vector5 = vector2 - vector1;
-    Vector vector6 = vector4 - vector3;
-    // Check if the two lines are parallel
-    return vector5.IsParallel(vector6) && !((*this).IsCoincidentTo(line));
+    // the two lines are parallel if the two direction vectors are parallel
+    // and the lines are not coincident
+    return Predicates::IsParallel(At(0), At(1), line.At(0), line.At(1)) &&
+           !Predicates::IsCollinear(At(0), At(1), line.At(0));
 }
 
 // -----------------------------------------------------------
@@ -240,20 +307,11 @@ bool Line3D::IsPerpendicular(const Line3D& line) const {
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 bool Line3D::IsCoincidentTo(const Line3D& line) const {
-    // Get the vectors for the points on the two lines
-    Vector vector1 = GetPoint(0).ToVector();
-    Vector vector2 = GetPoint(1).ToVector();
-    Vector vector3 = line.GetPoint(0).ToVector();
-    Vector vector4 = line.GetPoint(1).ToVector();
-    // Vector from the first point on the first line to the 
-    // second point on the first line
-    Vector vector5 = vector2 - vector1;
-    Vector vector6 = vector4 - vector3;
-    Vector vector7 = vector3 - vector1;
-    // if the two vectors are parallel and the vector from the first point
-    // on the first line to the first point on the second line is parallel to
-    // the two vectors, then the two lines are coincident
-    return vector5.IsParallel(vector6) && vector5.IsParallel(vector7);
+    // if the two direction vectors are parallel and the first point
+    // of the other line is on the current line, then the two lines 
+    // are coincident
+    return Predicates::IsParallel(At(0), At(1), line.At(0), line.At(1)) &&
+           Predicates::IsCollinear(At(0), At(1), line.At(0));
 }
 
 // -----------------------------------------------------------
@@ -469,7 +527,7 @@ void Line3D::SetP2(const Point3D& point) {
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 double Line3D::Length() const {
-    return GetP1().DistanceFrom(GetP2());
+    return At(0).DistanceFrom(At(1));
 }
 
 // -----------------------------------------------------------
@@ -481,14 +539,8 @@ double Line3D::Length() const {
 // [date] : 2024/8/3
 // -----------------------------------------------------------
 bool Line3D::OnSamePlane(const Line3D& line) const {
-    // Get the vectors for the points on the two lines
-    Vector vector1 = GetP1().ToVector() - GetP2().ToVector();
-    Vector vector2 = line.GetP1().ToVector() - line.GetP2().ToVector();
-    Vector vector3 = GetP1().ToVector() - line.GetP1().ToVector();
-    // Check if the three vectors are linearly dependent
-    // if they are linearly dependent, the two lines lie on the same plane
-    return !Vector::IsLinearIndependent(
-        vector<Vector>({vector1, vector2, vector3}));
+    // the two lines lie on the same plane if the four points are coplanar
+    return Predicates::IsCoplanar(At(0), At(1), line.At(0), line.At(1));
 }
 
 // -----------------------------------------------------------
@@ -501,6 +553,6 @@ bool Line3D::OnSamePlane(const Line3D& line) const {
 // -----------------------------------------------------------
 bool Line3D::IsSameSegment(const Line3D& line1, const Line3D& line2) {
     // if the two lines have the same two points, they are the same line segment
-    return line1.GetP1() == line2.GetP1() && line1.GetP2() == line2.GetP2()
-        || line1.GetP1() == line2.GetP2() && line1.GetP2() == line2.GetP1();
+    return (line1.At(0) == line2.At(0) && line1.At(1) == line2.At(1))
+        || (line1.At(0) == line2.At(1) && line1.At(1) == line2.At(0));
 }
@@ -23,6 +23,16 @@
 // reason: to support more operations on lines and points
 //         and to make the line class more useful
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add an unchecked constructor
+// reason: to skip the validation of trusted points in bulk construction
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add Validate and Create, which report errors without exceptions
+// reason: to let the model reject invalid lines without exceptions
+// -----------------------------------------------------------
 
 #ifndef LINE3D_HPP
 #define LINE3D_HPP
@@ -32,6 +42,7 @@
 #include <vector>
 #include "point3d.hpp"
 #include "fixedsizepoint3dcontainer.hpp"
+#include "../Result/result.hpp"
 
 using namespace std;
 
@@ -52,7 +63,7 @@ using namespace std;
 // -----------------------------------------------------------
 
 
-class Line3D : public FixedSizePoint3DContainer
+class Line3D : public FixedSizePoint3DContainer<2>
 {
 public:
     // constructor 0: default constructor
@@ -61,10 +72,17 @@ public:
     Line3D(const Point3D& point1, const Point3D& point2);
     // constructor 2: init with two points in a vector
     Line3D(const vector<Point3D>& points);
+    // constructor 3: init with two trusted points, no validation
+    Line3D(const Point3D& point1, const Point3D& point2, Unchecked);
     // copy constructor
     virtual ~Line3D();
     // assignment operator
     Line3D& operator=(const Line3D& line);
+    // check if two points make a line, NONE or NOT_A_LINE
+    static ErrorCode Validate(const Point3D& point1, const Point3D& point2);
+    // build a line from two points in a vector without throwing,
+    // NOT_A_LINE if there are not two distinct points
+    static Result<Line3D> Create(const vector<Point3D>& points);
 
     // calculate the distance from the current line to a given point.
     double Distance(const Point3D& point) const;
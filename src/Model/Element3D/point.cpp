@@ -10,6 +10,11 @@
 // edit: add implementation of the Point class
 // reason: to support storing the point in the 3D space
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: keep up to INLINE_DIM coordinates in the object
+// reason: a Point3D should not allocate its coordinates on the heap
+// -----------------------------------------------------------
 
 #include "point.hpp"
 #include "vector.hpp"
@@ -31,8 +36,8 @@ using namespace std;
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Point::Point() {
-    m_uiDim = MIN_DIM;
-    m_vrCoords = vector<double>(MIN_DIM);
+    Resize(MIN_DIM);
+    Coords()[0] = 0.0;
 }
 
 
@@ -45,8 +50,23 @@ Point::Point() {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Point::Point(const vector<double>& coords) {
-    m_uiDim = static_cast<unsigned int>(coords.size());
-    m_vrCoords = coords;
+    Assign(coords.data(), static_cast<unsigned int>(coords.size()));
+}
+
+// -----------------------------------------------------------
+// [name] : Point
+// [function] : constructor of a three-dimensional point, the
+//              coordinates are stored in the object
+// [input] : three doubles
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Point::Point(double x, double y, double z) {
+    m_uiDim = 3u;
+    m_rInline[0] = x;
+    m_rInline[1] = y;
+    m_rInline[2] = z;
 }
 
 // -----------------------------------------------------------
@@ -58,8 +78,7 @@ Point::Point(const vector<double>& coords) {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Point::Point(const Point& point) {
-    m_uiDim = point.m_uiDim;
-    m_vrCoords = point.m_vrCoords;
+    Assign(point.Coords(), point.m_uiDim);
 }
 
 // -----------------------------------------------------------
@@ -71,10 +90,10 @@ Point::Point(const Point& point) {
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Point::Point(const Vector& vec) {
-    m_uiDim = vec.Dim;
-    m_vrCoords = vector<double>(m_uiDim);
+    Resize(vec.Dim);
+    double* coords = Coords();
     for (unsigned int i = 0; i < m_uiDim; i++) {
-        m_vrCoords[i] = vec[i];
+        coords[i] = vec[i];
     }
 }
 
@@ -97,11 +116,47 @@ Point::~Point() {}
 // [date] : 2024/8/4
 // -----------------------------------------------------------
 Point& Point::operator=(const Point& point) {
-    m_uiDim = point.m_uiDim;
-    m_vrCoords = point.m_vrCoords;
+    if (this != &point) {
+        Assign(point.Coords(), point.m_uiDim);
+    }
     return *this;
 }
 
+// -----------------------------------------------------------
+// [name] : Resize
+// [function] : changes the dimension of the point, the vector is
+//              only kept for more than INLINE_DIM dimensions
+// [input] : an unsigned int representing the new dimension
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Point::Resize(unsigned int dim) {
+    m_uiDim = dim;
+    if (dim > INLINE_DIM) {
+        m_vrCoords.resize(dim);
+    }
+    else if (!m_vrCoords.empty()) {
+        vector<double>().swap(m_vrCoords);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Assign
+// [function] : sets the dimension and copies the coordinates
+// [input] : a pointer to the coordinates and their number
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Point::Assign(const double* coords, unsigned int dim) {
+    Resize(dim);
+    double* target = Coords();
+    for (unsigned int i = 0; i < dim; i++) {
+        target[i] = coords[i];
+    }
+}
+
 // -----------------------------------------------------------
 // [name] : At
 // [function] : returns the coordinate at a specific index
@@ -122,15 +177,9 @@ double Point::At(unsigned int index) const
         throw invalid_argument("Index out of range");
     }
     // Return the value at the index
-    try {
-        // index - 1 because the input index starts from 1,
-        // but the array index starts from 0.
-        return m_vrCoords.at(index - 1);
-    } 
-    catch (exception& e) {
-        throw runtime_error("Error: " + string(e.what()));
-    }
-    
+    // index - 1 because the input index starts from 1,
+    // but the array index starts from 0.
+    return Coords()[index - 1];
 }
 
 // -----------------------------------------------------------
@@ -166,14 +215,9 @@ double& Point::operator[](unsigned int index)
         throw invalid_argument("Index out of range");
     }
     // Return the reference of the value at the index
-    try {
-        // index - 1 because the input index starts from 1,
-        // but the array index starts from 0.
-        return m_vrCoords.at(index - 1);
-    } 
-    catch (exception& e) {
-        throw runtime_error("Error: " + string(e.what()));
-    }
+    // index - 1 because the input index starts from 1,
+    // but the array index starts from 0.
+    return Coords()[index - 1];
 }
 
 // -----------------------------------------------------------
@@ -194,7 +238,7 @@ void Point::Translate(const Vector& vec)
     }
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        m_vrCoords[i] += vec[i];
+        Coords()[i] += vec[i];
     }
 }
 
@@ -211,7 +255,7 @@ double Point::DistanceFromOrigin() const
     double sum = 0;
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        sum += m_vrCoords[i] * m_vrCoords[i];
+        sum += Coords()[i] * Coords()[i];
     }
     return sqrt(sum);
 }
@@ -235,8 +279,8 @@ double Point::DistanceFrom(const Point& p) const
     double sum = 0;
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        sum += (m_vrCoords[i] - p.m_vrCoords[i]) * 
-            (m_vrCoords[i] - p.m_vrCoords[i]);
+        sum += (Coords()[i] - p.Coords()[i]) * 
+            (Coords()[i] - p.Coords()[i]);
     }
     return sqrt(sum);
 }
@@ -258,7 +302,7 @@ bool Point::operator==(const Point& point) const
     }
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        if (fabs(m_vrCoords[i] - point.m_vrCoords[i]) > 1e-6)
+        if (fabs(Coords()[i] - point.Coords()[i]) > 1e-6)
         {
             return false;
         }
@@ -291,7 +335,7 @@ bool Point::IsOrigin() const
 {
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        if (fabs(m_vrCoords[i]) > 1e-6)
+        if (fabs(Coords()[i]) > 1e-6)
         {
             return false;
         }
@@ -318,7 +362,7 @@ Point Point::Middle(const Point& point) const
     vector<double> coords(m_uiDim);
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        coords[i] = (m_vrCoords[i] + point.m_vrCoords[i]) / 2;
+        coords[i] = (Coords()[i] + point.Coords()[i]) / 2;
     }
     return Point(coords);
 }
@@ -342,7 +386,7 @@ Point Point::Lerp(const Point& point, const double& t) const
     vector<double> coords(m_uiDim);
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        coords[i] = m_vrCoords[i] + t * (point.m_vrCoords[i] - m_vrCoords[i]);
+        coords[i] = Coords()[i] + t * (point.Coords()[i] - Coords()[i]);
     }
     return Point(coords);
 }
@@ -357,7 +401,7 @@ Point Point::Lerp(const Point& point, const double& t) const
 // -----------------------------------------------------------
 Vector Point::ToVector() const
 {
-    return Vector(m_vrCoords);
+    return Vector(vector<double>(Coords(), Coords() + m_uiDim));
 }
 
 // -----------------------------------------------------------
@@ -370,7 +414,7 @@ Vector Point::ToVector() const
 // -----------------------------------------------------------
 Point Point::Copy() const
 {
-    return Point(m_vrCoords);
+    return Point(*this);
 }
 
 // -----------------------------------------------------------
@@ -388,7 +432,7 @@ string Point::ToString() const
     string str = "(";
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        str += to_string(m_vrCoords[i]);
+        str += to_string(Coords()[i]);
         if (i < m_uiDim - 1)
         {
             // Add a comma and a space if it is not the last coordinate
@@ -461,9 +505,9 @@ double Point::AngleFromOrigin(const Point& point1, const Point& point2)
     // Calculate the dot product and the norms of the two points
     for (unsigned int i = 0; i < point1.m_uiDim; i++)
     {
-        dot += point1.m_vrCoords[i] * point2.m_vrCoords[i];
-        norm1 += point1.m_vrCoords[i] * point1.m_vrCoords[i];
-        norm2 += point2.m_vrCoords[i] * point2.m_vrCoords[i];
+        dot += point1.Coords()[i] * point2.Coords()[i];
+        norm1 += point1.Coords()[i] * point1.Coords()[i];
+        norm2 += point2.Coords()[i] * point2.Coords()[i];
     }
     return acos(dot / sqrt(norm1 * norm2));
 }
@@ -564,8 +608,7 @@ string Point::ToString(const Point& point)
 void Point::Set(const vector<double>& coords)
 {
     // cast the size of the vector to unsigned int
-    m_uiDim = static_cast<unsigned int>(coords.size());
-    m_vrCoords = coords;
+    Assign(coords.data(), static_cast<unsigned int>(coords.size()));
 }
 
 // -----------------------------------------------------------
@@ -578,8 +621,10 @@ void Point::Set(const vector<double>& coords)
 // -----------------------------------------------------------
 void Point::Set(const Point& point)
 {
-    m_uiDim = point.m_uiDim;
-    m_vrCoords = point.m_vrCoords;
+    if (this != &point)
+    {
+        Assign(point.Coords(), point.m_uiDim);
+    }
 }
 
 // -----------------------------------------------------------
@@ -592,11 +637,11 @@ void Point::Set(const Point& point)
 // -----------------------------------------------------------
 void Point::Set(const Vector& vec)
 {
-    m_uiDim = vec.Dim;
-    m_vrCoords = vector<double>(m_uiDim);
+    Resize(vec.Dim);
+    double* coords = Coords();
     for (unsigned int i = 0; i < m_uiDim; i++)
     {
-        m_vrCoords[i] = vec[i];
+        coords[i] = vec[i];
     }
 }
 
@@ -25,6 +25,13 @@
 // edit: add string representation for the point class
 // reason: to support the output of the point class in string format
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: keep up to INLINE_DIM coordinates in the object, the vector is
+//       only used for more dimensions
+// reason: every Point3D allocated its three coordinates on the heap, so
+//         a face cost three allocations and a line two
+// -----------------------------------------------------------
 
 #ifndef POINT_HPP
 #define POINT_HPP
@@ -50,6 +57,8 @@ using namespace std;
 // 4. the point class can be converted to a vector object
 // 5. the point class can be copied and converted to a string representation
 // 6. the point class supports output to a stream
+// 7. a point of at most INLINE_DIM dimensions keeps its coordinates in
+//    the object and does not allocate, e.g. every Point3D
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
@@ -144,16 +153,36 @@ public:
     static const unsigned int MAX_DIM {999u};
     // minimum number of dimensions required for a point
     static const unsigned int MIN_DIM {1u};
+    // maximum number of dimensions stored without the heap
+    static const unsigned int INLINE_DIM {3u};
     // reference to the dimension of the point
     const unsigned int& Dim {m_uiDim};
 
     // friend function to output a point to a stream
     friend ostream& operator<<(ostream& os, const Point& point);
 
+protected:
+    // constructor of a three-dimensional point, without a vector
+    Point(double x, double y, double z);
+    // the coordinates, in the object up to INLINE_DIM dimensions
+    const double* Coords() const {
+        return m_uiDim <= INLINE_DIM ? m_rInline : m_vrCoords.data();
+    }
+    double* Coords() {
+        return m_uiDim <= INLINE_DIM ? m_rInline : m_vrCoords.data();
+    }
+
 private:
+    // change the dimension, the coordinates are undefined afterwards
+    void Resize(unsigned int dim);
+    // copy dim coordinates
+    void Assign(const double* coords, unsigned int dim);
+
     // the number of dimensions of the point
     unsigned int m_uiDim;
-    // the coordinates of the point
+    // the coordinates of a point of at most INLINE_DIM dimensions
+    double m_rInline[INLINE_DIM];
+    // the coordinates of a point of more dimensions, empty otherwise
     vector<double> m_vrCoords;
 };
 
@@ -10,6 +10,20 @@
 // edit: add implementation of the Point3D class
 // reason: to support storing the 3D point
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: copy the coordinates of the other point in operator=
+// reason: the base kept the old coordinates, so a modified point still
+//         compared equal to the point it replaced
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: construct the base from three doubles and write the base
+//       coordinate directly in SetX, SetY and SetZ
+// reason: the base keeps the coordinates in the object now, the vector
+//         allocated three doubles for every point, and the setters did
+//         not update the base at all
+// -----------------------------------------------------------
 
 
 #include "point3d.hpp"
@@ -28,7 +42,7 @@ using namespace std;
 // [author] : Huayu Chen
 // [date] : 2024/8/4
 // -----------------------------------------------------------
-Point3D::Point3D() : Point(), m_rX(0), m_rY(0), m_rZ(0) {}
+Point3D::Point3D() : Point(0.0, 0.0, 0.0), m_rX(0), m_rY(0), m_rZ(0) {}
 
 // -----------------------------------------------------------
 // [name] : Point3D
@@ -56,7 +70,7 @@ Point3D::Point3D(const vector<double>& coords) : Point(coords) {
 // [author] : Huayu Chen
 // [date] : 2024/8/4
 // -----------------------------------------------------------
-Point3D::Point3D(double x, double y, double z) : Point(vector<double>{x, y, z}),
+Point3D::Point3D(double x, double y, double z) : Point(x, y, z),
                                     m_rX(x), m_rY(y), m_rZ(z) {}
 
 // -----------------------------------------------------------
@@ -90,13 +104,8 @@ Point3D::~Point3D() {}
 // -----------------------------------------------------------
 void Point3D::SetX(double x) {
     m_rX = x;
-    try {
-        // call the Set function of the base class
-        Point::Set(static_cast<Point>(*this));
-    }
-    catch (exception& e) {
-        throw e;
-    }
+    // the base stores the coordinates of a 3D point in the object
+    Coords()[0] = x;
 }
 
 // -----------------------------------------------------------
@@ -109,13 +118,8 @@ void Point3D::SetX(double x) {
 // -----------------------------------------------------------
 void Point3D::SetY(double y) {
     m_rY = y;
-    try {
-        // call the Set function of the base class
-        Point::Set(static_cast<Point>(*this));
-    }
-    catch (exception& e) {
-        throw e;
-    }
+    // the base stores the coordinates of a 3D point in the object
+    Coords()[1] = y;
 }
 
 // -----------------------------------------------------------
@@ -128,13 +132,8 @@ void Point3D::SetY(double y) {
 // -----------------------------------------------------------
 void Point3D::SetZ(double z) {
     m_rZ = z;
-    try {
-        // call the Set function of the base class
-        Point::Set(static_cast<Point>(*this));
-    }
-    catch (exception& e) {
-        throw e;
-    }
+    // the base stores the coordinates of a 3D point in the object
+    Coords()[2] = z;
 }
 
 // -----------------------------------------------------------
@@ -151,7 +150,7 @@ Point3D& Point3D::operator=(const Point3D& point) {
     m_rZ = point.m_rZ;
     // call the Set function of the base class
     try {
-        Point::Set(static_cast<Point>(*this));
+        Point::Set(static_cast<const Point&>(point));
     }
     catch (exception& e) {
         throw e;
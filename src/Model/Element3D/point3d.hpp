@@ -22,6 +22,12 @@
 // reason: to support more operations on points and lines and faces
 //         and to make the code more readable and efficient
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: keep the coordinates in the base object, the default point is
+//       a three-dimensional origin
+// reason: a Point3D allocated a vector for its three coordinates
+// -----------------------------------------------------------
 
 #ifndef POINT3D_HPP
 #define POINT3D_HPP
@@ -44,6 +50,8 @@ using namespace std;
 //    the point3d class shares some common operations with the Point class
 // 3. there are const reference members for the x, y, and z coordinates
 //    and setter functions for the x, y, and z coordinates
+// 4. a Point3D does not allocate, its coordinates are stored in the 
+//    object by the Point base class
 // [author] : Huayu Chen
 // [date] : 2024/8/2
 // -----------------------------------------------------------
@@ -0,0 +1,366 @@
+// [file name] : predicates.cpp
+// [function] : implement the Predicates class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the Predicates class
+// reason: to support exact and allocation-free geometric predicates
+// -----------------------------------------------------------
+
+// The exact fallback follows the floating-point expansion arithmetic of
+// J. R. Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast
+// Robust Geometric Predicates". An expansion is an array of doubles sorted by
+// increasing magnitude whose exact sum is the represented value, the sign of
+// a zero-eliminated expansion is the sign of its last component.
+
+#include "predicates.hpp"
+#include "point3d.hpp"
+#include <cmath>
+
+using namespace std;
+
+// half of the machine epsilon of double, 2^-53
+static const double EPSILON = 1.1102230246251565e-16;
+// 2^27 + 1, used to split a double into two non-overlapping halves
+static const double SPLITTER = 134217729.0;
+// forward error bound of the 2x2 minor of coordinate differences
+static const double MINOR_ERROR_BOUND = (3.0 + 16.0 * EPSILON) * EPSILON;
+// forward error bound of the 3x3 orientation determinant
+static const double ORIENT_ERROR_BOUND = (7.0 + 56.0 * EPSILON) * EPSILON;
+
+// maximum length of the expansion of a difference of two doubles
+static const int DIFF_LENGTH = 2;
+// maximum length of the expansion of a 2x2 minor of differences
+static const int MINOR_LENGTH = 16;
+// maximum length of one term z * minor of the orientation determinant
+static const int TERM_LENGTH = 2 * DIFF_LENGTH * MINOR_LENGTH;
+// maximum length of the expansion of the orientation determinant
+static const int ORIENT_LENGTH = 3 * TERM_LENGTH;
+
+// -----------------------------------------------------------
+// [name] : TwoSum
+// [function] : compute a + b exactly as x + y, x is the rounded sum
+// [input] : two doubles, references to the outputs
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static inline void TwoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    double bVirtual = x - a;
+    double aVirtual = x - bVirtual;
+    y = (a - aVirtual) + (b - bVirtual);
+}
+
+// -----------------------------------------------------------
+// [name] : FastTwoSum
+// [function] : compute a + b exactly as x + y, requires |a| >= |b|
+// [input] : two doubles, references to the outputs
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static inline void FastTwoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    y = b - (x - a);
+}
+
+// -----------------------------------------------------------
+// [name] : TwoDiff
+// [function] : compute a - b exactly as x + y, x is the rounded difference
+// [input] : two doubles, references to the outputs
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static inline void TwoDiff(double a, double b, double& x, double& y) {
+    x = a - b;
+    double bVirtual = a - x;
+    double aVirtual = x + bVirtual;
+    y = (a - aVirtual) + (bVirtual - b);
+}
+
+// -----------------------------------------------------------
+// [name] : Split
+// [function] : split a into hi + lo, both halves have 26 significant bits
+// [input] : a double, references to the outputs
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static inline void Split(double a, double& hi, double& lo) {
+    double c = SPLITTER * a;
+    double aBig = c - a;
+    hi = c - aBig;
+    lo = a - hi;
+}
+
+// -----------------------------------------------------------
+// [name] : TwoProduct
+// [function] : compute a * b exactly as x + y, x is the rounded product
+// [input] : two doubles, references to the outputs
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static inline void TwoProduct(double a, double b, double& x, double& y) {
+    x = a * b;
+    double aHi, aLo, bHi, bLo;
+    Split(a, aHi, aLo);
+    Split(b, bHi, bLo);
+    double err1 = x - aHi * bHi;
+    double err2 = err1 - aLo * bHi;
+    double err3 = err2 - aHi * bLo;
+    y = aLo * bLo - err3;
+}
+
+// -----------------------------------------------------------
+// [name] : GrowExpansion
+// [function] : add a double to an expansion, zero components are removed
+//              h may be the same array as e
+// [input] : the length of e, the expansion e, a double b, the output h
+// [output] : the length of h, at most elen + 1
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int GrowExpansion(int elen, const double* e, double b, double* h) {
+    double q = b;
+    int hindex = 0;
+    for (int i = 0; i < elen; i++) {
+        double sum, err;
+        TwoSum(q, e[i], sum, err);
+        q = sum;
+        if (err != 0.0) {
+            h[hindex++] = err;
+        }
+    }
+    if (q != 0.0 || hindex == 0) {
+        h[hindex++] = q;
+    }
+    return hindex;
+}
+
+// -----------------------------------------------------------
+// [name] : ScaleExpansion
+// [function] : multiply an expansion by a double, zero components are removed
+// [input] : the length of e, the expansion e, a double b, the output h
+// [output] : the length of h, at most 2 * elen
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int ScaleExpansion(int elen, const double* e, double b, double* h) {
+    double q, err;
+    int hindex = 0;
+    TwoProduct(e[0], b, q, err);
+    if (err != 0.0) {
+        h[hindex++] = err;
+    }
+    for (int i = 1; i < elen; i++) {
+        double product1, product0, sum;
+        TwoProduct(e[i], b, product1, product0);
+        TwoSum(q, product0, sum, err);
+        if (err != 0.0) {
+            h[hindex++] = err;
+        }
+        FastTwoSum(product1, sum, q, err);
+        if (err != 0.0) {
+            h[hindex++] = err;
+        }
+    }
+    if (q != 0.0 || hindex == 0) {
+        h[hindex++] = q;
+    }
+    return hindex;
+}
+
+// -----------------------------------------------------------
+// [name] : AddExpansion
+// [function] : add the expansion f to the expansion h in place
+// [input] : the length of h, the expansion h, the length of f,
+//           the expansion f
+// [output] : the new length of h, at most hlen + flen
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int AddExpansion(int hlen, double* h, int flen, const double* f) {
+    for (int i = 0; i < flen; i++) {
+        hlen = GrowExpansion(hlen, h, f[i], h);
+    }
+    return hlen;
+}
+
+// -----------------------------------------------------------
+// [name] : MinorExpansion
+// [function] : compute (p2x-p1x)*(q2y-q1y) - (p2y-p1y)*(q2x-q1x) exactly
+// [input] : the coordinates of the four points, the output h
+//           with room for MINOR_LENGTH doubles
+// [output] : the length of h
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int MinorExpansion(double p1x, double p1y, double p2x, double p2y,
+                          double q1x, double q1y, double q2x, double q2y,
+                          double* h) {
+    // the four differences as two-component expansions
+    double ux[DIFF_LENGTH], uy[DIFF_LENGTH], vx[DIFF_LENGTH], vy[DIFF_LENGTH];
+    TwoDiff(p2x, p1x, ux[1], ux[0]);
+    TwoDiff(p2y, p1y, uy[1], uy[0]);
+    TwoDiff(q2x, q1x, vx[1], vx[0]);
+    TwoDiff(q2y, q1y, vy[1], vy[0]);
+    // ux * vy
+    double part[2 * DIFF_LENGTH];
+    int hlen = ScaleExpansion(DIFF_LENGTH, ux, vy[0], h);
+    int plen = ScaleExpansion(DIFF_LENGTH, ux, vy[1], part);
+    hlen = AddExpansion(hlen, h, plen, part);
+    // - uy * vx
+    plen = ScaleExpansion(DIFF_LENGTH, uy, -vx[0], part);
+    hlen = AddExpansion(hlen, h, plen, part);
+    plen = ScaleExpansion(DIFF_LENGTH, uy, -vx[1], part);
+    hlen = AddExpansion(hlen, h, plen, part);
+    return hlen;
+}
+
+// -----------------------------------------------------------
+// [name] : AddOrientTerm
+// [function] : add (az - dz) * minor to the expansion h in place
+// [input] : the length of h, the expansion h, two z coordinates,
+//           the length of the minor, the minor expansion
+// [output] : the new length of h
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int AddOrientTerm(int hlen, double* h, double az, double dz,
+                         int mlen, const double* minor) {
+    double z[DIFF_LENGTH];
+    TwoDiff(az, dz, z[1], z[0]);
+    double part[2 * MINOR_LENGTH];
+    for (int i = 0; i < DIFF_LENGTH; i++) {
+        int plen = ScaleExpansion(mlen, minor, z[i], part);
+        hlen = AddExpansion(hlen, h, plen, part);
+    }
+    return hlen;
+}
+
+// -----------------------------------------------------------
+// [name] : Sign
+// [function] : get the sign of a double
+// [input] : a double
+// [output] : 1, -1 or 0
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static inline int Sign(double value) {
+    return (value > 0.0) - (value < 0.0);
+}
+
+// -----------------------------------------------------------
+// [name] : Minor2D
+// [function] : get the sign of (p2x-p1x)*(q2y-q1y) - (p2y-p1y)*(q2x-q1x)
+// [input] : the coordinates of the four points
+// [output] : 1, -1 or 0
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+int Predicates::Minor2D(double p1x, double p1y, double p2x, double p2y,
+                        double q1x, double q1y, double q2x, double q2y) {
+    // fast floating-point filter
+    double left = (p2x - p1x) * (q2y - q1y);
+    double right = (p2y - p1y) * (q2x - q1x);
+    double det = left - right;
+    double errorBound = MINOR_ERROR_BOUND * (fabs(left) + fabs(right));
+    if (det > errorBound || -det > errorBound) {
+        return Sign(det);
+    }
+    // exact fallback
+    double minor[MINOR_LENGTH];
+    int length = MinorExpansion(p1x, p1y, p2x, p2y,
+                                q1x, q1y, q2x, q2y, minor);
+    return Sign(minor[length - 1]);
+}
+
+// -----------------------------------------------------------
+// [name] : Orient3D
+// [function] : get the orientation of the point d to the plane
+//              through a, b and c
+// [input] : four Point3D objects
+// [output] : 1 if d is below the plane, -1 if above, 0 if coplanar
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+int Predicates::Orient3D(const Point3D& a, const Point3D& b,
+                         const Point3D& c, const Point3D& d) {
+    // fast floating-point filter
+    double adx = a.X - d.X, ady = a.Y - d.Y, adz = a.Z - d.Z;
+    double bdx = b.X - d.X, bdy = b.Y - d.Y, bdz = b.Z - d.Z;
+    double cdx = c.X - d.X, cdy = c.Y - d.Y, cdz = c.Z - d.Z;
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady, adxcdy = adx * cdy;
+    double adxbdy = adx * bdy, bdxady = bdx * ady;
+    double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy)
+               + cdz * (adxbdy - bdxady);
+    double permanent = (fabs(bdxcdy) + fabs(cdxbdy)) * fabs(adz)
+                     + (fabs(cdxady) + fabs(adxcdy)) * fabs(bdz)
+                     + (fabs(adxbdy) + fabs(bdxady)) * fabs(cdz);
+    double errorBound = ORIENT_ERROR_BOUND * permanent;
+    if (det > errorBound || -det > errorBound) {
+        return Sign(det);
+    }
+    // exact fallback
+    double bc[MINOR_LENGTH], ca[MINOR_LENGTH], ab[MINOR_LENGTH];
+    int bclen = MinorExpansion(d.X, d.Y, b.X, b.Y, d.X, d.Y, c.X, c.Y, bc);
+    int calen = MinorExpansion(d.X, d.Y, c.X, c.Y, d.X, d.Y, a.X, a.Y, ca);
+    int ablen = MinorExpansion(d.X, d.Y, a.X, a.Y, d.X, d.Y, b.X, b.Y, ab);
+    double orient[ORIENT_LENGTH];
+    int length = 0;
+    length = AddOrientTerm(length, orient, a.Z, d.Z, bclen, bc);
+    length = AddOrientTerm(length, orient, b.Z, d.Z, calen, ca);
+    length = AddOrientTerm(length, orient, c.Z, d.Z, ablen, ab);
+    return Sign(orient[length - 1]);
+}
+
+// -----------------------------------------------------------
+// [name] : IsCoplanar
+// [function] : check if four points lie on the same plane
+// [input] : four Point3D objects
+// [output] : a bool value
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Predicates::IsCoplanar(const Point3D& a, const Point3D& b,
+                            const Point3D& c, const Point3D& d) {
+    return Orient3D(a, b, c, d) == 0;
+}
+
+// -----------------------------------------------------------
+// [name] : IsCollinear
+// [function] : check if three points lie on the same line
+// [input] : three Point3D objects
+// [output] : a bool value
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Predicates::IsCollinear(const Point3D& a, const Point3D& b,
+                             const Point3D& c) {
+    return IsParallel(a, b, a, c);
+}
+
+// -----------------------------------------------------------
+// [name] : IsParallel
+// [function] : check if the direction p2-p1 is parallel to q2-q1
+// [input] : four Point3D objects
+// [output] : a bool value
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Predicates::IsParallel(const Point3D& p1, const Point3D& p2,
+                            const Point3D& q1, const Point3D& q2) {
+    // the two directions are parallel if all three components
+    // of their cross product are zero
+    return Minor2D(p1.Y, p1.Z, p2.Y, p2.Z, q1.Y, q1.Z, q2.Y, q2.Z) == 0
+        && Minor2D(p1.Z, p1.X, p2.Z, p2.X, q1.Z, q1.X, q2.Z, q2.X) == 0
+        && Minor2D(p1.X, p1.Y, p2.X, p2.Y, q1.X, q1.Y, q2.X, q2.Y) == 0;
+}
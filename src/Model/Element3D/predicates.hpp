@@ -0,0 +1,67 @@
+// [file name] : predicates.hpp
+// [function] : declare the Predicates class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init predicates class
+//       add orientation, coplanarity, collinearity and parallelism tests
+// reason: the coplanarity and collinearity checks of lines and faces went
+//         through Vector::IsLinearIndependent, which allocates a matrix and
+//         gives wrong answers on zero components
+// -----------------------------------------------------------
+
+#ifndef PREDICATES_HPP
+#define PREDICATES_HPP
+
+#include "point3d.hpp"
+
+using namespace std;
+
+// notes about the class Predicates
+// -----------------------------------------------------------
+// [class name] : Predicates
+// [function] : robust geometric predicates on 3D points
+// [notes on interface] :
+// 1. all functions are static, the class only groups the predicates
+// 2. every predicate first evaluates the expression in floating point and
+//    compares it with a forward error bound, only when the result is too
+//    close to zero to be trusted, the expression is evaluated again with
+//    exact floating-point expansion arithmetic
+// 3. the answers are exact for the given coordinates, no tolerance is used
+// 4. no function allocates memory on the heap
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class Predicates
+{
+public:
+    // sign of the determinant | a-d ; b-d ; c-d |
+    // returns 1 if d lies below the plane through a, b, c (the three points
+    // appear counterclockwise seen from above), -1 if above, 0 if coplanar
+    static int Orient3D(const Point3D& a, const Point3D& b,
+                        const Point3D& c, const Point3D& d);
+    // check if four points lie on the same plane
+    static bool IsCoplanar(const Point3D& a, const Point3D& b,
+                           const Point3D& c, const Point3D& d);
+    // check if three points lie on the same line
+    // uses the three components of the cross product (b-a) x (c-a)
+    static bool IsCollinear(const Point3D& a, const Point3D& b,
+                            const Point3D& c);
+    // check if the direction p2-p1 is parallel to the direction q2-q1
+    static bool IsParallel(const Point3D& p1, const Point3D& p2,
+                           const Point3D& q1, const Point3D& q2);
+
+private:
+    // no instance is needed
+    Predicates() = delete;
+    // sign of (p2x-p1x)*(q2y-q1y) - (p2y-p1y)*(q2x-q1x)
+    static int Minor2D(double p1x, double p1y, double p2x, double p2y,
+                       double q1x, double q1y, double q2x, double q2y);
+};
+
+#endif // PREDICATES_HPP
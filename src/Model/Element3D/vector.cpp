@@ -10,6 +10,11 @@
 // edit: add implementation of the Vector class
 // reason: to support storing the vector in the 3D space
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: check parallelism with 2x2 minors instead of ratios in IsParallel
+// reason: the ratios divided by zero when a component was zero
+// -----------------------------------------------------------
 
 #include "vector.hpp"
 #include <vector>
@@ -243,11 +248,16 @@ bool Vector::IsParallel(const Vector& vec) const {
     if (m_uiDim != vec.m_uiDim) {
         throw invalid_argument("Vectors must have the same dimension");
     }
-    double scalar = data[0] / vec.data[0];
-    for (unsigned int i = 1; i < m_uiDim; i++) {
-        // check if the ratio of the corresponding components is the same
-        if (fabs(data[i] / vec.data[i] - scalar) > 1e-6) {
-            return false;
+    // the two vectors are parallel if every 2x2 minor 
+    // a[i] * b[j] - a[j] * b[i] vanishes, the tolerance is
+    // relative to the lengths of the two vectors
+    double tolerance = 1e-6 * Length() * vec.Length();
+    for (unsigned int i = 0; i < m_uiDim; i++) {
+        for (unsigned int j = i + 1; j < m_uiDim; j++) {
+            if (fabs(data[i] * vec.data[j] - data[j] * vec.data[i]) 
+                    > tolerance) {
+                return false;
+            }
         }
     }
     return true;
@@ -10,9 +10,20 @@
 // edit: add implementation of the Model3DImporter class
 // reason: to support importing 3D models
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoad function
+// reason: to report import failures as error codes instead of exceptions
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoad with a Progress
+// reason: to show the progress of a long import and to cancel it
+// -----------------------------------------------------------
 // This is the implementation of the Model3DImporter class.
 // This class is used to import 3D models.
 #include "model3dimporter.hpp"
+#include <stdexcept>
 
 using namespace std;
 
@@ -48,4 +59,38 @@ Model3D Model3DImporter::Load(const string& path) const {
     vector<Face3D> faces = LoadFaces(path);
     vector<Line3D> lines = LoadLines(path);
     return Model3D(faces, lines);
-}
\ No newline at end of file
+}
+
+// -----------------------------------------------------------
+// [name] : TryLoad
+// [function] : loads a 3D model from a given file path without throwing
+// [input] : a string representing the file path
+// [output] : the loaded Model3D object, or PARSE_FAILED
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Model3D> Model3DImporter::TryLoad(const string& path) const {
+    // fallback for importers that only implement the throwing functions
+    try {
+        return Load(path);
+    } catch (const exception&) {
+        return ErrorCode::PARSE_FAILED;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : TryLoad
+// [function] : loads a 3D model and reports the progress
+// [input] : a string representing the file path, the progress or nullptr
+// [output] : the loaded Model3D object, or the error code
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Model3D> Model3DImporter::TryLoad(const string& path, 
+                                         Progress* progress) const {
+    // importers without progress can still be cancelled before they start
+    if (progress && progress->IsCancelled()) {
+        return ErrorCode::CANCELLED;
+    }
+    return TryLoad(path);
+}
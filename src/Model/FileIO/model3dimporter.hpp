@@ -11,6 +11,16 @@
 //       add Load function
 // reason: to support importing 3D models from files
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoad function
+// reason: to report import failures as error codes instead of exceptions
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoad with a Progress
+// reason: to show the progress of a long import and to cancel it
+// -----------------------------------------------------------
 
 #ifndef IMPORTER_HPP
 #define IMPORTER_HPP
@@ -20,6 +30,8 @@
 #include "../Model3D/model3d.hpp"
 #include "../Element3D/face3d.hpp"
 #include "../Element3D/line3d.hpp"
+#include "../Result/result.hpp"
+#include "../Progress/progress.hpp"
 
 using namespace std;
 
@@ -33,6 +45,13 @@ using namespace std;
 // 3. The LoadFaces and LoadLines functions are pure virtual functions that need
 //    to be implemented by derived classes.
 // 4. The Load function is a virtual function that loads a 3D model from a file.
+// 5. The TryLoad function loads a 3D model without throwing, failures are 
+//    returned as error codes. The default version catches the exceptions
+//    of Load, derived classes should override it with a version that 
+//    does not throw at all.
+// 6. TryLoad with a Progress reports the bytes read and the faces and
+//    lines built, and returns CANCELLED once the progress is cancelled.
+//    the progress may be nullptr. the default version ignores it
 // [author] : Huayu Chen
 // [date] : 2024/7/31
 // -----------------------------------------------------------
@@ -48,6 +67,11 @@ public:
 
     // load a 3D model from a file
     virtual Model3D Load(const string& path) const;
+    // load a 3D model from a file, return an error code on failure
+    virtual Result<Model3D> TryLoad(const string& path) const;
+    // load a 3D model from a file and report the progress
+    virtual Result<Model3D> TryLoad(const string& path, 
+                                    Progress* progress) const;
     // load faces from a file
     // this function needs to be implemented by derived classes
     virtual vector<Face3D> LoadFaces(const string& path) const = 0;
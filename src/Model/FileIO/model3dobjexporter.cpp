@@ -10,10 +10,24 @@
 // edit: add implementation of the Model3DObjExporter class
 // reason: to support exporting 3D models to OBJ files
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add trace spans to the phases of Save
+// reason: to see which phase of a slow export takes the time
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: format the vertices, faces and lines in blocks on the
+//       TaskScheduler, write the blocks in order
+// reason: looking up the indices of the points is most of the time of
+//         a big export, and every row was flushed on its own
+// -----------------------------------------------------------
 
 
 
 #include "model3dobjexporter.hpp"
+#include "../Trace/tracer.hpp"
+#include "../Parallel/taskscheduler.hpp"
 
 #include <algorithm>
 #include <fstream>
@@ -22,6 +36,71 @@
 
 using namespace std;
 
+// rows formatted by one task, and blocks formatted before they are
+// written, so a big model is not held in memory as text
+static const size_t ROWS_PER_BLOCK = 1024;
+static const size_t BLOCKS_PER_PASS = 64;
+
+// -----------------------------------------------------------
+// [name] : WriteRows
+// [function] : format rows in blocks on the TaskScheduler and write
+//              them in order
+// [input] : the file, the number of rows, the function appending row i
+//           to a string
+// [output] : none, throws the first exception of format
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <typename Format>
+static void WriteRows(ofstream& file, size_t count, const Format& format) {
+    TaskScheduler& scheduler = TaskScheduler::GetInstance();
+    vector<string> blocks;
+    for (size_t pass = 0; pass < count;
+         pass += ROWS_PER_BLOCK * BLOCKS_PER_PASS) {
+        size_t end = min(count, pass + ROWS_PER_BLOCK * BLOCKS_PER_PASS);
+        blocks.assign((end - pass + ROWS_PER_BLOCK - 1) / ROWS_PER_BLOCK,
+                      string());
+        scheduler.ParallelFor(0, blocks.size(), 1,
+                              [&](size_t first, size_t last) {
+            for (size_t block = first; block < last; block++) {
+                size_t row = pass + block * ROWS_PER_BLOCK;
+                size_t stop = min(end, row + ROWS_PER_BLOCK);
+                for (; row < stop; row++) {
+                    format(row, blocks[block]);
+                }
+            }
+        });
+        for (const string& block : blocks) {
+            file << block;
+        }
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : AppendIndices
+// [function] : append the row of a face or a line, the 1-based indices
+//              of its points in the vertices
+// [input] : the tag of the row, the points, the vertices, the string
+// [output] : none, throws runtime_error for a point not in the vertices
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void AppendIndices(const char* tag, const vector<Point3D>& points,
+                          const vector<Point3D>& vertices, string& row) {
+    row += tag;
+    for (const Point3D& vertex : points) {
+        auto it = find(vertices.begin(), vertices.end(), vertex);
+        // Check if the vertex is in the list
+        if (it == vertices.end()) {
+            throw runtime_error("Failed to export the 3D model.");
+        }
+        row += ' ';
+        row += to_string(distance(vertices.begin(), it) + 1);
+        row += ' ';
+    }
+    row += '\n';
+}
+
 // -----------------------------------------------------------
 // [name] : Model3DObjExporter
 // [function] : Constructor for Model3DObjExporter class
@@ -51,6 +130,7 @@ Model3DObjExporter::~Model3DObjExporter() {}
 // [date] : 2024/8/5
 // -----------------------------------------------------------
 void Model3DObjExporter::Save(const string& path, const Model3D& model) const {
+    TRACE_SCOPE("export", "Save");
 
     ofstream file(path);
     // Check if the file is opened successfully
@@ -73,35 +153,29 @@ void Model3DObjExporter::Save(const string& path, const Model3D& model) const {
     // List all distinct vertices
     vector<Point3D> vertices = ListDistinctVertices(model);
     // Write the vertices to the file
-    for (const Point3D& vertex : vertices) {
-        file << "v  " << to_string(vertex.X) << " " << 
-            to_string(vertex.Y) << " " << to_string(vertex.Z) << endl;
+    {
+        TRACE_SCOPE("export", "write vertices");
+        WriteRows(file, vertices.size(), [&](size_t i, string& row) {
+            row += "v  " + to_string(vertices[i].X) + " " +
+                to_string(vertices[i].Y) + " " + to_string(vertices[i].Z);
+            row += '\n';
+        });
     }
     // Write the faces to the file
-    for (const shared_ptr<Face3D>& face : model.GetFaces()) {
-        file << "f ";
-        for (const Point3D& vertex : face->GetPoints()) {
-            auto it = find(vertices.begin(), vertices.end(), vertex);
-            // Check if the vertex is in the list
-            if (it == vertices.end()) {
-                throw runtime_error("Failed to export the 3D model.");
-            }
-            file << " " << distance(vertices.begin(), it) + 1 << " ";
-        }
-        file << endl;
+    {
+        TRACE_SCOPE("export", "write faces");
+        const vector<shared_ptr<Face3D>>& faces = model.GetFaces();
+        WriteRows(file, faces.size(), [&](size_t i, string& row) {
+            AppendIndices("f ", faces[i]->GetPoints(), vertices, row);
+        });
     }
     // Write the lines to the file
-    for (const shared_ptr<Line3D>& line : model.GetLines()) {
-        file << "l ";
-        for (const Point3D& vertex : line->GetPoints()) {
-            auto it = find(vertices.begin(), vertices.end(), vertex);
-            // Check if the vertex is in the list
-            if (it == vertices.end()) {
-                throw runtime_error("Failed to export the 3D model.");
-            }
-            file << " " << distance(vertices.begin(), it) + 1 << " ";
-        }
-        file << endl;
+    {
+        TRACE_SCOPE("export", "write lines");
+        const vector<shared_ptr<Line3D>>& lines = model.GetLines();
+        WriteRows(file, lines.size(), [&](size_t i, string& row) {
+            AppendIndices("l ", lines[i]->GetPoints(), vertices, row);
+        });
     }
     file.close();
 }
@@ -116,6 +190,7 @@ void Model3DObjExporter::Save(const string& path, const Model3D& model) const {
 // -----------------------------------------------------------
 vector<Point3D> Model3DObjExporter::ListDistinctVertices(
                         const Model3D& model) const {
+    TRACE_SCOPE("export", "ListDistinctVertices");
     vector<Point3D> vertices;
     // List all vertices in the faces
     for (const shared_ptr<Face3D>& face : model.GetFaces()) {
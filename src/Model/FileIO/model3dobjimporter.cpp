@@ -10,12 +10,168 @@
 // edit: add implementation of the Model3DObjImporter class
 // reason: to support importing OBJ files
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoad function, build Load on it
+// reason: to report import failures as error codes instead of exceptions
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoad with a Progress
+// reason: to show the progress of a long import and to cancel it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add trace spans to the phases of TryLoad
+// reason: to see which phase of a slow import takes the time
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: validate the faces and lines on the TaskScheduler, build them
+//       after all of them are valid
+// reason: the validation is most of the time of a big import after
+//         the file is read
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoadStatistics
+// reason: the statistics of a file built the whole model only to sum
+//         its areas and lengths
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: sum the enclosed volume in TryLoadStatistics
+// reason: the statistics of a model have the enclosed volume too
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: validate the faces and lines with Element3DValidator
+// reason: the chunks were checked one element at a time, the validator
+//         compares the points of a whole chunk in contiguous arrays
+// -----------------------------------------------------------
 
 #include "model3dobjimporter.hpp"
+#include "../Trace/tracer.hpp"
+#include "../Parallel/taskscheduler.hpp"
+#include "../Element3D/element3dvalidator.hpp"
 #include <fstream>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
 
 using namespace std;
 
+// the progress is updated once per this many lines or elements,
+// so the shared counters are not touched for every line
+static const unsigned int PROGRESS_INTERVAL = 4096;
+
+// -----------------------------------------------------------
+// [name] : FirstDefect
+// [function] : turn the first report of a chunk into an error code
+// [input] : the reports of the validator, the error of duplicate points
+// [output] : NONE if there is no report, PARSE_FAILED for a bad index
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static ErrorCode FirstDefect(const vector<Element3DValidator::Report>& reports,
+                             ErrorCode duplicate) {
+    if (reports.empty()) {
+        return ErrorCode::NONE;
+    }
+    if (reports.front().Kind == Element3DValidator::Defect::BAD_INDEX) {
+        return ErrorCode::PARSE_FAILED;
+    }
+    return duplicate;
+}
+
+// -----------------------------------------------------------
+// [name] : FirstError
+// [function] : combine the errors of two consecutive chunks
+// [input] : the error of the earlier chunk, the one of the later chunk
+// [output] : the first error that is not NONE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static ErrorCode FirstError(ErrorCode earlier, ErrorCode later) {
+    return earlier != ErrorCode::NONE ? earlier : later;
+}
+
+// a vertex of the file while only the statistics are computed
+using Vertex = array<double, 3>;
+
+// notes on the class CompensatedSum
+// -----------------------------------------------------------
+// [class name] : CompensatedSum
+// [function] : add many values keeping the part rounded off (Kahan)
+// [notes on interface] :
+// 1. Add adds a value, Total returns the corrected sum
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class CompensatedSum
+{
+public:
+    // constructor, the sum is zero
+    CompensatedSum() : m_sum(0.0), m_error(0.0) {}
+    // add a value
+    void Add(double value) {
+        double corrected = value - m_error;
+        double sum = m_sum + corrected;
+        m_error = (sum - m_sum) - corrected;
+        m_sum = sum;
+    }
+    // the sum of all values
+    double Total() const {
+        return m_sum - m_error;
+    }
+
+private:
+    // private member variables
+    double m_sum;
+    double m_error;
+};
+
+// -----------------------------------------------------------
+// [name] : SamePoint
+// [function] : compare two vertices as Point::operator== does
+// [input] : the two vertices
+// [output] : false if a coordinate differs by more than 1e-6
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool SamePoint(const Vertex& a, const Vertex& b) {
+    for (unsigned int axis = 0; axis < 3; axis++) {
+        if (fabs(a[axis] - b[axis]) > 1e-6) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Widen
+// [function] : widen the bounds of the statistics to contain a vertex
+// [input] : the vertex, the statistics
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void Widen(const Vertex& point, Model3D::Statistics& statistics) {
+    for (unsigned int axis = 0; axis < 3; axis++) {
+        double value = point[axis];
+        statistics.Min[axis] = value < statistics.Min[axis] 
+                             ? value : statistics.Min[axis];
+        statistics.Max[axis] = value > statistics.Max[axis] 
+                             ? value : statistics.Max[axis];
+    }
+}
+
 // -----------------------------------------------------------
 // [name] : Model3DObjImporter
 // [function] : Constructor for Model3DObjImporter class
@@ -46,24 +202,431 @@ Model3DObjImporter::~Model3DObjImporter() {}
 // [date] : 2024/8/5
 // -----------------------------------------------------------
 Model3D Model3DObjImporter::Load(const string& path) const {
+    Result<Model3D> result = TryLoad(path);
+    if (result.IsOk()) {
+        return move(result.GetValue());
+    }
+    ErrorCode code = result.GetError();
+    // a bad path is an invalid argument
+    if (code == ErrorCode::EMPTY_PATH || code == ErrorCode::NOT_OBJ_PATH) {
+        throw invalid_argument(ErrorMessage(code));
+    }
+    throw runtime_error(string("Failed to load the obj file: ") + 
+                        ErrorMessage(code));
+}
+
+// -----------------------------------------------------------
+// [name] : TryLoad
+// [function] : Loads a 3D model from a given path without throwing
+// [input] : a string representing the path to the OBJ file
+// [output] : the Model3D object, or EMPTY_PATH, NOT_OBJ_PATH, 
+//            OPEN_FILE_FAILED, PARSE_FAILED, NOT_A_FACE, NOT_A_LINE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Model3D> Model3DObjImporter::TryLoad(const string& path) const {
+    return TryLoad(path, nullptr);
+}
+
+// -----------------------------------------------------------
+// [name] : TryLoad
+// [function] : Loads a 3D model from a given path without throwing
+//              and reports the progress
+// [input] : a string representing the path to the OBJ file,
+//           the progress or nullptr
+// [output] : the Model3D object, or EMPTY_PATH, NOT_OBJ_PATH, 
+//            OPEN_FILE_FAILED, PARSE_FAILED, NOT_A_FACE, NOT_A_LINE,
+//            CANCELLED
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Model3D> Model3DObjImporter::TryLoad(const string& path, 
+                                            Progress* progress) const {
+    TRACE_SCOPE("import", "TryLoad");
     // Check if the path is empty
     if (path.empty()) {
-        throw invalid_argument("Path should not be empty.");
+        return ErrorCode::EMPTY_PATH;
+    }
+    // Check if the file is an obj file
+    if (path.substr(path.find_last_of(".") + 1) != "obj") {
+        return ErrorCode::NOT_OBJ_PATH;
+    }
+    ifstream file(path);
+    // Check if the file is open
+    if (!file.is_open()) {
+        return ErrorCode::OPEN_FILE_FAILED;
+    }
+    if (progress) {
+        // the size of the file, to show the share already read
+        file.seekg(0, ios::end);
+        streamoff size = file.tellg();
+        file.seekg(0, ios::beg);
+        progress->SetTotalBytes(size > 0 ? static_cast<uint64_t>(size) : 0);
+    }
+    // Read the file once, faces and lines may refer to vertices
+    // defined after them, so only their indices are kept in this pass
+    vector<Point3D> vertices;
+    vector<array<int, 3>> faceIndices;
+    vector<array<int, 2>> lineIndices;
+    string name;
+    bool hasName = false;
+    string line;
+    unsigned int linesRead = 0;
+    uint64_t bytesRead = 0;
+    {
+        // the file is read line by line, so reading and parsing are one span
+        TRACE_SCOPE("import", "read and parse lines");
+        while (getline(file, line)) {
+            // count the newline as well
+            bytesRead += line.size() + 1;
+            if (progress && ++linesRead == PROGRESS_INTERVAL) {
+                progress->AddBytes(bytesRead);
+                bytesRead = 0;
+                linesRead = 0;
+                if (progress->IsCancelled()) {
+                    return ErrorCode::CANCELLED;
+                }
+            }
+            if (line.compare(0, 2, "v ") == 0) {
+                double x, y, z;
+                if (sscanf(line.c_str(), "v  %lf  %lf  %lf", 
+                           &x, &y, &z) != 3) {
+                    return ErrorCode::PARSE_FAILED;
+                }
+                vertices.push_back(Point3D(x, y, z));
+            }
+            else if (line.compare(0, 2, "f ") == 0) {
+                array<int, 3> indices;
+                if (sscanf(line.c_str(), "f  %d  %d  %d", 
+                            &indices[0], &indices[1], &indices[2]) != 3) {
+                    return ErrorCode::PARSE_FAILED;
+                }
+                faceIndices.push_back(indices);
+            }
+            else if (line.compare(0, 2, "l ") == 0) {
+                array<int, 2> indices;
+                if (sscanf(line.c_str(), "l  %d  %d", 
+                            &indices[0], &indices[1]) != 2) {
+                    return ErrorCode::PARSE_FAILED;
+                }
+                lineIndices.push_back(indices);
+            }
+            else if (!hasName && line.compare(0, 2, "g ") == 0) {
+                // the first group name is the name of the model
+                name = line.substr(2);
+                hasName = true;
+            }
+        }
+    }
+    if (progress) {
+        progress->AddBytes(bytesRead);
+    }
+    // Note that OBJ files use 1-based indexing
+    TaskScheduler& scheduler = TaskScheduler::GetInstance();
+    {
+        TRACE_SCOPE("import", "validate faces");
+        // the chunks are checked at once, the first bad face of the file
+        // decides the error as before
+        ErrorCode code = scheduler.ParallelReduce(
+            0, faceIndices.size(), PROGRESS_INTERVAL, ErrorCode::NONE,
+            [&](size_t first, size_t last) {
+                if (progress && progress->IsCancelled()) {
+                    return ErrorCode::CANCELLED;
+                }
+                return FirstDefect(Element3DValidator::ValidateFaces(
+                                       vertices, faceIndices, first, last),
+                                   ErrorCode::NOT_A_FACE);
+            }, FirstError);
+        if (code != ErrorCode::NONE) {
+            return code;
+        }
+    }
+    {
+        TRACE_SCOPE("import", "validate lines");
+        ErrorCode code = scheduler.ParallelReduce(
+            0, lineIndices.size(), PROGRESS_INTERVAL, ErrorCode::NONE,
+            [&](size_t first, size_t last) {
+                if (progress && progress->IsCancelled()) {
+                    return ErrorCode::CANCELLED;
+                }
+                return FirstDefect(Element3DValidator::ValidateLines(
+                                       vertices, lineIndices, first, last),
+                                   ErrorCode::NOT_A_LINE);
+            }, FirstError);
+        if (code != ErrorCode::NONE) {
+            return code;
+        }
+    }
+    vector<Face3D> faces;
+    faces.reserve(faceIndices.size());
+    {
+        TRACE_SCOPE("import", "build faces");
+        for (const array<int, 3>& indices : faceIndices) {
+            faces.push_back(Face3D(vertices[indices[0] - 1],
+                                   vertices[indices[1] - 1],
+                                   vertices[indices[2] - 1], Unchecked()));
+            if (progress && faces.size() % PROGRESS_INTERVAL == 0) {
+                progress->AddFaces(PROGRESS_INTERVAL);
+                if (progress->IsCancelled()) {
+                    return ErrorCode::CANCELLED;
+                }
+            }
+        }
+    }
+    if (progress) {
+        progress->AddFaces(faces.size() % PROGRESS_INTERVAL);
+    }
+    vector<Line3D> lines;
+    lines.reserve(lineIndices.size());
+    {
+        TRACE_SCOPE("import", "build lines");
+        for (const array<int, 2>& indices : lineIndices) {
+            lines.push_back(Line3D(vertices[indices[0] - 1],
+                                   vertices[indices[1] - 1], Unchecked()));
+            if (progress && lines.size() % PROGRESS_INTERVAL == 0) {
+                progress->AddLines(PROGRESS_INTERVAL);
+                if (progress->IsCancelled()) {
+                    return ErrorCode::CANCELLED;
+                }
+            }
+        }
     }
+    if (progress) {
+        progress->AddLines(lines.size() % PROGRESS_INTERVAL);
+    }
+    return Model3D(move(faces), move(lines), name);
+}
 
+// -----------------------------------------------------------
+// [name] : TryLoadStatistics
+// [function] : compute the statistics of an OBJ file without building
+//              the model
+// [input] : a string representing the path to the OBJ file
+// [output] : the statistics, or EMPTY_PATH, NOT_OBJ_PATH, 
+//            OPEN_FILE_FAILED, PARSE_FAILED, NOT_A_FACE, NOT_A_LINE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Model3D::Statistics> Model3DObjImporter::TryLoadStatistics(
+            const string& path) const {
+    return TryLoadStatistics(path, nullptr);
+}
+
+// -----------------------------------------------------------
+// [name] : TryLoadStatistics
+// [function] : compute the statistics of an OBJ file in one pass
+//              without building the model and report the progress
+// [input] : a string representing the path to the OBJ file,
+//           the progress or nullptr
+// [output] : the statistics, or the errors of TryLoad for the file,
+//            EMPTY_PATH, NOT_OBJ_PATH, OPEN_FILE_FAILED, PARSE_FAILED,
+//            NOT_A_FACE, NOT_A_LINE, CANCELLED
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<Model3D::Statistics> Model3DObjImporter::TryLoadStatistics(
+            const string& path, Progress* progress) const {
+    TRACE_SCOPE("import", "TryLoadStatistics");
+    // Check if the path is empty
+    if (path.empty()) {
+        return ErrorCode::EMPTY_PATH;
+    }
     // Check if the file is an obj file
     if (path.substr(path.find_last_of(".") + 1) != "obj") {
-        throw invalid_argument("Path is not a valid OBJ file.");
+        return ErrorCode::NOT_OBJ_PATH;
+    }
+    ifstream file(path);
+    // Check if the file is open
+    if (!file.is_open()) {
+        return ErrorCode::OPEN_FILE_FAILED;
     }
-    // load the faces and lines from the obj file
-    try {
-        vector<Face3D> faces = LoadFaces(path);
-        vector<Line3D> lines = LoadLines(path);
-        string name = LoadName(path);
-        return Model3D(faces, lines, name);
-    } catch (const exception& e) {
-        throw runtime_error(string("Failed to load the obj file: ") + e.what());
+    if (progress) {
+        file.seekg(0, ios::end);
+        streamoff size = file.tellg();
+        file.seekg(0, ios::beg);
+        progress->SetTotalBytes(size > 0 ? static_cast<uint64_t>(size) : 0);
+    }
+    const double infinity = numeric_limits<double>::infinity();
+    Model3D::Statistics statistics = {0, 0, 0, 0.0, 0.0, 0.0,
+                                      {infinity, infinity, infinity},
+                                      {-infinity, -infinity, -infinity}};
+    CompensatedSum areas;
+    CompensatedSum lengths;
+    CompensatedSum enclosed;
+    vector<Vertex> vertices;
+    // the elements referring to a vertex defined after them, with their
+    // position among the faces or lines, they are added at the end
+    vector<pair<size_t, array<int, 3>>> laterFaces;
+    vector<pair<size_t, array<int, 2>>> laterLines;
+    // the first bad face and line of the file decide the error, as in
+    // TryLoad, so the position of the first one found is kept
+    size_t faceErrorAt = SIZE_MAX;
+    ErrorCode faceError = ErrorCode::NONE;
+    size_t lineErrorAt = SIZE_MAX;
+    ErrorCode lineError = ErrorCode::NONE;
+    // add a face whose vertices are read, the area as Face3D computes it
+    // and the volume as Model3D::GetStatistics does
+    auto addFace = [&](size_t position, const array<int, 3>& indices) {
+        const Vertex& p0 = vertices[indices[0] - 1];
+        const Vertex& p1 = vertices[indices[1] - 1];
+        const Vertex& p2 = vertices[indices[2] - 1];
+        if (SamePoint(p0, p1) || SamePoint(p0, p2) || SamePoint(p1, p2)) {
+            if (position < faceErrorAt) {
+                faceErrorAt = position;
+                faceError = ErrorCode::NOT_A_FACE;
+            }
+            return;
+        }
+        double ux = p1[0] - p0[0], uy = p1[1] - p0[1], uz = p1[2] - p0[2];
+        double vx = p2[0] - p0[0], vy = p2[1] - p0[1], vz = p2[2] - p0[2];
+        double nx = uy * vz - uz * vy;
+        double ny = uz * vx - ux * vz;
+        double nz = ux * vy - uy * vx;
+        areas.Add(0.5 * sqrt(nx * nx + ny * ny + nz * nz));
+        enclosed.Add(p0[0] * (p1[1] * p2[2] - p1[2] * p2[1]) +
+                     p0[1] * (p1[2] * p2[0] - p1[0] * p2[2]) +
+                     p0[2] * (p1[0] * p2[1] - p1[1] * p2[0]));
+        Widen(p0, statistics);
+        Widen(p1, statistics);
+        Widen(p2, statistics);
+    };
+    // add a line whose vertices are read, the length as DistanceFrom
+    auto addLine = [&](size_t position, const array<int, 2>& indices) {
+        const Vertex& p0 = vertices[indices[0] - 1];
+        const Vertex& p1 = vertices[indices[1] - 1];
+        if (SamePoint(p0, p1)) {
+            if (position < lineErrorAt) {
+                lineErrorAt = position;
+                lineError = ErrorCode::NOT_A_LINE;
+            }
+            return;
+        }
+        double dx = p0[0] - p1[0], dy = p0[1] - p1[1], dz = p0[2] - p1[2];
+        lengths.Add(sqrt(dx * dx + dy * dy + dz * dz));
+        Widen(p0, statistics);
+        Widen(p1, statistics);
+    };
+    string line;
+    unsigned int linesRead = 0;
+    uint64_t bytesRead = 0;
+    while (getline(file, line)) {
+        // count the newline as well
+        bytesRead += line.size() + 1;
+        if (progress && ++linesRead == PROGRESS_INTERVAL) {
+            progress->AddBytes(bytesRead);
+            bytesRead = 0;
+            linesRead = 0;
+            if (progress->IsCancelled()) {
+                return ErrorCode::CANCELLED;
+            }
+        }
+        if (line.compare(0, 2, "v ") == 0) {
+            Vertex vertex;
+            if (sscanf(line.c_str(), "v  %lf  %lf  %lf", 
+                       &vertex[0], &vertex[1], &vertex[2]) != 3) {
+                return ErrorCode::PARSE_FAILED;
+            }
+            vertices.push_back(vertex);
+        }
+        else if (line.compare(0, 2, "f ") == 0) {
+            array<int, 3> indices;
+            if (sscanf(line.c_str(), "f  %d  %d  %d", 
+                        &indices[0], &indices[1], &indices[2]) != 3) {
+                return ErrorCode::PARSE_FAILED;
+            }
+            size_t position = statistics.Faces++;
+            // nothing is summed after a bad face, the file fails anyway
+            if (faceError != ErrorCode::NONE) {
+                continue;
+            }
+            int lowest = min(min(indices[0], indices[1]), indices[2]);
+            int highest = max(max(indices[0], indices[1]), indices[2]);
+            if (lowest < 1) {
+                faceErrorAt = position;
+                faceError = ErrorCode::PARSE_FAILED;
+            }
+            else if (highest > static_cast<int>(vertices.size())) {
+                laterFaces.push_back(make_pair(position, indices));
+            }
+            else {
+                addFace(position, indices);
+            }
+        }
+        else if (line.compare(0, 2, "l ") == 0) {
+            array<int, 2> indices;
+            if (sscanf(line.c_str(), "l  %d  %d", 
+                        &indices[0], &indices[1]) != 2) {
+                return ErrorCode::PARSE_FAILED;
+            }
+            size_t position = statistics.Lines++;
+            if (lineError != ErrorCode::NONE) {
+                continue;
+            }
+            int lowest = min(indices[0], indices[1]);
+            int highest = max(indices[0], indices[1]);
+            if (lowest < 1) {
+                lineErrorAt = position;
+                lineError = ErrorCode::PARSE_FAILED;
+            }
+            else if (highest > static_cast<int>(vertices.size())) {
+                laterLines.push_back(make_pair(position, indices));
+            }
+            else {
+                addLine(position, indices);
+            }
+        }
+    }
+    if (progress) {
+        progress->AddBytes(bytesRead);
+    }
+    // all vertices are known now, an index past them is out of range
+    int vertexCount = static_cast<int>(vertices.size());
+    for (const pair<size_t, array<int, 3>>& face : laterFaces) {
+        if (face.first > faceErrorAt) {
+            break;
+        }
+        if (max(max(face.second[0], face.second[1]), face.second[2]) >
+            vertexCount) {
+            faceErrorAt = face.first;
+            faceError = ErrorCode::PARSE_FAILED;
+            break;
+        }
+        addFace(face.first, face.second);
+    }
+    if (faceError != ErrorCode::NONE) {
+        return faceError;
+    }
+    for (const pair<size_t, array<int, 2>>& element : laterLines) {
+        if (element.first > lineErrorAt) {
+            break;
+        }
+        if (max(element.second[0], element.second[1]) > vertexCount) {
+            lineErrorAt = element.first;
+            lineError = ErrorCode::PARSE_FAILED;
+            break;
+        }
+        addLine(element.first, element.second);
+    }
+    if (lineError != ErrorCode::NONE) {
+        return lineError;
+    }
+    if (progress) {
+        progress->AddFaces(statistics.Faces);
+        progress->AddLines(statistics.Lines);
+    }
+    statistics.TotalArea = areas.Total();
+    statistics.TotalLength = lengths.Total();
+    // the tetrahedra were summed six times over
+    statistics.EnclosedVolume = enclosed.Total() / 6.0;
+    statistics.Points = Face3D::Size * statistics.Faces + 
+                        Line3D::Size * statistics.Lines;
+    if (statistics.Points == 0) {
+        for (unsigned int axis = 0; axis < 3; axis++) {
+            statistics.Min[axis] = 0.0;
+            statistics.Max[axis] = 0.0;
+        }
     }
+    return statistics;
 }
 
 // -----------------------------------------------------------
@@ -10,6 +10,24 @@
 // edit: init Model3DObjImporter class
 //       add Load function to load OBJ files
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoad function, which reads the file once without throwing
+//       build Load on TryLoad
+// reason: to report import failures as error codes instead of exceptions,
+//         Load read the file four times
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoad with a Progress
+// reason: to show the progress of a long import and to cancel it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryLoadStatistics
+// reason: the statistics of a file built the whole model only to sum
+//         its areas and lengths
+// -----------------------------------------------------------
 
 #ifndef MODEL3DOBJIMPORTER_HPP
 #define MODEL3DOBJIMPORTER_HPP
@@ -35,6 +53,15 @@
 //    that load vertices, faces, and lines from a file in OBJ format.
 // 4. The LoadName function is a helper function that loads the name of the 
 //    model from a file in OBJ format.
+// 5. The TryLoad function reads the whole model in one pass over the file
+//    and returns an error code instead of throwing. Load throws 
+//    invalid_argument for a bad path and runtime_error for other failures.
+// 6. TryLoad with a Progress updates it every few thousand lines and
+//    elements and stops with CANCELLED once it is cancelled.
+// 7. TryLoadStatistics reads the file once and returns the statistics
+//    Model3D::GetStatistics would give for the model TryLoad builds,
+//    equal up to rounding, and the same errors. only the vertices are
+//    kept, and the elements referring to vertices defined after them.
 // [author] : Huayu Chen
 // [date] : 2024/7/31
 // -----------------------------------------------------------
@@ -49,6 +76,15 @@ public:
     virtual ~Model3DObjImporter();
     // load a 3D model from a file in OBJ format
     Model3D Load(const string& path) const override;
+    // load a 3D model from a file in OBJ format without throwing
+    Result<Model3D> TryLoad(const string& path) const override;
+    // load a 3D model from a file in OBJ format and report the progress
+    Result<Model3D> TryLoad(const string& path, 
+                            Progress* progress) const override;
+    // compute the statistics of a file in OBJ format without the model
+    Result<Model3D::Statistics> TryLoadStatistics(const string& path) const;
+    Result<Model3D::Statistics> TryLoadStatistics(const string& path,
+                                        Progress* progress) const;
     // load vertices from a file
     vector<Point3D> LoadVertices(const string& path) const;
     // load faces from a file
@@ -0,0 +1,642 @@
+// [file name] : meshgenerator.cpp
+// [function] : implement the MeshGenerator class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the MeshGenerator class
+// reason: to generate models of realistic sizes for the benchmarks and
+//         the stress tests
+// -----------------------------------------------------------
+
+#include "meshgenerator.hpp"
+#include "../Element3D/fixedsizepoint3dcontainer.hpp"
+#include "../Element3D/point3d.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+using namespace std;
+
+const uint64_t MeshGenerator::MAX_FACES = 500000000;
+
+// the faces between two reports of the progress
+static const uint64_t PROGRESS_INTERVAL = 1 << 16;
+// the bytes collected before WriteObj writes them
+static const size_t WRITE_BUFFER_BYTES = 1 << 20;
+// the streams of random numbers of a seed, so every decision of a face
+// can be computed again from the seed and the face alone
+static const uint64_t STREAM_HEIGHT = 1;
+static const uint64_t STREAM_RADIUS = 2;
+static const uint64_t STREAM_DEFECT = 3;
+static const uint64_t STREAM_DUPLICATE = 4;
+static const uint64_t STREAM_SOUP = 5;
+// the octaves of the terrain, the first has cells of 2 ^ 6 vertices
+static const int TERRAIN_OCTAVES = 4;
+static const unsigned int TERRAIN_FIRST_SPACING_BITS = 6;
+static const double TERRAIN_FIRST_AMPLITUDE = 8.0;
+// the shortest distance between two points of a triangle of the soup,
+// far above the 6 decimals of the file
+static const double SOUP_MIN_DISTANCE = 1e-3;
+
+// -----------------------------------------------------------
+// [name] : Mix
+// [function] : scramble the bits of a number, the finalizer of
+//              SplitMix64
+// [input] : the number
+// [output] : the scrambled number
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t Mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+// -----------------------------------------------------------
+// [name] : Hash
+// [function] : get the random bits of a seed, a stream and two numbers
+// [input] : the seed, the stream, the numbers
+// [output] : the bits, the same for the same input
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t Hash(uint64_t seed, uint64_t stream, uint64_t a,
+                     uint64_t b = 0) {
+    return Mix(Mix(Mix(seed ^ Mix(stream)) ^ a) ^ b);
+}
+
+// -----------------------------------------------------------
+// [name] : Unit
+// [function] : turn random bits into a number in [0, 1)
+// [input] : the bits
+// [output] : the number, a multiple of 2 ^ -53
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static double Unit(uint64_t bits) {
+    return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// -----------------------------------------------------------
+// [name] : CountFace
+// [function] : count a generated face in the progress
+// [input] : the faces generated so far, the progress or nullptr
+// [output] : false if the generation was cancelled
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool CountFace(uint64_t faces, Progress* progress) {
+    if (progress && faces % PROGRESS_INTERVAL == 0) {
+        progress->AddFaces(PROGRESS_INTERVAL);
+        return !progress->IsCancelled();
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : TerrainHeight
+// [function] : get the height of a vertex of the terrain
+// [input] : the seed, the column and the row of the vertex
+// [output] : the sum of the octaves of value noise, each one
+//            interpolating random heights between the corners of its
+//            cells
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static double TerrainHeight(uint64_t seed, uint64_t i, uint64_t j) {
+    double height = 0.0;
+    double amplitude = TERRAIN_FIRST_AMPLITUDE;
+    for (int octave = 0; octave < TERRAIN_OCTAVES; octave++) {
+        unsigned int bits = TERRAIN_FIRST_SPACING_BITS - octave;
+        uint64_t ci = i >> bits, cj = j >> bits;
+        // the spacing is a power of two, so the fractions are exact
+        double scale = 1.0 / static_cast<double>(1ull << bits);
+        double fx = static_cast<double>(i & ((1ull << bits) - 1)) * scale;
+        double fy = static_cast<double>(j & ((1ull << bits) - 1)) * scale;
+        uint64_t stream = STREAM_HEIGHT + (static_cast<uint64_t>(octave) << 8);
+        double h00 = Unit(Hash(seed, stream, ci, cj));
+        double h10 = Unit(Hash(seed, stream, ci + 1, cj));
+        double h01 = Unit(Hash(seed, stream, ci, cj + 1));
+        double h11 = Unit(Hash(seed, stream, ci + 1, cj + 1));
+        double bottom = h00 + (h10 - h00) * fx;
+        double top = h01 + (h11 - h01) * fx;
+        height += amplitude * (2.0 * (bottom + (top - bottom) * fy) - 1.0);
+        amplitude *= 0.5;
+    }
+    return height;
+}
+
+// -----------------------------------------------------------
+// [name] : TerrainFace
+// [function] : get the vertices of a face of the terrain
+// [input] : the cells of a row, the index of the face, the array of the
+//           three vertex indices
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void TerrainFace(uint64_t columns, uint64_t face, uint64_t* indices) {
+    uint64_t cell = face / 2;
+    uint64_t a = (cell / columns) * (columns + 1) + cell % columns;
+    uint64_t b = a + 1;
+    uint64_t c = a + columns + 1;
+    uint64_t d = c + 1;
+    // both faces of a cell turn counterclockwise seen from above
+    indices[0] = a;
+    indices[1] = face % 2 == 0 ? b : d;
+    indices[2] = face % 2 == 0 ? d : c;
+}
+
+// -----------------------------------------------------------
+// [name] : FormatFixed
+// [function] : write a number with 6 decimals, as to_string does
+// [input] : the number, the buffer of at least 32 characters
+// [output] : the number of characters written
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static size_t FormatFixed(double value, char* buffer) {
+    // the integer path needs the millionths to fit in 63 bits
+    if (!(fabs(value) < 9e12)) {
+        return static_cast<size_t>(snprintf(buffer, 32, "%.6f", value));
+    }
+    long long millionths = llround(value * 1e6);
+    size_t length = 0;
+    if (millionths < 0) {
+        buffer[length++] = '-';
+        millionths = -millionths;
+    }
+    unsigned long long whole = static_cast<unsigned long long>(millionths)
+                               / 1000000;
+    unsigned long long fraction = static_cast<unsigned long long>(
+                                      millionths) % 1000000;
+    char digits[24];
+    size_t count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + whole % 10);
+        whole /= 10;
+    } while (whole != 0);
+    while (count > 0) {
+        buffer[length++] = digits[--count];
+    }
+    buffer[length++] = '.';
+    for (int i = 5; i >= 0; i--) {
+        buffer[length + i] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
+    return length + 6;
+}
+
+// notes on the class ObjWriter
+// -----------------------------------------------------------
+// [class name] : ObjWriter
+// [function] : write the vertices and faces of a mesh to an OBJ file
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+class ObjWriter : public MeshGenerator::Sink
+{
+public:
+    // constructor, the open file
+    ObjWriter(ofstream& file) : m_file(file) {
+        m_buffer.reserve(WRITE_BUFFER_BYTES + 128);
+    }
+    // add a vertex line
+    void AddVertex(double x, double y, double z) override {
+        char line[128];
+        size_t length = 0;
+        line[length++] = 'v';
+        for (double value : {x, y, z}) {
+            line[length++] = ' ';
+            length += FormatFixed(value, line + length);
+        }
+        line[length++] = '\n';
+        Append(line, length);
+    }
+    // add a face line, the indices of the file start at 1
+    void AddFace(uint64_t a, uint64_t b, uint64_t c) override {
+        char line[80];
+        int length = snprintf(line, sizeof(line), "f %llu %llu %llu\n",
+                              static_cast<unsigned long long>(a + 1),
+                              static_cast<unsigned long long>(b + 1),
+                              static_cast<unsigned long long>(c + 1));
+        Append(line, static_cast<size_t>(length));
+    }
+    // write the rest of the buffer
+    void Flush() {
+        m_file.write(m_buffer.data(), m_buffer.size());
+        m_buffer.clear();
+    }
+
+private:
+    // add text to the buffer, write it when it is full
+    void Append(const char* text, size_t length) {
+        m_buffer.append(text, length);
+        if (m_buffer.size() >= WRITE_BUFFER_BYTES) {
+            Flush();
+        }
+    }
+
+    // private member variables
+    ofstream& m_file;
+    string m_buffer;
+};
+
+// notes on the class FaceCollector
+// -----------------------------------------------------------
+// [class name] : FaceCollector
+// [function] : build the faces of a mesh in memory
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+class FaceCollector : public MeshGenerator::Sink
+{
+public:
+    // constructor, the faces to expect
+    FaceCollector(uint64_t faces) {
+        m_faces.reserve(faces);
+    }
+    // keep a vertex
+    void AddVertex(double x, double y, double z) override {
+        m_vertices.push_back(Point3D(x, y, z));
+    }
+    // build a face, a degenerate one as well
+    void AddFace(uint64_t a, uint64_t b, uint64_t c) override {
+        m_faces.push_back(Face3D(m_vertices[a], m_vertices[b],
+                                 m_vertices[c], Unchecked()));
+    }
+    // take the faces
+    vector<Face3D> TakeFaces() {
+        return move(m_faces);
+    }
+
+private:
+    // private member variables
+    vector<Point3D> m_vertices;
+    vector<Face3D> m_faces;
+};
+
+// -----------------------------------------------------------
+// [name] : ~Sink
+// [function] : destructor of the Sink class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+MeshGenerator::Sink::~Sink() {}
+
+// -----------------------------------------------------------
+// [name] : Generate
+// [function] : generate a mesh
+// [input] : the options, the sink, the progress or nullptr
+// [output] : NONE, INVALID_INPUT if there are no faces, too many faces
+//            or the shares are not in [0, 1], CANCELLED
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode MeshGenerator::Generate(const Options& options, Sink& sink,
+                                  Progress* progress) {
+    if (options.Faces == 0 || options.Faces > MAX_FACES) {
+        return ErrorCode::INVALID_INPUT;
+    }
+    // written so that NaN fails as well
+    if (!(options.DuplicateShare >= 0.0 && options.DegenerateShare >= 0.0 &&
+          options.DuplicateShare + options.DegenerateShare <= 1.0)) {
+        return ErrorCode::INVALID_INPUT;
+    }
+    switch (options.Kind) {
+        case Shape::SPHERE:
+            return GenerateSphere(options, sink, progress);
+        case Shape::TERRAIN:
+        case Shape::DEFECTIVE:
+            return GenerateTerrain(options, sink, progress);
+        case Shape::SOUP:
+            return GenerateSoup(options, sink, progress);
+    }
+    return ErrorCode::INVALID_INPUT;
+}
+
+// -----------------------------------------------------------
+// [name] : MakeFaces
+// [function] : build the faces of a mesh
+// [input] : the options, the progress or nullptr
+// [output] : the faces, or the error of Generate
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Result<vector<Face3D>> MeshGenerator::MakeFaces(const Options& options,
+                                                Progress* progress) {
+    // bad options are found before anything is reserved
+    if (options.Faces == 0 || options.Faces > MAX_FACES) {
+        return ErrorCode::INVALID_INPUT;
+    }
+    FaceCollector collector(options.Faces);
+    ErrorCode code = Generate(options, collector, progress);
+    if (code != ErrorCode::NONE) {
+        return code;
+    }
+    return collector.TakeFaces();
+}
+
+// -----------------------------------------------------------
+// [name] : WriteObj
+// [function] : write a mesh to an OBJ file
+// [input] : the options, the path of the file, the progress or nullptr
+// [output] : NONE, EMPTY_PATH, NOT_OBJ_PATH, OPEN_FILE_FAILED,
+//            EXPORT_FAILED, or the error of Generate
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode MeshGenerator::WriteObj(const Options& options, const string& path,
+                                  Progress* progress) {
+    if (path.empty()) {
+        return ErrorCode::EMPTY_PATH;
+    }
+    // the importer only reads files ending with .obj
+    if (path.substr(path.find_last_of(".") + 1) != "obj") {
+        return ErrorCode::NOT_OBJ_PATH;
+    }
+    ofstream file(path, ios::binary);
+    if (!file.is_open()) {
+        return ErrorCode::OPEN_FILE_FAILED;
+    }
+    file << "# OBJ file" << '\n' << "g " << ShapeName(options.Kind) << '_'
+         << options.Faces << '_' << options.Seed << '\n';
+    ObjWriter writer(file);
+    ErrorCode code = Generate(options, writer, progress);
+    if (code == ErrorCode::NONE) {
+        writer.Flush();
+        file.flush();
+        if (!file) {
+            code = ErrorCode::EXPORT_FAILED;
+        }
+    }
+    if (code != ErrorCode::NONE) {
+        // no half written mesh is left behind
+        file.close();
+        remove(path.c_str());
+    }
+    return code;
+}
+
+// -----------------------------------------------------------
+// [name] : ParseShape
+// [function] : get the shape of a name
+// [input] : the name, the shape to set
+// [output] : false for an unknown name
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool MeshGenerator::ParseShape(const string& name, Shape& shape) {
+    for (Shape candidate : {Shape::SPHERE, Shape::TERRAIN, Shape::SOUP,
+                            Shape::DEFECTIVE}) {
+        if (name == ShapeName(candidate)) {
+            shape = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------
+// [name] : ShapeName
+// [function] : get the name of a shape
+// [input] : the shape
+// [output] : the name in lower case
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const char* MeshGenerator::ShapeName(Shape shape) {
+    switch (shape) {
+        case Shape::SPHERE: return "sphere";
+        case Shape::TERRAIN: return "terrain";
+        case Shape::SOUP: return "soup";
+        case Shape::DEFECTIVE: return "defective";
+    }
+    return "unknown";
+}
+
+// -----------------------------------------------------------
+// [name] : GenerateSphere
+// [function] : generate a closed sphere
+// [input] : the options, the sink, the progress or nullptr
+// [output] : NONE or CANCELLED
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode MeshGenerator::GenerateSphere(const Options& options, Sink& sink,
+                                        Progress* progress) {
+    // a sphere of R rings and S segments has 2 * S * (R - 1) faces,
+    // with about twice as many segments as rings
+    double faces = static_cast<double>(options.Faces);
+    uint64_t rings = max<uint64_t>(2, llround(sqrt(faces / 4.0)));
+    uint64_t segments = max<uint64_t>(
+        3, llround(faces / (2.0 * static_cast<double>(rings - 1))));
+    // the edges on the equator are about 1 long
+    const double pi = acos(-1.0);
+    double radius = static_cast<double>(segments) / (2.0 * pi);
+    auto vertexRadius = [&](uint64_t vertex) {
+        return radius * (1.0 + 0.01 * (Unit(Hash(options.Seed,
+                                                  STREAM_RADIUS, vertex))
+                                       - 0.5));
+    };
+    // the north pole, the rings from north to south, the south pole
+    uint64_t vertex = 0;
+    sink.AddVertex(0.0, 0.0, vertexRadius(vertex++));
+    for (uint64_t k = 1; k < rings; k++) {
+        double theta = pi * static_cast<double>(k) / rings;
+        for (uint64_t j = 0; j < segments; j++) {
+            double phi = 2.0 * pi * static_cast<double>(j) / segments;
+            double r = vertexRadius(vertex++);
+            sink.AddVertex(r * sin(theta) * cos(phi),
+                           r * sin(theta) * sin(phi), r * cos(theta));
+        }
+    }
+    uint64_t south = vertex;
+    sink.AddVertex(0.0, 0.0, -vertexRadius(vertex));
+    auto ring = [segments](uint64_t k, uint64_t j) {
+        return 1 + (k - 1) * segments + j % segments;
+    };
+    // every face turns counterclockwise seen from outside
+    uint64_t count = 0;
+    for (uint64_t j = 0; j < segments; j++) {
+        sink.AddFace(0, ring(1, j), ring(1, j + 1));
+        if (!CountFace(++count, progress)) {
+            return ErrorCode::CANCELLED;
+        }
+    }
+    for (uint64_t k = 1; k + 1 < rings; k++) {
+        for (uint64_t j = 0; j < segments; j++) {
+            sink.AddFace(ring(k, j), ring(k + 1, j), ring(k + 1, j + 1));
+            sink.AddFace(ring(k, j), ring(k + 1, j + 1), ring(k, j + 1));
+            count += 2;
+            // the count passes the interval on an odd or an even face
+            if (!CountFace(count - 1, progress) ||
+                !CountFace(count, progress)) {
+                return ErrorCode::CANCELLED;
+            }
+        }
+    }
+    for (uint64_t j = 0; j < segments; j++) {
+        sink.AddFace(south, ring(rings - 1, j + 1), ring(rings - 1, j));
+        if (!CountFace(++count, progress)) {
+            return ErrorCode::CANCELLED;
+        }
+    }
+    if (progress) {
+        progress->AddFaces(count % PROGRESS_INTERVAL);
+    }
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : GenerateTerrain
+// [function] : generate a terrain, with the defects of DEFECTIVE
+// [input] : the options, the sink, the progress or nullptr
+// [output] : NONE or CANCELLED
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode MeshGenerator::GenerateTerrain(const Options& options, Sink& sink,
+                                         Progress* progress) {
+    // a nearly square grid with enough cells, the last row may be
+    // partly used
+    uint64_t columns = max<uint64_t>(1, static_cast<uint64_t>(
+        ceil(sqrt(static_cast<double>(options.Faces) / 2.0))));
+    uint64_t rows = (options.Faces + 2 * columns - 1) / (2 * columns);
+    for (uint64_t j = 0; j <= rows; j++) {
+        for (uint64_t i = 0; i <= columns; i++) {
+            sink.AddVertex(static_cast<double>(i), static_cast<double>(j),
+                           TerrainHeight(options.Seed, i, j));
+        }
+    }
+    uint64_t vertices = (rows + 1) * (columns + 1);
+    bool defective = options.Kind == Shape::DEFECTIVE;
+    double duplicates = options.DuplicateShare;
+    double defects = duplicates + options.DegenerateShare;
+    // the decision of a face only depends on the seed and the face, so
+    // the faces a duplicate may repeat are known without keeping them
+    auto decision = [&](uint64_t face) {
+        return face == 0 ? 1.0
+            : Unit(Hash(options.Seed, STREAM_DEFECT, face));
+    };
+    uint64_t lastRegular = 0;
+    uint64_t indices[3];
+    for (uint64_t face = 0; face < options.Faces; face++) {
+        double draw = defective ? decision(face) : 1.0;
+        if (draw < duplicates) {
+            // repeat an earlier regular face, its points turned round
+            uint64_t earlier = Hash(options.Seed, STREAM_DUPLICATE, face)
+                               % face;
+            if (decision(earlier) < defects) {
+                earlier = lastRegular;
+            }
+            TerrainFace(columns, earlier, indices);
+            uint64_t turn = face % 3;
+            sink.AddFace(indices[turn], indices[(turn + 1) % 3],
+                         indices[(turn + 2) % 3]);
+        }
+        else if (draw < defects) {
+            TerrainFace(columns, face, indices);
+            if (face % 2 == 0) {
+                // two equal points
+                sink.AddFace(indices[0], indices[1], indices[0]);
+            }
+            else {
+                // a third point in the middle of an edge
+                uint64_t a = indices[0], b = indices[1];
+                uint64_t ai = a % (columns + 1), aj = a / (columns + 1);
+                uint64_t bi = b % (columns + 1), bj = b / (columns + 1);
+                sink.AddVertex(
+                    (static_cast<double>(ai) + bi) / 2.0,
+                    (static_cast<double>(aj) + bj) / 2.0,
+                    (TerrainHeight(options.Seed, ai, aj) +
+                     TerrainHeight(options.Seed, bi, bj)) / 2.0);
+                sink.AddFace(a, vertices++, b);
+            }
+        }
+        else {
+            TerrainFace(columns, face, indices);
+            sink.AddFace(indices[0], indices[1], indices[2]);
+            lastRegular = face;
+        }
+        if (!CountFace(face + 1, progress)) {
+            return ErrorCode::CANCELLED;
+        }
+    }
+    if (progress) {
+        progress->AddFaces(options.Faces % PROGRESS_INTERVAL);
+    }
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : GenerateSoup
+// [function] : generate separate random triangles in a cube
+// [input] : the options, the sink, the progress or nullptr
+// [output] : NONE or CANCELLED
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode MeshGenerator::GenerateSoup(const Options& options, Sink& sink,
+                                      Progress* progress) {
+    // the cube grows with the faces, so the density stays the same
+    double side = 4.0 * cbrt(static_cast<double>(options.Faces));
+    uint64_t draws = 0;
+    auto next = [&]() {
+        return Unit(Hash(options.Seed, STREAM_SOUP, draws++));
+    };
+    double points[3][3];
+    for (uint64_t face = 0; face < options.Faces; face++) {
+        while (true) {
+            double center[3] = {next() * side, next() * side, next() * side};
+            for (int p = 0; p < 3; p++) {
+                for (int axis = 0; axis < 3; axis++) {
+                    points[p][axis] = center[axis] + 2.0 * next() - 1.0;
+                }
+            }
+            // draw again if two points are nearly equal or the triangle
+            // is nearly flat
+            double u[3], v[3];
+            for (int axis = 0; axis < 3; axis++) {
+                u[axis] = points[1][axis] - points[0][axis];
+                v[axis] = points[2][axis] - points[0][axis];
+            }
+            double nx = u[1] * v[2] - u[2] * v[1];
+            double ny = u[2] * v[0] - u[0] * v[2];
+            double nz = u[0] * v[1] - u[1] * v[0];
+            bool apart = true;
+            for (int p = 0; p < 3; p++) {
+                const double* first = points[p];
+                const double* second = points[(p + 1) % 3];
+                apart = apart &&
+                    (fabs(first[0] - second[0]) >= SOUP_MIN_DISTANCE ||
+                     fabs(first[1] - second[1]) >= SOUP_MIN_DISTANCE ||
+                     fabs(first[2] - second[2]) >= SOUP_MIN_DISTANCE);
+            }
+            if (apart && sqrt(nx * nx + ny * ny + nz * nz) >=
+                             SOUP_MIN_DISTANCE) {
+                break;
+            }
+        }
+        for (int p = 0; p < 3; p++) {
+            sink.AddVertex(points[p][0], points[p][1], points[p][2]);
+        }
+        sink.AddFace(3 * face, 3 * face + 1, 3 * face + 2);
+        if (!CountFace(face + 1, progress)) {
+            return ErrorCode::CANCELLED;
+        }
+    }
+    if (progress) {
+        progress->AddFaces(options.Faces % PROGRESS_INTERVAL);
+    }
+    return ErrorCode::NONE;
+}
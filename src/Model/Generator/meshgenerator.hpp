@@ -0,0 +1,133 @@
+// [file name] : meshgenerator.hpp
+// [function] : declare the MeshGenerator class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init MeshGenerator class
+// reason: the repository only had models of a few faces, nothing tested
+//         or measured models of realistic sizes
+// -----------------------------------------------------------
+
+#ifndef MESHGENERATOR_HPP
+#define MESHGENERATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../Element3D/face3d.hpp"
+#include "../Progress/progress.hpp"
+#include "../Result/result.hpp"
+
+using namespace std;
+
+// notes on the class MeshGenerator
+// -----------------------------------------------------------
+// [class name] : MeshGenerator
+// [function] : generate triangle meshes of any size from a seed
+// [notes on interface] :
+// 1. the shapes are
+//    SPHERE: a closed sphere of rings and segments, its faces point
+//            outwards and its radius varies a little with the seed. the
+//            number of faces is the closest one a sphere can have
+//    TERRAIN: a grid of height values, two faces per cell, all facing up
+//    SOUP: separate random triangles, no two share a vertex
+//    DEFECTIVE: a terrain where a share of the faces repeat an earlier
+//            face or are degenerate, i.e. have two equal points or three
+//            points on one line. it is meant for the checks of the model
+//            and the importer, which refuses the faces with two equal
+//            points
+//    all shapes but SPHERE have exactly the asked number of faces
+// 2. the same options always give the same mesh. the coordinates of
+//    SPHERE use sin and cos, so they may differ in the last bits between
+//    platforms, the other shapes only use the seed
+// 3. Generate gives the vertices and faces to a Sink, a face only refers
+//    to vertices given before it, by their index from 0. nothing is kept
+//    in memory, so WriteObj writes 100M faces with a few MB
+// 4. MakeFaces builds the faces in memory with the Unchecked
+//    constructors, e.g. for Model3D or the exporter. a degenerate face
+//    of DEFECTIVE is built as it is
+// 5. WriteObj writes the mesh in the OBJ format of the exporter, without
+//    building any face. the coordinates have 6 decimals, as written by
+//    the exporter
+// 6. with a progress, the faces are counted and a cancel stops the
+//    generation with CANCELLED. a cancelled WriteObj removes its file
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class MeshGenerator
+{
+public:
+    // notes for the Shape enum class
+    // -----------------------------------------------------------
+    // [enum class name] : Shape
+    // [function] : define the generated mesh
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -----------------------------------------------------------
+    enum class Shape {
+        SPHERE,
+        TERRAIN,
+        SOUP,
+        DEFECTIVE
+    };
+    // what to generate
+    struct Options {
+        Shape Kind;
+        uint64_t Faces;
+        uint64_t Seed;
+        // shares of the faces of DEFECTIVE, in [0, 1] with a sum of at
+        // most 1
+        double DuplicateShare;
+        double DegenerateShare;
+    };
+    // notes for the Sink class
+    // -----------------------------------------------------------
+    // [class name] : Sink
+    // [function] : receive the vertices and faces of a mesh
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -----------------------------------------------------------
+    class Sink
+    {
+    public:
+        virtual ~Sink();
+        // add a vertex, its index is the number of vertices before it
+        virtual void AddVertex(double x, double y, double z) = 0;
+        // add a face of three vertices given before
+        virtual void AddFace(uint64_t a, uint64_t b, uint64_t c) = 0;
+    };
+    // the most faces of a mesh, the indices of the OBJ importer are int
+    static const uint64_t MAX_FACES;
+
+    // generate a mesh, INVALID_INPUT for bad options or CANCELLED
+    static ErrorCode Generate(const Options& options, Sink& sink,
+                              Progress* progress = nullptr);
+    // build the faces of a mesh
+    static Result<vector<Face3D>> MakeFaces(const Options& options,
+                                            Progress* progress = nullptr);
+    // write a mesh to an OBJ file
+    static ErrorCode WriteObj(const Options& options, const string& path,
+                              Progress* progress = nullptr);
+    // the shape of a name, e.g. "sphere", false for an unknown name
+    static bool ParseShape(const string& name, Shape& shape);
+    // the name of a shape
+    static const char* ShapeName(Shape shape);
+
+private:
+    // static class, no instances
+    MeshGenerator() = delete;
+    // generate each shape, the options are checked
+    static ErrorCode GenerateSphere(const Options& options, Sink& sink,
+                                    Progress* progress);
+    static ErrorCode GenerateTerrain(const Options& options, Sink& sink,
+                                     Progress* progress);
+    static ErrorCode GenerateSoup(const Options& options, Sink& sink,
+                                  Progress* progress);
+};
+
+#endif // MESHGENERATOR_HPP
@@ -0,0 +1,203 @@
+// [file name] : allocationcounter.cpp
+// [function] : implement the AllocationCounter class and, with
+//              HW_COUNT_ALLOCATIONS, the counting operator new and delete
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the AllocationCounter class
+// reason: to report the peak allocation of every command
+// -----------------------------------------------------------
+
+#include "allocationcounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+// the bytes allocated now and the highest of them
+static atomic<size_t> g_currentBytes(0);
+static atomic<size_t> g_peakBytes(0);
+
+#ifdef HW_COUNT_ALLOCATIONS
+
+// the size of a block is kept in front of it, the header keeps the
+// alignment malloc gives
+static const size_t HEADER_BYTES = alignof(max_align_t);
+
+// -----------------------------------------------------------
+// [name] : CountedAllocate
+// [function] : allocate a block and count its bytes
+// [input] : the bytes of the block
+// [output] : the block, nullptr if it cannot be allocated
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void* CountedAllocate(size_t bytes) {
+    char* block = static_cast<char*>(malloc(bytes + HEADER_BYTES));
+    if (block == nullptr) {
+        return nullptr;
+    }
+    *reinterpret_cast<size_t*>(block) = bytes;
+    size_t current = g_currentBytes.fetch_add(bytes,
+                                              memory_order_relaxed) + bytes;
+    size_t peak = g_peakBytes.load(memory_order_relaxed);
+    while (current > peak &&
+           !g_peakBytes.compare_exchange_weak(peak, current,
+                                              memory_order_relaxed)) {}
+    return block + HEADER_BYTES;
+}
+
+// -----------------------------------------------------------
+// [name] : CountedFree
+// [function] : free a block of CountedAllocate
+// [input] : the block, may be nullptr
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void CountedFree(void* pointer) {
+    if (pointer == nullptr) {
+        return;
+    }
+    char* block = static_cast<char*>(pointer) - HEADER_BYTES;
+    g_currentBytes.fetch_sub(*reinterpret_cast<size_t*>(block),
+                             memory_order_relaxed);
+    free(block);
+}
+
+// -----------------------------------------------------------
+// [name] : CountedNew
+// [function] : allocate a block for operator new
+// [input] : the bytes of the block
+// [output] : the block, throws bad_alloc if it cannot be allocated
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void* CountedNew(size_t bytes) {
+    // new of 0 bytes gives a unique block
+    if (bytes == 0) {
+        bytes = 1;
+    }
+    while (true) {
+        void* pointer = CountedAllocate(bytes);
+        if (pointer != nullptr) {
+            return pointer;
+        }
+        new_handler handler = get_new_handler();
+        if (handler == nullptr) {
+            throw bad_alloc();
+        }
+        handler();
+    }
+}
+
+// the replaced global operators, the aligned forms are left to the
+// library and not counted
+void* operator new(size_t bytes) {
+    return CountedNew(bytes);
+}
+
+void* operator new[](size_t bytes) {
+    return CountedNew(bytes);
+}
+
+void* operator new(size_t bytes, const nothrow_t&) noexcept {
+    try {
+        return CountedNew(bytes);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t bytes, const nothrow_t&) noexcept {
+    try {
+        return CountedNew(bytes);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* pointer) noexcept {
+    CountedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    CountedFree(pointer);
+}
+
+void operator delete(void* pointer, const nothrow_t&) noexcept {
+    CountedFree(pointer);
+}
+
+void operator delete[](void* pointer, const nothrow_t&) noexcept {
+    CountedFree(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    CountedFree(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    CountedFree(pointer);
+}
+
+#endif // HW_COUNT_ALLOCATIONS
+
+// -----------------------------------------------------------
+// [name] : IsAvailable
+// [function] : check if the allocations are counted
+// [input] : none
+// [output] : true if the program was built with HW_COUNT_ALLOCATIONS
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool AllocationCounter::IsAvailable() {
+#ifdef HW_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+// -----------------------------------------------------------
+// [name] : GetCurrentBytes
+// [function] : get the bytes allocated now
+// [input] : none
+// [output] : the bytes, 0 if they are not counted
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t AllocationCounter::GetCurrentBytes() {
+    return g_currentBytes.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetPeakBytes
+// [function] : get the highest bytes allocated since the start or the
+//              last ResetPeak
+// [input] : none
+// [output] : the bytes, 0 if they are not counted
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t AllocationCounter::GetPeakBytes() {
+    return g_peakBytes.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : ResetPeak
+// [function] : start a new peak at the bytes allocated now
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void AllocationCounter::ResetPeak() {
+    g_peakBytes.store(g_currentBytes.load(memory_order_relaxed),
+                      memory_order_relaxed);
+}
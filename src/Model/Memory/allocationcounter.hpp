@@ -0,0 +1,64 @@
+// [file name] : allocationcounter.hpp
+// [function] : declare the AllocationCounter class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init AllocationCounter class
+// reason: the memory of a model could be estimated, but not how much a
+//         command allocated while it ran
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: note that ResetPeak is shared by all threads
+// reason: two callers measuring at the same time reset each other
+// -----------------------------------------------------------
+
+#ifndef ALLOCATIONCOUNTER_HPP
+#define ALLOCATIONCOUNTER_HPP
+
+#include <cstddef>
+
+using namespace std;
+
+// notes on the class AllocationCounter
+// -----------------------------------------------------------
+// [class name] : AllocationCounter
+// [function] : count the bytes allocated with new and not yet deleted
+// [notes on interface] :
+// 1. the bytes are only counted with HW_COUNT_ALLOCATIONS
+//    (xmake f --count_allocations=y), which replaces the global operator
+//    new and delete. IsAvailable tells if it was, otherwise all counts
+//    are 0
+// 2. GetCurrentBytes is the number of bytes allocated now, GetPeakBytes
+//    the highest number since the start or the last ResetPeak
+// 3. the counts are of the whole program, an allocation of another
+//    thread is counted as well. there is one peak, so only one caller
+//    at a time may reset and read it, e.g. the writers of Controller
+// 4. all functions can be called from any thread, the class only has
+//    static members
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class AllocationCounter
+{
+public:
+    // check if the allocations are counted
+    static bool IsAvailable();
+    // bytes allocated now
+    static size_t GetCurrentBytes();
+    // highest bytes allocated since the start or the last ResetPeak
+    static size_t GetPeakBytes();
+    // start a new peak at the bytes allocated now
+    static void ResetPeak();
+
+private:
+    // static class, no instances
+    AllocationCounter() = delete;
+};
+
+#endif // ALLOCATIONCOUNTER_HPP
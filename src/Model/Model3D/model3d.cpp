@@ -10,15 +10,159 @@
 // edit: add implementation of the Model3D class
 // reason: to support storing 3D models
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: implement the modifying functions on their Try versions
+//       add move constructor and move assignment operator
+// reason: to let the controller reject invalid operations without
+//         exceptions
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryAddFaces and TryAddLines
+// reason: to add a batch of elements without a linear scan per element
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: give every change of the model a new version
+// reason: to let the controller cache the results of queries
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add trace spans to the constructor and the Try functions
+// reason: to see how long sharing and changing the elements takes
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add GetMemoryUsage
+// reason: to tell which part of a big model uses the memory
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add ShareElements
+// reason: to copy a big model before an edit without copying the
+//         faces and lines
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: share the elements of the constructor and check the batches of
+//       TryAddFaces and TryAddLines against the model on the
+//       TaskScheduler
+// reason: both are a loop over millions of independent elements after
+//         a big import or a big batch
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add GetStatistics
+// reason: the statistics of the controller copied every point and
+//         walked the elements three times on one thread
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: sum the enclosed volume in GetStatistics, add GetTopology
+// reason: the box was the only volume of a model, and there was no way
+//         to tell if the faces close a solid
+// -----------------------------------------------------------
 
 
 #include "model3d.hpp"
+#include "pointgrid.hpp"
+#include "../Trace/tracer.hpp"
+#include "../Parallel/taskscheduler.hpp"
 #include <string>
 #include <vector>
 #include <iostream> // debugging
+#include <stdexcept>
+#include <utility>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
 
 using namespace std;
 
+// -----------------------------------------------------------
+// [name] : NewVersion
+// [function] : get a version no model had before
+// [input] : none
+// [output] : the version, larger than every version given out before
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t NewVersion() {
+    // shared by all models, so a replaced model never repeats a version
+    static atomic<uint64_t> lastVersion(0);
+    return lastVersion.fetch_add(1, memory_order_relaxed) + 1;
+}
+
+// elements shared or checked by one task of the TaskScheduler
+static const size_t SHARE_GRAIN = 4096;
+static const size_t CHECK_GRAIN = 1024;
+// elements of one task of GetStatistics, and elements copied to the
+// buffers of its loops at once
+static const size_t STATISTICS_GRAIN = 4096;
+static const size_t STATISTICS_BLOCK = 256;
+// independent sums of the loops of GetStatistics, four doubles fill a
+// vector register
+static const size_t LANES = 4;
+// hash tables of GetTopology, each one is filled by one task, and the
+// faces hashed by one task
+static const size_t TOPOLOGY_SHARDS = 64;
+static const size_t TOPOLOGY_GRAIN = 4096;
+// the estimated control block of make_shared, a pointer to the table of
+// virtual functions and two counters in the common standard libraries
+static const size_t CONTROL_BLOCK_BYTES = 2 * sizeof(void*);
+// the heap rounds every block up to a multiple of this size, including
+// a size field
+static const size_t HEAP_ALIGNMENT = 2 * sizeof(void*);
+
+// -----------------------------------------------------------
+// [name] : HeapSlack
+// [function] : estimate the bytes the heap adds to a block
+// [input] : the requested size of the block
+// [output] : the size field and the rounding of the block
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static size_t HeapSlack(size_t bytes) {
+    size_t block = (bytes + sizeof(size_t) + HEAP_ALIGNMENT - 1) / 
+                   HEAP_ALIGNMENT * HEAP_ALIGNMENT;
+    return block - bytes;
+}
+
+// -----------------------------------------------------------
+// [name] : AddElementsUsage
+// [function] : add the bytes of the faces or lines of a model
+// [input] : the shared elements, the bytes of the elements without
+//           their points to add to, the usage to add to
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class Element>
+static void AddElementsUsage(const vector<shared_ptr<Element>>& elements,
+                             size_t& elementBytes,
+                             Model3D::MemoryUsage& usage) {
+    size_t count = elements.size();
+    size_t points = count * Element::Size;
+    usage.Points += points;
+    usage.PointBytes += points * sizeof(Point3D);
+    usage.CoordinateBytes += points * 3 * sizeof(double);
+    elementBytes += count * (sizeof(Element) - 
+                             Element::Size * sizeof(Point3D));
+    // make_shared puts the element and its control block in one block
+    usage.ControlBlockBytes += count * CONTROL_BLOCK_BYTES;
+    usage.SlackBytes += count * HeapSlack(sizeof(Element) + 
+                                          CONTROL_BLOCK_BYTES);
+    usage.PointerBytes += count * sizeof(shared_ptr<Element>);
+    size_t capacity = elements.capacity();
+    usage.SlackBytes += (capacity - count) * sizeof(shared_ptr<Element>);
+    if (capacity > 0) {
+        usage.SlackBytes += HeapSlack(capacity * sizeof(shared_ptr<Element>));
+    }
+}
+
 // -----------------------------------------------------------
 // [name] : Model3D
 // [function] : constructor for Model3D class
@@ -28,18 +172,27 @@ using namespace std;
 // [date] : 2024/8/6
 // -----------------------------------------------------------
 Model3D::Model3D(vector<Face3D> faces, vector<Line3D> lines, const string& name) {
+    TRACE_SCOPE("model", "make shared faces and lines");
+    TaskScheduler& scheduler = TaskScheduler::GetInstance();
     Faces = vector<shared_ptr<Face3D>>(faces.size());
-    // make shared pointers to the faces
-    for (size_t i = 0; i < faces.size(); i++) {
-        Faces[i] = make_shared<Face3D>(faces[i]);
-    }
+    // make shared pointers to the faces, every task fills its own slots
+    scheduler.ParallelFor(0, faces.size(), SHARE_GRAIN,
+                          [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            Faces[i] = make_shared<Face3D>(faces[i]);
+        }
+    });
     // make shared pointers to the lines
     Lines = vector<shared_ptr<Line3D>>(lines.size());
-    for (size_t i = 0; i < lines.size(); i++) {
-        Lines[i] = make_shared<Line3D>(lines[i]);
-    }
+    scheduler.ParallelFor(0, lines.size(), SHARE_GRAIN,
+                          [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            Lines[i] = make_shared<Line3D>(lines[i]);
+        }
+    });
     // set the name
     Name = name;
+    Version = NewVersion();
 }
 
 // -----------------------------------------------------------
@@ -55,6 +208,7 @@ Model3D::Model3D() {
     Faces = vector<shared_ptr<Face3D>>();
     Lines = vector<shared_ptr<Line3D>>();
     Name = "";
+    Version = NewVersion();
 }
 
 // -----------------------------------------------------------
@@ -76,8 +230,9 @@ Model3D::Model3D(const Model3D& model) {
     for (size_t i = 0; i < model.Lines.size(); i++) {
         Lines[i] = make_shared<Line3D>(*model.Lines[i]);
     }
-    // copy the name
+    // copy the name, the copy has the same content and version
     Name = model.Name;
+    Version = model.Version;
 }
 
 // -----------------------------------------------------------
@@ -116,11 +271,60 @@ Model3D& Model3D::operator=(const Model3D& model) {
     for (size_t i = 0; i < model.Lines.size(); i++) {
         Lines[i] = make_shared<Line3D>(*model.Lines[i]);
     }
-    // copy the name
+    // copy the name and the version
     Name = model.Name;
+    Version = model.Version;
+    return *this;
+}
+
+// -----------------------------------------------------------
+// [name] : Model3D
+// [function] : move constructor for Model3D class
+// [input] : an rvalue reference to another Model3D object
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Model3D::Model3D(Model3D&& model) noexcept : 
+    Name(move(model.Name)), Faces(move(model.Faces)), 
+    Lines(move(model.Lines)), Version(model.Version) {
+    // the emptied source is changed
+    model.Version = NewVersion();
+}
+
+// -----------------------------------------------------------
+// [name] : operator=
+// [function] : move assignment operator for Model3D class
+// [input] : an rvalue reference to another Model3D object
+// [output] : a reference to the current Model3D object
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Model3D& Model3D::operator=(Model3D&& model) noexcept {
+    if (this != &model) {
+        Name = move(model.Name);
+        Faces = move(model.Faces);
+        Lines = move(model.Lines);
+        Version = model.Version;
+        model.Version = NewVersion();
+    }
     return *this;
 }
 
+// -----------------------------------------------------------
+// [name] : ThrowIfError
+// [function] : throw invalid_argument if an error code is not NONE
+// [input] : an error code
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void ThrowIfError(ErrorCode code) {
+    if (code != ErrorCode::NONE) {
+        throw invalid_argument(ErrorMessage(code));
+    }
+}
+
 // -----------------------------------------------------------
 // [name] : DeleteFace
 // [function] : deletes a face at a specified index
@@ -130,12 +334,7 @@ Model3D& Model3D::operator=(const Model3D& model) {
 // [date] : 2024/8/6
 // -----------------------------------------------------------
 void Model3D::DeleteFace(unsigned int index) {
-    // check if the index is out of range
-    if (index >= Faces.size()) {
-        throw invalid_argument("Index out of range");
-    }
-    // delete the face at the specified index
-    Faces.erase(Faces.begin() + index);
+    ThrowIfError(TryDeleteFace(index));
 }
 
 // -----------------------------------------------------------
@@ -147,12 +346,7 @@ void Model3D::DeleteFace(unsigned int index) {
 // [date] : 2024/8/6
 // -----------------------------------------------------------
 void Model3D::DeleteLine(unsigned int index) {
-    // check if the index is out of range
-    if (index >= Lines.size()) {
-        throw invalid_argument("Index out of range");
-    }
-    // delete the line at the specified index
-    Lines.erase(Lines.begin() + index);
+    ThrowIfError(TryDeleteLine(index));
 }
 
 // -----------------------------------------------------------
@@ -164,14 +358,7 @@ void Model3D::DeleteLine(unsigned int index) {
 // [date] : 2024/8/6
 // -----------------------------------------------------------
 void Model3D::AddFace(const Face3D& face) {
-    // check if there are faces that are the same
-    for (const shared_ptr<Face3D>& f : Faces) {
-        // if the face already exists, throw an exception
-        if (Face3D::IsSameFace(*f, face)) {
-            throw invalid_argument("Face already exists");
-        }
-    }
-    Faces.push_back(make_shared<Face3D>(face));
+    ThrowIfError(TryAddFace(face));
 }
 
 // -----------------------------------------------------------
@@ -183,14 +370,7 @@ void Model3D::AddFace(const Face3D& face) {
 // [date] : 2024/8/6
 // -----------------------------------------------------------
 void Model3D::AddLine(const Line3D& line) {
-    // check if there are lines that are the same
-    for (const shared_ptr<Line3D>& l : Lines) {
-        // if the line already exists, throw an exception
-        if (Line3D::IsSameSegment(*l, line)) {
-            throw invalid_argument("Line already exists");
-        }
-    }
-    Lines.push_back(make_shared<Line3D>(line));
+    ThrowIfError(TryAddLine(line));
 }
 
 // -----------------------------------------------------------
@@ -205,46 +385,307 @@ void Model3D::AddLine(const Line3D& line) {
 // -----------------------------------------------------------
 void Model3D::ModifyFacePoint(unsigned int FaceIndex, 
                         unsigned int PointIndex, const Point3D& new_point) {
+    ThrowIfError(TryModifyFacePoint(FaceIndex, PointIndex, new_point));
+}
+
+// -----------------------------------------------------------
+// [name] : ModifyLinePoint
+// [function] : Modifies a point in a line of the 3D model
+// [input] : an unsigned int representing the line index, 
+//           an unsigned int representing the point index, 
+//           and a Point3D object representing the new point
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2024/8/6
+// -----------------------------------------------------------
+void Model3D::ModifyLinePoint(unsigned int LineIndex, 
+                        unsigned int PointIndex, const Point3D& new_point) {
+    ThrowIfError(TryModifyLinePoint(LineIndex, PointIndex, new_point));
+}
+
+// -----------------------------------------------------------
+// [name] : TryDeleteFace
+// [function] : deletes a face at a specified index without throwing
+// [input] : an unsigned integer representing the index
+// [output] : NONE or INDEX_OUT_OF_RANGE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Model3D::TryDeleteFace(unsigned int index) {
+    TRACE_SCOPE("model", "TryDeleteFace");
+    // check if the index is out of range
+    if (index >= Faces.size()) {
+        return ErrorCode::INDEX_OUT_OF_RANGE;
+    }
+    // delete the face at the specified index
+    Faces.erase(Faces.begin() + index);
+    Version = NewVersion();
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : TryDeleteLine
+// [function] : deletes a line at a specified index without throwing
+// [input] : an unsigned integer representing the index
+// [output] : NONE or INDEX_OUT_OF_RANGE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Model3D::TryDeleteLine(unsigned int index) {
+    TRACE_SCOPE("model", "TryDeleteLine");
+    // check if the index is out of range
+    if (index >= Lines.size()) {
+        return ErrorCode::INDEX_OUT_OF_RANGE;
+    }
+    // delete the line at the specified index
+    Lines.erase(Lines.begin() + index);
+    Version = NewVersion();
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : TryAddFace
+// [function] : adds a new face to the model without throwing
+// [input] : a constant reference to a Face3D object
+// [output] : NONE or DUPLICATE_FACE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Model3D::TryAddFace(const Face3D& face) {
+    TRACE_SCOPE("model", "TryAddFace");
+    // check if there are faces that are the same
+    if (FindFace(face)) {
+        return ErrorCode::DUPLICATE_FACE;
+    }
+    Faces.push_back(make_shared<Face3D>(face));
+    Version = NewVersion();
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : TryAddLine
+// [function] : adds a new line to the model without throwing
+// [input] : a constant reference to a Line3D object
+// [output] : NONE or DUPLICATE_LINE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Model3D::TryAddLine(const Line3D& line) {
+    TRACE_SCOPE("model", "TryAddLine");
+    // check if there are lines that are the same
+    if (FindLine(line)) {
+        return ErrorCode::DUPLICATE_LINE;
+    }
+    Lines.push_back(make_shared<Line3D>(line));
+    Version = NewVersion();
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : TryModifyFacePoint
+// [function] : Modifies a point in a face of the 3D model without throwing
+// [input] : an unsigned int representing the face index, 
+//           an unsigned int representing the point index, 
+//           and a Point3D object representing the new point
+// [output] : NONE, INDEX_OUT_OF_RANGE, NOT_A_FACE or DUPLICATE_FACE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ErrorCode Model3D::TryModifyFacePoint(unsigned int FaceIndex, 
+                        unsigned int PointIndex, const Point3D& new_point) {
+    TRACE_SCOPE("model", "TryModifyFacePoint");
     // check if the face index is out of range
     if (FaceIndex >= Faces.size()) {
-        throw invalid_argument("Index out of range");
+        return ErrorCode::INDEX_OUT_OF_RANGE;
     }
-    // modify the point in the face
+    // modify the point in a copy of the face
     Face3D NewFace = *Faces[FaceIndex];
-    NewFace.ModifyPoint(PointIndex, new_point);
+    ErrorCode code = NewFace.TryModifyPoint(PointIndex, new_point);
+    // a point that is already in the face leaves two equal points
+    if (code == ErrorCode::DUPLICATE_POINT) {
+        return ErrorCode::NOT_A_FACE;
+    }
+    if (code != ErrorCode::NONE) {
+        return code;
+    }
     // check if the new face already exists
     if (FindFace(NewFace)) {
-        throw invalid_argument("Face already exists");
+        return ErrorCode::DUPLICATE_FACE;
     }
     // make a shared pointer to the new face
     Faces[FaceIndex] = make_shared<Face3D>(NewFace);
+    Version = NewVersion();
+    return ErrorCode::NONE;
 }
 
 // -----------------------------------------------------------
-// [name] : ModifyLinePoint
-// [function] : Modifies a point in a line of the 3D model
+// [name] : TryModifyLinePoint
+// [function] : Modifies a point in a line of the 3D model without throwing
 // [input] : an unsigned int representing the line index, 
 //           an unsigned int representing the point index, 
 //           and a Point3D object representing the new point
-// [output] : none
+// [output] : NONE, INDEX_OUT_OF_RANGE, NOT_A_LINE or DUPLICATE_LINE
 // [author] : Huayu Chen
-// [date] : 2024/8/6
+// [date] : 2026/10/19
 // -----------------------------------------------------------
-void Model3D::ModifyLinePoint(unsigned int LineIndex, 
+ErrorCode Model3D::TryModifyLinePoint(unsigned int LineIndex, 
                         unsigned int PointIndex, const Point3D& new_point) {
+    TRACE_SCOPE("model", "TryModifyLinePoint");
     // check if the line index is out of range
     if (LineIndex >= Lines.size()) {
-        throw invalid_argument("Index out of range");
+        return ErrorCode::INDEX_OUT_OF_RANGE;
     }
-    // modify the point in the line
+    // modify the point in a copy of the line
     Line3D NewLine = *Lines[LineIndex];
-    NewLine.ModifyPoint(PointIndex, new_point);
+    ErrorCode code = NewLine.TryModifyPoint(PointIndex, new_point);
+    // a point that is already in the line leaves two equal points
+    if (code == ErrorCode::DUPLICATE_POINT) {
+        return ErrorCode::NOT_A_LINE;
+    }
+    if (code != ErrorCode::NONE) {
+        return code;
+    }
     // check if the new line already exists
     if (FindLine(NewLine)) {
-        throw invalid_argument("Line already exists");
+        return ErrorCode::DUPLICATE_LINE;
     }
     // make a shared pointer to the new line
     Lines[LineIndex] = make_shared<Line3D>(NewLine);
+    Version = NewVersion();
+    return ErrorCode::NONE;
+}
+
+// -----------------------------------------------------------
+// [name] : TryAddFaces
+// [function] : adds a batch of faces to the model without throwing
+// [input] : a vector of Face3D objects, a vector receiving the error
+//           codes, and whether to stop at the first failed face
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Model3D::TryAddFaces(const vector<Face3D>& faces, 
+                          vector<ErrorCode>& codes, bool stopOnError) {
+    TRACE_SCOPE("model", "TryAddFaces");
+    codes.clear();
+    codes.reserve(faces.size());
+    Faces.reserve(Faces.size() + faces.size());
+    // IsSameFace(existing, new) needs the first point of the existing face
+    // to equal a point of the new face, so the faces are indexed by their 
+    // first point and queried with the three points of the new face
+    auto isDuplicate = [this](const PointGrid& grid, const Face3D& face,
+                              vector<unsigned int>& candidates) {
+        for (unsigned int p = 0; p < Face3D::Size; p++) {
+            grid.Query(face.At(p), candidates);
+            for (unsigned int index : candidates) {
+                if (Face3D::IsSameFace(*Faces[index], face)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    PointGrid grid;
+    grid.Reserve(Faces.size());
+    for (unsigned int i = 0; i < Faces.size(); i++) {
+        grid.Insert(Faces[i]->At(0), i);
+    }
+    // the faces of the model are only read here, so the new faces are
+    // checked against them at once
+    vector<char> existing(faces.size(), 0);
+    if (!Faces.empty()) {
+        TaskScheduler::GetInstance().ParallelFor(0, faces.size(),
+            CHECK_GRAIN, [&](size_t first, size_t last) {
+            vector<unsigned int> candidates;
+            for (size_t i = first; i < last; i++) {
+                existing[i] = isDuplicate(grid, faces[i], candidates);
+            }
+        });
+    }
+    // a face of the batch is also checked against the earlier ones
+    PointGrid added;
+    added.Reserve(faces.size());
+    vector<unsigned int> candidates;
+    for (size_t i = 0; i < faces.size(); i++) {
+        const Face3D& face = faces[i];
+        if (existing[i] || isDuplicate(added, face, candidates)) {
+            codes.push_back(ErrorCode::DUPLICATE_FACE);
+            if (stopOnError) {
+                return;
+            }
+            continue;
+        }
+        added.Insert(face.At(0), static_cast<unsigned int>(Faces.size()));
+        Faces.push_back(make_shared<Face3D>(face));
+        Version = NewVersion();
+        codes.push_back(ErrorCode::NONE);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : TryAddLines
+// [function] : adds a batch of lines to the model without throwing
+// [input] : a vector of Line3D objects, a vector receiving the error
+//           codes, and whether to stop at the first failed line
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Model3D::TryAddLines(const vector<Line3D>& lines, 
+                          vector<ErrorCode>& codes, bool stopOnError) {
+    TRACE_SCOPE("model", "TryAddLines");
+    codes.clear();
+    codes.reserve(lines.size());
+    Lines.reserve(Lines.size() + lines.size());
+    // the first point of a same segment equals one of the two points
+    // of the new line
+    auto isDuplicate = [this](const PointGrid& grid, const Line3D& line,
+                              vector<unsigned int>& candidates) {
+        for (unsigned int p = 0; p < Line3D::Size; p++) {
+            grid.Query(line.At(p), candidates);
+            for (unsigned int index : candidates) {
+                if (Line3D::IsSameSegment(*Lines[index], line)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    PointGrid grid;
+    grid.Reserve(Lines.size());
+    for (unsigned int i = 0; i < Lines.size(); i++) {
+        grid.Insert(Lines[i]->At(0), i);
+    }
+    // the lines of the model are only read here, so the new lines are
+    // checked against them at once
+    vector<char> existing(lines.size(), 0);
+    if (!Lines.empty()) {
+        TaskScheduler::GetInstance().ParallelFor(0, lines.size(),
+            CHECK_GRAIN, [&](size_t first, size_t last) {
+            vector<unsigned int> candidates;
+            for (size_t i = first; i < last; i++) {
+                existing[i] = isDuplicate(grid, lines[i], candidates);
+            }
+        });
+    }
+    // a line of the batch is also checked against the earlier ones
+    PointGrid added;
+    added.Reserve(lines.size());
+    vector<unsigned int> candidates;
+    for (size_t i = 0; i < lines.size(); i++) {
+        const Line3D& line = lines[i];
+        if (existing[i] || isDuplicate(added, line, candidates)) {
+            codes.push_back(ErrorCode::DUPLICATE_LINE);
+            if (stopOnError) {
+                return;
+            }
+            continue;
+        }
+        added.Insert(line.At(0), static_cast<unsigned int>(Lines.size()));
+        Lines.push_back(make_shared<Line3D>(line));
+        Version = NewVersion();
+        codes.push_back(ErrorCode::NONE);
+    }
 }
 
 // -----------------------------------------------------------
@@ -295,6 +736,7 @@ bool Model3D::FindLine(const Line3D& line) const {
 // -----------------------------------------------------------
 void Model3D::ModifyName(const string& name) {
     Name = name;
+    Version = NewVersion();
 }
 
 // -----------------------------------------------------------
@@ -358,4 +800,496 @@ vector<Point3D> Model3D::GetPoints() const {
     return Points;
 }
 
+// -----------------------------------------------------------
+// [name] : ShareElements
+// [function] : copy the model without copying the faces and lines
+// [input] : none
+// [output] : a model with the same name, version and shared pointers,
+//            the elements are never changed in place, so changing
+//            either model leaves the other one as it is
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Model3D Model3D::ShareElements() const {
+    TRACE_SCOPE("model", "ShareElements");
+    Model3D model;
+    model.Faces = Faces;
+    model.Lines = Lines;
+    model.Name = Name;
+    model.Version = Version;
+    return model;
+}
+
+// -----------------------------------------------------------
+// [name] : GetVersion
+// [function] : Retrieves the version of the 3D model
+// [input] : none
+// [output] : the version, changed by every modification
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Model3D::GetVersion() const {
+    return Version;
+}
+
+// -----------------------------------------------------------
+// [name] : GetMemoryUsage
+// [function] : Retrieves the bytes used by the 3D model
+// [input] : none
+// [output] : the bytes of the points, the elements, the shared pointers,
+//            the slack and the name
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Model3D::MemoryUsage Model3D::GetMemoryUsage() const {
+    MemoryUsage usage = MemoryUsage();
+    AddElementsUsage(Faces, usage.FaceBytes, usage);
+    AddElementsUsage(Lines, usage.LineBytes, usage);
+    usage.NameBytes = sizeof(Model3D) + Name.capacity();
+    return usage;
+}
+
+// -----------------------------------------------------------
+// [name] : Total
+// [function] : sum the bytes of a memory usage
+// [input] : none
+// [output] : the sum of all bytes, the coordinates are part of the
+//            points and only counted once
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t Model3D::MemoryUsage::Total() const {
+    return PointBytes + FaceBytes + LineBytes + ControlBlockBytes +
+           PointerBytes + SlackBytes + NameBytes;
+}
+
+// notes on the class LaneSums
+// -----------------------------------------------------------
+// [class name] : LaneSums
+// [function] : add many values with compensated sums in LANES lanes
+// [notes on interface] :
+// 1. the k-th value of a call goes to the lane k % LANES, the lanes do
+//    not depend on each other, so the compiler keeps them in one
+//    vector register without reordering any addition
+// 2. every lane keeps the rounding error of its sum (Kahan), Total adds
+//    the corrected lanes in a fixed order
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class LaneSums
+{
+public:
+    // constructor, all lanes are zero
+    LaneSums() {
+        for (size_t j = 0; j < LANES; j++) {
+            m_sums[j] = 0.0;
+            m_errors[j] = 0.0;
+        }
+    }
+    // add some values
+    void Add(const double* values, size_t count) {
+        size_t k = 0;
+        for (; k + LANES <= count; k += LANES) {
+            for (size_t j = 0; j < LANES; j++) {
+                AddTo(j, values[k + j]);
+            }
+        }
+        for (; k < count; k++) {
+            AddTo(k % LANES, values[k]);
+        }
+    }
+    // the sum of all values
+    double Total() const {
+        return ((m_sums[0] - m_errors[0]) + (m_sums[1] - m_errors[1])) +
+               ((m_sums[2] - m_errors[2]) + (m_sums[3] - m_errors[3]));
+    }
+
+private:
+    // add a value to a lane, keeping the part that was rounded off
+    void AddTo(size_t lane, double value) {
+        double corrected = value - m_errors[lane];
+        double sum = m_sums[lane] + corrected;
+        m_errors[lane] = (sum - m_sums[lane]) - corrected;
+        m_sums[lane] = sum;
+    }
+
+    // private member variables
+    double m_sums[LANES];
+    double m_errors[LANES];
+};
+
+// -----------------------------------------------------------
+// [name] : Bound
+// [function] : widen a range of values to contain some values
+// [input] : the values, their number, the lowest and highest value
+//           so far
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void Bound(const double* values, size_t count, double& low,
+                  double& high) {
+    // one bound per lane, the compiler turns them into vector min and max
+    double lows[LANES];
+    double highs[LANES];
+    for (size_t j = 0; j < LANES; j++) {
+        lows[j] = low;
+        highs[j] = high;
+    }
+    size_t k = 0;
+    for (; k + LANES <= count; k += LANES) {
+        for (size_t j = 0; j < LANES; j++) {
+            double value = values[k + j];
+            lows[j] = value < lows[j] ? value : lows[j];
+            highs[j] = value > highs[j] ? value : highs[j];
+        }
+    }
+    for (; k < count; k++) {
+        low = values[k] < low ? values[k] : low;
+        high = values[k] > high ? values[k] : high;
+    }
+    for (size_t j = 0; j < LANES; j++) {
+        low = lows[j] < low ? lows[j] : low;
+        high = highs[j] > high ? highs[j] : high;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : GetStatistics
+// [function] : sum the areas of the faces and the lengths of the lines
+//              and find the bounds of their points in one pass
+// [input] : none
+// [output] : the statistics, the same on every number of threads
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Model3D::Statistics Model3D::GetStatistics() const {
+    TRACE_SCOPE("model", "GetStatistics");
+    const double infinity = numeric_limits<double>::infinity();
+    const Statistics empty = {0, 0, 0, 0.0, 0.0, 0.0,
+                              {infinity, infinity, infinity},
+                              {-infinity, -infinity, -infinity}};
+    size_t faceCount = Faces.size();
+    // the faces and then the lines are one range of indices, a task may
+    // get the last faces and the first lines
+    Statistics statistics = TaskScheduler::GetInstance().ParallelReduce(
+        0, faceCount + Lines.size(), STATISTICS_GRAIN, empty,
+        [&](size_t first, size_t last) {
+        Statistics partial = empty;
+        LaneSums areas;
+        LaneSums lengths;
+        LaneSums enclosed;
+        // the points of a block, one array per axis, and the area or
+        // length of every element, next to each other for the loops
+        double coordinates[3][Face3D::Size * STATISTICS_BLOCK];
+        double values[STATISTICS_BLOCK];
+        double volumes[STATISTICS_BLOCK];
+        for (size_t start = first; start < last && start < faceCount;
+             start += STATISTICS_BLOCK) {
+            size_t count = min(min(last, faceCount) - start,
+                               STATISTICS_BLOCK);
+            for (size_t k = 0; k < count; k++) {
+                const Face3D& face = *Faces[start + k];
+                // the area is kept by the face
+                values[k] = face.Area();
+                for (unsigned int p = 0; p < Face3D::Size; p++) {
+                    const Point3D& point = face.At(p);
+                    coordinates[0][Face3D::Size * k + p] = point.X;
+                    coordinates[1][Face3D::Size * k + p] = point.Y;
+                    coordinates[2][Face3D::Size * k + p] = point.Z;
+                }
+            }
+            areas.Add(values, count);
+            // six times the signed volume of the tetrahedron of the
+            // origin and the face, p0 . (p1 x p2)
+            const double* x = coordinates[0];
+            const double* y = coordinates[1];
+            const double* z = coordinates[2];
+            for (size_t k = 0; k < count; k++) {
+                size_t p = Face3D::Size * k;
+                volumes[k] =
+                    x[p] * (y[p + 1] * z[p + 2] - z[p + 1] * y[p + 2]) +
+                    y[p] * (z[p + 1] * x[p + 2] - x[p + 1] * z[p + 2]) +
+                    z[p] * (x[p + 1] * y[p + 2] - y[p + 1] * x[p + 2]);
+            }
+            enclosed.Add(volumes, count);
+            for (unsigned int axis = 0; axis < 3; axis++) {
+                Bound(coordinates[axis], Face3D::Size * count,
+                      partial.Min[axis], partial.Max[axis]);
+            }
+        }
+        for (size_t start = max(first, faceCount); start < last;
+             start += STATISTICS_BLOCK) {
+            size_t count = min(last - start, STATISTICS_BLOCK);
+            for (size_t k = 0; k < count; k++) {
+                const Line3D& line = *Lines[start - faceCount + k];
+                for (unsigned int p = 0; p < Line3D::Size; p++) {
+                    const Point3D& point = line.At(p);
+                    coordinates[0][Line3D::Size * k + p] = point.X;
+                    coordinates[1][Line3D::Size * k + p] = point.Y;
+                    coordinates[2][Line3D::Size * k + p] = point.Z;
+                }
+            }
+            // the length as Point::DistanceFrom computes it
+            for (size_t k = 0; k < count; k++) {
+                double dx = coordinates[0][2 * k] - coordinates[0][2 * k + 1];
+                double dy = coordinates[1][2 * k] - coordinates[1][2 * k + 1];
+                double dz = coordinates[2][2 * k] - coordinates[2][2 * k + 1];
+                values[k] = sqrt(dx * dx + dy * dy + dz * dz);
+            }
+            lengths.Add(values, count);
+            for (unsigned int axis = 0; axis < 3; axis++) {
+                Bound(coordinates[axis], Line3D::Size * count,
+                      partial.Min[axis], partial.Max[axis]);
+            }
+        }
+        partial.TotalArea = areas.Total();
+        partial.TotalLength = lengths.Total();
+        partial.EnclosedVolume = enclosed.Total();
+        return partial;
+    },
+    [](const Statistics& a, const Statistics& b) {
+        Statistics sum = a;
+        sum.TotalArea += b.TotalArea;
+        sum.TotalLength += b.TotalLength;
+        sum.EnclosedVolume += b.EnclosedVolume;
+        for (unsigned int axis = 0; axis < 3; axis++) {
+            sum.Min[axis] = min(a.Min[axis], b.Min[axis]);
+            sum.Max[axis] = max(a.Max[axis], b.Max[axis]);
+        }
+        return sum;
+    });
+    // the tetrahedra were summed six times over
+    statistics.EnclosedVolume /= 6.0;
+    statistics.Faces = faceCount;
+    statistics.Lines = Lines.size();
+    statistics.Points = Face3D::Size * faceCount + Line3D::Size * Lines.size();
+    if (statistics.Points == 0) {
+        for (unsigned int axis = 0; axis < 3; axis++) {
+            statistics.Min[axis] = 0.0;
+            statistics.Max[axis] = 0.0;
+        }
+    }
+    return statistics;
+}
+
+// -----------------------------------------------------------
+// [name] : BoxVolume
+// [function] : get the volume of the bounding box of the statistics
+// [input] : none
+// [output] : the volume, 0 without points
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+double Model3D::Statistics::BoxVolume() const {
+    return (Max[0] - Min[0]) * (Max[1] - Min[1]) * (Max[2] - Min[2]);
+}
+
+// notes on the struct VertexKey
+// -----------------------------------------------------------
+// [struct name] : VertexKey
+// [function] : the coordinates of a point as a key of a hash table
+// [notes on interface] :
+// 1. the bits of the coordinates are compared, -0.0 is stored as 0.0,
+//    so points are one vertex exactly if their coordinates are equal
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+struct VertexKey {
+    uint64_t Bits[3];
+    bool operator==(const VertexKey& key) const {
+        return Bits[0] == key.Bits[0] && Bits[1] == key.Bits[1] &&
+               Bits[2] == key.Bits[2];
+    }
+};
 
+// -----------------------------------------------------------
+// [name] : Mix
+// [function] : spread the bits of a number over the whole number
+// [input] : the number
+// [output] : the mixed number, the finalizer of splitmix64
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t Mix(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+// -----------------------------------------------------------
+// [name] : MakeVertexKey
+// [function] : get the key of a point
+// [input] : the point
+// [output] : the key
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static VertexKey MakeVertexKey(const Point3D& point) {
+    // adding 0.0 turns -0.0 into 0.0
+    double coordinates[3] = {point.X + 0.0, point.Y + 0.0, point.Z + 0.0};
+    VertexKey key;
+    memcpy(key.Bits, coordinates, sizeof(key.Bits));
+    return key;
+}
+
+// the hash of a vertex key for the hash tables of GetTopology
+struct VertexHash {
+    size_t operator()(const VertexKey& key) const {
+        return static_cast<size_t>(
+            Mix(key.Bits[0] ^ Mix(key.Bits[1] ^ Mix(key.Bits[2]))));
+    }
+};
+
+// the faces along an edge, and how many of them go from its smaller
+// vertex to the larger one
+struct EdgeUse {
+    uint32_t Faces;
+    uint32_t Forward;
+};
+
+// -----------------------------------------------------------
+// [name] : Shard
+// [function] : get the hash table of GetTopology a hash belongs to
+// [input] : the hash
+// [output] : the shard, the low bits choose the bucket in the table
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static size_t Shard(uint64_t hash) {
+    return static_cast<size_t>(hash >> 32) % TOPOLOGY_SHARDS;
+}
+
+// -----------------------------------------------------------
+// [name] : GetTopology
+// [function] : find the vertices and edges of the faces and count the
+//              edges that keep the faces from closing a solid
+// [input] : none
+// [output] : the topology, all zero without faces
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Model3D::Topology Model3D::GetTopology() const {
+    TRACE_SCOPE("model", "GetTopology");
+    TaskScheduler& scheduler = TaskScheduler::GetInstance();
+    // the points and edges are numbered with 32 bits, Size per face
+    size_t pointCount = Face3D::Size * Faces.size();
+    vector<uint64_t> hashes(pointCount);
+    scheduler.ParallelFor(0, Faces.size(), TOPOLOGY_GRAIN,
+        [&](size_t first, size_t last) {
+        VertexHash hash;
+        for (size_t i = first; i < last; i++) {
+            for (unsigned int p = 0; p < Face3D::Size; p++) {
+                hashes[Face3D::Size * i + p] =
+                    hash(MakeVertexKey(Faces[i]->At(p)));
+            }
+        }
+    });
+    // the points of every shard, every shard numbers its vertices from 0
+    vector<vector<uint32_t>> shardPoints(TOPOLOGY_SHARDS);
+    for (size_t point = 0; point < pointCount; point++) {
+        shardPoints[Shard(hashes[point])].push_back(
+            static_cast<uint32_t>(point));
+    }
+    vector<uint32_t> vertices(pointCount);
+    vector<size_t> offsets(TOPOLOGY_SHARDS + 1, 0);
+    scheduler.ParallelFor(0, TOPOLOGY_SHARDS, 1,
+        [&](size_t first, size_t last) {
+        for (size_t shard = first; shard < last; shard++) {
+            unordered_map<VertexKey, uint32_t, VertexHash> numbers;
+            numbers.reserve(shardPoints[shard].size());
+            for (uint32_t point : shardPoints[shard]) {
+                const Point3D& at =
+                    Faces[point / Face3D::Size]->At(point % Face3D::Size);
+                uint32_t number = static_cast<uint32_t>(numbers.size());
+                vertices[point] = numbers.emplace(MakeVertexKey(at),
+                                                  number).first->second;
+            }
+            offsets[shard + 1] = numbers.size();
+        }
+    });
+    for (size_t shard = 0; shard < TOPOLOGY_SHARDS; shard++) {
+        offsets[shard + 1] += offsets[shard];
+    }
+    scheduler.ParallelFor(0, TOPOLOGY_SHARDS, 1,
+        [&](size_t first, size_t last) {
+        for (size_t shard = first; shard < last; shard++) {
+            for (uint32_t point : shardPoints[shard]) {
+                vertices[point] += static_cast<uint32_t>(offsets[shard]);
+            }
+        }
+    });
+    shardPoints.clear();
+    // edge k of a face goes from its point k to the next one, the edges
+    // are hashed by their vertices, the smaller one first
+    auto edgeKey = [&vertices](size_t edge) {
+        size_t face = edge / Face3D::Size;
+        uint64_t from = vertices[edge];
+        uint64_t to = vertices[Face3D::Size * face +
+                               (edge + 1) % Face3D::Size];
+        return from < to ? (from << 32) | to : (to << 32) | from;
+    };
+    vector<vector<uint32_t>> shardEdges(TOPOLOGY_SHARDS);
+    for (size_t edge = 0; edge < pointCount; edge++) {
+        shardEdges[Shard(Mix(edgeKey(edge)))].push_back(
+            static_cast<uint32_t>(edge));
+    }
+    const Topology none = {0, 0, 0, 0, 0};
+    Topology topology = scheduler.ParallelReduce(
+        0, TOPOLOGY_SHARDS, 1, none, [&](size_t first, size_t last) {
+        Topology partial = none;
+        for (size_t shard = first; shard < last; shard++) {
+            unordered_map<uint64_t, EdgeUse> uses;
+            uses.reserve(shardEdges[shard].size());
+            for (uint32_t edge : shardEdges[shard]) {
+                size_t face = edge / Face3D::Size;
+                bool forward = vertices[edge] < vertices[
+                    Face3D::Size * face + (edge + 1) % Face3D::Size];
+                EdgeUse& use = uses[edgeKey(edge)];
+                use.Faces++;
+                use.Forward += forward ? 1 : 0;
+            }
+            partial.Edges += uses.size();
+            for (const pair<const uint64_t, EdgeUse>& use : uses) {
+                if (use.second.Faces == 1) {
+                    partial.BoundaryEdges++;
+                }
+                else if (use.second.Faces > 2) {
+                    partial.NonManifoldEdges++;
+                }
+                else if (use.second.Forward != 1) {
+                    // two faces agreeing on the outside go opposite ways
+                    partial.MisorientedEdges++;
+                }
+            }
+        }
+        return partial;
+    },
+    [](const Topology& a, const Topology& b) {
+        Topology sum = a;
+        sum.Edges += b.Edges;
+        sum.BoundaryEdges += b.BoundaryEdges;
+        sum.NonManifoldEdges += b.NonManifoldEdges;
+        sum.MisorientedEdges += b.MisorientedEdges;
+        return sum;
+    });
+    topology.Vertices = offsets[TOPOLOGY_SHARDS];
+    return topology;
+}
+
+// -----------------------------------------------------------
+// [name] : IsWatertight
+// [function] : check if the faces close a solid
+// [input] : none
+// [output] : true if there are edges and every edge has two faces
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Model3D::Topology::IsWatertight() const {
+    return Edges > 0 && BoundaryEdges == 0 && NonManifoldEdges == 0;
+}
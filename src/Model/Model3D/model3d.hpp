@@ -22,15 +22,61 @@
 //       add unsigned int to the getter of faces, lines, and points
 // reason: to make the code more readable and efficient
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add Try versions of the modifying functions, which return an
+//       error code instead of throwing
+//       add move constructor and move assignment operator
+// reason: to let the controller reject invalid operations without
+//         exceptions, and to hand a loaded model over without copying it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add TryAddFaces and TryAddLines
+// reason: to add a batch of elements without comparing every new element
+//         with every element of the model
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add GetVersion
+// reason: to let the controller reuse the results of queries as long as
+//         the model is not changed
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add GetMemoryUsage and the MemoryUsage struct
+// reason: to tell which part of a big model uses the memory
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add ShareElements
+// reason: to let the controller edit a copy of a big model while the
+//         queries read the original
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add GetStatistics and the Statistics struct
+// reason: the statistics of the controller copied every point and
+//         walked the elements three times on one thread
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the enclosed volume to the statistics, add GetTopology and
+//       the Topology struct
+// reason: the box was the only volume of a model, and there was no way
+//         to tell if the faces close a solid
+// -----------------------------------------------------------
 
 #ifndef MODEL3D_HPP
 #define MODEL3D_HPP
 
 #include <vector>
 #include <memory>
+#include <cstdint>
 #include "../Element3D/face3d.hpp"
 #include "../Element3D/line3d.hpp"
 #include "../Element3D/point3d.hpp"
+#include "../Result/result.hpp"
 #include <string>
 
 using namespace std;
@@ -43,6 +89,41 @@ using namespace std;
 // 1. the model3d is defined by a vector of faces and a vector of lines
 // 2. the model3d supports some operations to modify the faces and lines
 // 3. there are getter functions to get the faces, lines, and points
+// 4. every modifying function has a Try version that returns an error code
+//    and leaves the model unchanged on failure, the other version throws
+//    invalid_argument with the message of the error code
+// 5. TryAddFaces and TryAddLines add a batch of elements in order, with the
+//    same result as calling TryAddFace or TryAddLine for each of them, but
+//    the duplicates are found with a PointGrid instead of a linear scan
+// 6. GetVersion returns the version of the model, which grows with every
+//    successful change and stays the same when a function fails. the
+//    versions are unique in the process, a new model never gets the
+//    version of another one, and a copy has the version of its source
+//    as long as neither is changed
+// 7. GetMemoryUsage splits the bytes of the model into the points, the
+//    rest of the elements, the control blocks of the shared pointers,
+//    the pointer vectors and the name. the control blocks and the slack
+//    of the heap blocks are estimates, the real ones depend on the
+//    standard library and the allocator
+// 8. the model never changes a face or a line in place, a modification
+//    replaces it. ShareElements returns a copy that shares the faces
+//    and lines with this model, both can be changed without affecting
+//    the other, and the copy has the version of this model
+// 9. GetStatistics sums the areas and lengths and finds the bounding box
+//    in one pass on the TaskScheduler. the sums of fixed ranges are
+//    compensated and added pairwise, so the result is the same on any
+//    number of threads. the points are counted with repetitions, as
+//    GetPoints returns them, and the box of a model without points is
+//    all zero. the enclosed volume is the sum of the signed volumes of
+//    the tetrahedra of the origin and every face. it is the volume of
+//    the solid for a watertight model whose faces are ordered
+//    counterclockwise seen from outside, and negative for clockwise
+// 10. GetTopology finds the edges of the faces with hash tables on the
+//    TaskScheduler. points with the same coordinates are one vertex, an
+//    edge of one face is a boundary edge and an edge of three or more
+//    faces is non-manifold. an edge of two faces going the same way is
+//    misoriented, the two faces disagree about the outside. the model
+//    is watertight if it has faces and every edge has exactly two
 // [author] : Huayu Chen
 // [date] : 2024/8/3
 // -----------------------------------------------------------
@@ -50,6 +131,58 @@ using namespace std;
 
 class Model3D {
 public:
+    // the bytes used by a model, see GetMemoryUsage
+    struct MemoryUsage {
+        // number of points stored in the faces and lines
+        size_t Points;
+        // bytes of the Point3D objects, and of their coordinates alone
+        size_t PointBytes;
+        size_t CoordinateBytes;
+        // bytes of the faces and lines without their points
+        size_t FaceBytes;
+        size_t LineBytes;
+        // bytes of the control blocks of the shared pointers
+        size_t ControlBlockBytes;
+        // bytes of the used slots of the vectors of shared pointers
+        size_t PointerBytes;
+        // bytes of the unused capacity of the vectors and of the
+        // rounding of the heap blocks
+        size_t SlackBytes;
+        // bytes of the model object and its name
+        size_t NameBytes;
+        // sum of all bytes
+        size_t Total() const;
+    };
+    // the sums and the bounds of a model, see GetStatistics
+    struct Statistics {
+        size_t Faces;
+        size_t Lines;
+        // points of the faces and lines, with repetitions
+        size_t Points;
+        double TotalArea;
+        double TotalLength;
+        // signed volume enclosed by the faces
+        double EnclosedVolume;
+        // the smallest and largest x, y and z of the points
+        double Min[3];
+        double Max[3];
+        // volume of the bounding box
+        double BoxVolume() const;
+    };
+    // the vertices and edges of the faces, see GetTopology
+    struct Topology {
+        size_t Vertices;
+        size_t Edges;
+        // edges of one face
+        size_t BoundaryEdges;
+        // edges of more than two faces
+        size_t NonManifoldEdges;
+        // edges of two faces going the same way along them
+        size_t MisorientedEdges;
+        // faces without boundary and non-manifold edges
+        bool IsWatertight() const;
+    };
+
     // default constructor
     Model3D();
     // constructor, initiate a model3d with faces and lines and a name
@@ -60,6 +193,12 @@ public:
     virtual ~Model3D();
     // assignment operator
     Model3D& operator=(const Model3D& model);
+    // move constructor, the faces and lines are taken over
+    Model3D(Model3D&& model) noexcept;
+    // move assignment operator
+    Model3D& operator=(Model3D&& model) noexcept;
+    // a copy sharing the faces and lines of the model
+    Model3D ShareElements() const;
 
     // functions to modify the model3d
     // displaying functions are not provided
@@ -80,11 +219,37 @@ public:
     // function 7: modify the name of the model3d
     void ModifyName(const string& name);
 
+    // functions 1-6 without exceptions, return NONE on success
+    ErrorCode TryDeleteFace(unsigned int index);
+    ErrorCode TryAddFace(const Face3D& face);
+    ErrorCode TryModifyFacePoint(unsigned int FaceIndex, 
+                        unsigned int PointIndex, const Point3D& new_point);
+    ErrorCode TryDeleteLine(unsigned int index);
+    ErrorCode TryAddLine(const Line3D& line);
+    ErrorCode TryModifyLinePoint(unsigned int LineIndex, 
+                        unsigned int PointIndex, const Point3D& new_point);
+    // add a batch of faces or lines in order, the error code of every
+    // element is written to codes. with stopOnError, the batch stops at 
+    // the first failed element and codes ends with its error code
+    void TryAddFaces(const vector<Face3D>& faces, vector<ErrorCode>& codes,
+                     bool stopOnError);
+    void TryAddLines(const vector<Line3D>& lines, vector<ErrorCode>& codes,
+                     bool stopOnError);
+
     // getter of faces, lines, name, and points
     const vector<shared_ptr<Face3D>>& GetFaces() const;
     const vector<shared_ptr<Line3D>>& GetLines() const;
     string GetName() const;
     vector<Point3D> GetPoints() const;
+    // getter of the version, changed by every modification
+    uint64_t GetVersion() const;
+    // the bytes used by the model
+    MemoryUsage GetMemoryUsage() const;
+    // the number of elements, their total area and length, the bounds
+    // and the enclosed volume
+    Statistics GetStatistics() const;
+    // the vertices and edges of the faces
+    Topology GetTopology() const;
 
 
 private:
@@ -93,6 +258,8 @@ private:
     // the faces and lines of the model3d
     vector<shared_ptr<Face3D>> Faces;
     vector<shared_ptr<Line3D>> Lines;
+    // the version of the faces, lines and name
+    uint64_t Version;
 
     // helper functions to check if a face or a line is in the model3d
     bool FindFace(const Face3D& face) const;
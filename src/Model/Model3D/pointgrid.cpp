@@ -0,0 +1,127 @@
+// [file name] : pointgrid.cpp
+// [function] : implement the PointGrid class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the PointGrid class
+// reason: to find duplicate faces and lines without a linear scan
+// -----------------------------------------------------------
+
+#include "pointgrid.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+
+// tolerance of Point::operator== with a margin for rounding,
+// returning a few more candidates is harmless
+static const double QUERY_TOLERANCE = 2e-6;
+// cells further away are clamped, a large value keeps the cast defined
+static const double MAX_CELL_INDEX = 1e15;
+
+// -----------------------------------------------------------
+// [name] : PointGrid
+// [function] : constructor of the PointGrid class
+// [input] : the edge length of a cell
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+PointGrid::PointGrid(double cellSize) : m_rCellSize(cellSize) {}
+
+// -----------------------------------------------------------
+// [name] : Insert
+// [function] : insert an element by its key point
+// [input] : the key point and the index of the element
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void PointGrid::Insert(const Point3D& point, unsigned int index) {
+    Cell cell = {CellIndex(point.X), CellIndex(point.Y), CellIndex(point.Z)};
+    m_cells[cell].push_back(index);
+}
+
+// -----------------------------------------------------------
+// [name] : Query
+// [function] : get the elements whose key point may equal a point
+// [input] : the point, the vector receiving the indices
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void PointGrid::Query(const Point3D& point,
+                      vector<unsigned int>& candidates) const {
+    candidates.clear();
+    // the cells touched by the tolerance box around the point,
+    // at most two per axis
+    int64_t minX = CellIndex(point.X - QUERY_TOLERANCE);
+    int64_t maxX = CellIndex(point.X + QUERY_TOLERANCE);
+    int64_t minY = CellIndex(point.Y - QUERY_TOLERANCE);
+    int64_t maxY = CellIndex(point.Y + QUERY_TOLERANCE);
+    int64_t minZ = CellIndex(point.Z - QUERY_TOLERANCE);
+    int64_t maxZ = CellIndex(point.Z + QUERY_TOLERANCE);
+    for (int64_t x = minX; x <= maxX; x++) {
+        for (int64_t y = minY; y <= maxY; y++) {
+            for (int64_t z = minZ; z <= maxZ; z++) {
+                auto it = m_cells.find(Cell{x, y, z});
+                if (it != m_cells.end()) {
+                    candidates.insert(candidates.end(),
+                                      it->second.begin(), it->second.end());
+                }
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Reserve
+// [function] : reserve space for a number of elements
+// [input] : the number of elements
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void PointGrid::Reserve(size_t count) {
+    m_cells.reserve(count);
+}
+
+// -----------------------------------------------------------
+// [name] : CellIndex
+// [function] : get the index of the cell containing a coordinate
+// [input] : the coordinate
+// [output] : the index of the cell along the axis
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+int64_t PointGrid::CellIndex(double coordinate) const {
+    double index = floor(coordinate / m_rCellSize);
+    // clamp huge values and NaN, the caller compares the candidates exactly
+    if (!(index > -MAX_CELL_INDEX)) {
+        index = -MAX_CELL_INDEX;
+    }
+    if (!(index < MAX_CELL_INDEX)) {
+        index = MAX_CELL_INDEX;
+    }
+    return static_cast<int64_t>(index);
+}
+
+// -----------------------------------------------------------
+// [name] : operator()
+// [function] : hash a cell
+// [input] : the cell
+// [output] : the hash value
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+size_t PointGrid::CellHash::operator()(const Cell& cell) const {
+    // mix the three indices with large odd constants
+    uint64_t hash = static_cast<uint64_t>(cell.X) * 0x9E3779B97F4A7C15ULL;
+    hash ^= static_cast<uint64_t>(cell.Y) * 0xC2B2AE3D27D4EB4FULL;
+    hash ^= static_cast<uint64_t>(cell.Z) * 0x165667B19E3779F9ULL;
+    return static_cast<size_t>(hash ^ (hash >> 32));
+}
@@ -0,0 +1,77 @@
+// [file name] : pointgrid.hpp
+// [function] : declare the PointGrid class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init PointGrid class
+// reason: adding many faces or lines compared every new element with
+//         every element of the model, the grid finds the few candidates
+// -----------------------------------------------------------
+
+#ifndef POINTGRID_HPP
+#define POINTGRID_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include "../Element3D/point3d.hpp"
+
+using namespace std;
+
+// notes about the class PointGrid
+// -----------------------------------------------------------
+// [class name] : PointGrid
+// [function] : find the elements whose key point may equal a given point
+// [notes on interface] :
+// 1. every element is inserted with one point and its index, the grid
+//    hashes the point into a cubic cell
+// 2. Query returns the indices of all elements whose point may lie within
+//    1e-6 of the given point in every coordinate, the tolerance of
+//    Point::operator==. it can also return a few elements further away,
+//    the caller has to compare the candidates exactly
+// 3. the cell size does not affect the result, only the speed
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class PointGrid
+{
+public:
+    // constructor, init an empty grid with the edge length of a cell
+    PointGrid(double cellSize = 1e-3);
+    // insert an element by its key point
+    void Insert(const Point3D& point, unsigned int index);
+    // get the indices of the elements whose point may equal the given point
+    // the indices are written to candidates, which is cleared first
+    void Query(const Point3D& point, vector<unsigned int>& candidates) const;
+    // reserve space for a number of elements
+    void Reserve(size_t count);
+
+private:
+    // integer coordinates of a cell
+    struct Cell {
+        int64_t X;
+        int64_t Y;
+        int64_t Z;
+        bool operator==(const Cell& cell) const {
+            return X == cell.X && Y == cell.Y && Z == cell.Z;
+        }
+    };
+    // hash of a cell
+    struct CellHash {
+        size_t operator()(const Cell& cell) const;
+    };
+    // index of the cell containing a coordinate
+    int64_t CellIndex(double coordinate) const;
+
+    // private member variables, the cell size and the cells
+    double m_rCellSize;
+    unordered_map<Cell, vector<unsigned int>, CellHash> m_cells;
+};
+
+#endif // POINTGRID_HPP
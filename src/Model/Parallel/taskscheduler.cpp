@@ -0,0 +1,526 @@
+// [file name] : taskscheduler.cpp
+// [function] : implement the TaskScheduler, TaskGroup and TaskGraph classes
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the TaskScheduler, TaskGroup and TaskGraph
+//       classes
+// reason: import, export, the statistics and the duplicate checks each
+//         had to split their work on threads of their own
+// -----------------------------------------------------------
+
+#include "taskscheduler.hpp"
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+using namespace std;
+
+// a thread waiting for a group whose last tasks run on other threads
+// looks for new tasks this often
+static const chrono::microseconds WAIT_INTERVAL(200);
+
+// the options of the shared scheduler, fixed once it was created
+static mutex g_optionsMutex;
+static TaskScheduler::Options g_options = {0, false};
+static bool g_created = false;
+
+// the scheduler of the worker running on this thread and the index of
+// its queue, nullptr on the other threads
+static thread_local TaskScheduler* t_scheduler = nullptr;
+static thread_local size_t t_queue = 0;
+
+// -----------------------------------------------------------
+// [name] : TaskScheduler
+// [function] : constructor of the TaskScheduler class
+// [input] : the options
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+TaskScheduler::TaskScheduler(const Options& options)
+    : m_pinThreads(options.PinThreads), m_sleepers(0), m_stopping(false),
+      m_queued(0), m_peakQueued(0), m_tasks(0), m_steals(0) {
+    unsigned int threads = options.Threads;
+    if (threads == 0) {
+        threads = thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+    // the waiting thread is one of them
+    unsigned int workers = threads - 1;
+    for (unsigned int i = 0; i <= workers; i++) {
+        m_queues.push_back(unique_ptr<Queue>(new Queue()));
+    }
+    m_threads.reserve(workers);
+    for (unsigned int i = 0; i < workers; i++) {
+        m_threads.push_back(thread(&TaskScheduler::WorkerLoop, this, i));
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : ~TaskScheduler
+// [function] : destructor of the TaskScheduler class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+TaskScheduler::~TaskScheduler() {
+    {
+        lock_guard<mutex> lock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (thread& worker : m_threads) {
+        worker.join();
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Configure
+// [function] : set the options of the shared scheduler
+// [input] : the options
+// [output] : false if the shared scheduler was already created
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool TaskScheduler::Configure(const Options& options) {
+    lock_guard<mutex> lock(g_optionsMutex);
+    if (g_created) {
+        return false;
+    }
+    g_options = options;
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : GetInstance
+// [function] : get the scheduler shared by the whole program
+// [input] : none
+// [output] : the scheduler, created with the configured options on the
+//            first call
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+TaskScheduler& TaskScheduler::GetInstance() {
+    static TaskScheduler instance([]() {
+        lock_guard<mutex> lock(g_optionsMutex);
+        g_created = true;
+        return g_options;
+    }());
+    return instance;
+}
+
+// -----------------------------------------------------------
+// [name] : GetThreadCount
+// [function] : get the number of threads running tasks
+// [input] : none
+// [output] : the workers and the waiting thread
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+unsigned int TaskScheduler::GetThreadCount() const {
+    return static_cast<unsigned int>(m_threads.size()) + 1;
+}
+
+// -----------------------------------------------------------
+// [name] : GetStatistics
+// [function] : get the counters of the scheduler
+// [input] : none
+// [output] : the statistics, the counters are read one by one
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+TaskScheduler::Statistics TaskScheduler::GetStatistics() const {
+    return Statistics{GetThreadCount(),
+                      m_tasks.load(memory_order_relaxed),
+                      m_steals.load(memory_order_relaxed),
+                      m_queued.load(memory_order_relaxed),
+                      m_peakQueued.load(memory_order_relaxed)};
+}
+
+// -----------------------------------------------------------
+// [name] : ResetStatistics
+// [function] : set the counters to zero, the queued tasks stay counted
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskScheduler::ResetStatistics() {
+    m_tasks = 0;
+    m_steals = 0;
+    m_peakQueued = m_queued.load();
+}
+
+// -----------------------------------------------------------
+// [name] : Spawn
+// [function] : queue a task of a group
+// [input] : the group, the task
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskScheduler::Spawn(TaskGroup& group, Task task) {
+    // a worker keeps its tasks, the other threads share the last queue
+    size_t index = t_scheduler == this ? t_queue : m_queues.size() - 1;
+    Queue& queue = *m_queues[index];
+    {
+        lock_guard<mutex> lock(queue.Mutex);
+        queue.Items.push_back(Item{move(task), &group});
+    }
+    uint64_t queued = m_queued.fetch_add(1) + 1;
+    uint64_t peak = m_peakQueued.load(memory_order_relaxed);
+    while (queued > peak &&
+           !m_peakQueued.compare_exchange_weak(peak, queued,
+                                               memory_order_relaxed)) {
+    }
+    // a worker going to sleep counts itself before it looks at m_queued,
+    // so either it sees the task or it is woken here
+    if (m_sleepers.load() > 0) {
+        lock_guard<mutex> lock(m_sleepMutex);
+        m_wake.notify_one();
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : RunOne
+// [function] : run one queued task on the calling thread
+// [input] : none
+// [output] : false if no task was queued
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool TaskScheduler::RunOne() {
+    Item item;
+    if (!Take(item)) {
+        return false;
+    }
+    m_tasks.fetch_add(1, memory_order_relaxed);
+    item.Group->Execute(item.Body);
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Take
+// [function] : take a task, the newest of the own queue first, then the
+//              oldest of the shared queue, then the oldest of another
+//              worker
+// [input] : the item receiving the task
+// [output] : false if all queues are empty
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool TaskScheduler::Take(Item& item) {
+    size_t workers = m_queues.size() - 1;
+    bool worker = t_scheduler == this;
+    if (worker) {
+        // the newest task works on the data its parent just touched
+        Queue& own = *m_queues[t_queue];
+        lock_guard<mutex> lock(own.Mutex);
+        if (!own.Items.empty()) {
+            item = move(own.Items.back());
+            own.Items.pop_back();
+            m_queued.fetch_sub(1);
+            return true;
+        }
+    }
+    {
+        Queue& shared = *m_queues[workers];
+        lock_guard<mutex> lock(shared.Mutex);
+        if (!shared.Items.empty()) {
+            item = move(shared.Items.front());
+            shared.Items.pop_front();
+            m_queued.fetch_sub(1);
+            return true;
+        }
+    }
+    // the oldest task of a victim is the biggest part of its range
+    size_t start = worker ? t_queue + 1 : 0;
+    for (size_t i = 0; i < workers; i++) {
+        Queue& victim = *m_queues[(start + i) % workers];
+        lock_guard<mutex> lock(victim.Mutex);
+        if (!victim.Items.empty()) {
+            item = move(victim.Items.front());
+            victim.Items.pop_front();
+            m_queued.fetch_sub(1);
+            m_steals.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------
+// [name] : WorkerLoop
+// [function] : run queued tasks until the scheduler is destroyed
+// [input] : the index of the queue of the worker
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskScheduler::WorkerLoop(size_t index) {
+    t_scheduler = this;
+    t_queue = index;
+    if (m_pinThreads) {
+        // the first processor is left to the waiting thread
+        PinCurrentThread(static_cast<unsigned int>(index) + 1);
+    }
+    while (!m_stopping.load()) {
+        if (RunOne()) {
+            continue;
+        }
+        unique_lock<mutex> lock(m_sleepMutex);
+        m_sleepers++;
+        m_wake.wait(lock, [this]() {
+            return m_stopping.load() || m_queued.load() > 0;
+        });
+        m_sleepers--;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : PinCurrentThread
+// [function] : keep the calling thread on one processor
+// [input] : the processor, taken modulo the number of processors
+// [output] : none, nothing happens where the platform cannot do it
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskScheduler::PinCurrentThread(unsigned int processor) {
+    unsigned int count = thread::hardware_concurrency();
+    if (count == 0) {
+        return;
+    }
+    processor %= count;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(processor, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(_WIN32)
+    if (processor < 8 * sizeof(DWORD_PTR)) {
+        SetThreadAffinityMask(GetCurrentThread(),
+                              static_cast<DWORD_PTR>(1) << processor);
+    }
+#else
+    (void)processor;
+#endif
+}
+
+// -----------------------------------------------------------
+// [name] : TaskGroup
+// [function] : constructor of the TaskGroup class
+// [input] : the scheduler running the tasks
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+TaskGroup::TaskGroup(TaskScheduler& scheduler)
+    : m_scheduler(scheduler), m_pending(0) {}
+
+// -----------------------------------------------------------
+// [name] : ~TaskGroup
+// [function] : destructor of the TaskGroup class, wait for the tasks
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+TaskGroup::~TaskGroup() {
+    Join();
+}
+
+// -----------------------------------------------------------
+// [name] : Run
+// [function] : queue a task of the group
+// [input] : the task
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskGroup::Run(TaskScheduler::Task task) {
+    m_pending.fetch_add(1);
+    m_scheduler.Spawn(*this, move(task));
+}
+
+// -----------------------------------------------------------
+// [name] : Wait
+// [function] : wait for all tasks of the group
+// [input] : none
+// [output] : none, throws the first exception of a task
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskGroup::Wait() {
+    Join();
+    if (m_exception) {
+        exception_ptr exception = m_exception;
+        m_exception = nullptr;
+        rethrow_exception(exception);
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Execute
+// [function] : run a task of the group and count it as finished
+// [input] : the task
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskGroup::Execute(TaskScheduler::Task& task) {
+    exception_ptr exception;
+    try {
+        task();
+    }
+    catch (...) {
+        exception = current_exception();
+    }
+    // the count drops under the mutex, the waiting thread takes it once
+    // more before it returns, so the group outlives this function
+    lock_guard<mutex> lock(m_mutex);
+    if (exception && !m_exception) {
+        m_exception = exception;
+    }
+    if (m_pending.fetch_sub(1) == 1) {
+        m_finished.notify_all();
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Join
+// [function] : run queued tasks until every task of the group returned
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskGroup::Join() {
+    while (m_pending.load() != 0) {
+        // any queued task helps, it may be one the group waits for
+        if (m_scheduler.RunOne()) {
+            continue;
+        }
+        unique_lock<mutex> lock(m_mutex);
+        m_finished.wait_for(lock, WAIT_INTERVAL, [this]() {
+            return m_pending.load() == 0;
+        });
+    }
+    // the last task may still hold the mutex
+    lock_guard<mutex> lock(m_mutex);
+}
+
+// -----------------------------------------------------------
+// [name] : AddTask
+// [function] : add a task to the graph
+// [input] : the task
+// [output] : the node of the task
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+TaskGraph::Node TaskGraph::AddTask(TaskScheduler::Task task) {
+    m_vertices.push_back(Vertex{move(task), vector<Node>(), 0});
+    return m_vertices.size() - 1;
+}
+
+// -----------------------------------------------------------
+// [name] : AddDependency
+// [function] : let a task wait for another one
+// [input] : the node running first, the node waiting for it
+// [output] : none, throws invalid_argument for a node not in the graph
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskGraph::AddDependency(Node before, Node after) {
+    if (before >= m_vertices.size() || after >= m_vertices.size()) {
+        throw invalid_argument("The node is not in the task graph.");
+    }
+    m_vertices[before].Successors.push_back(after);
+    m_vertices[after].Predecessors++;
+}
+
+// -----------------------------------------------------------
+// [name] : Run
+// [function] : run all tasks of the graph, each one after the tasks it
+//              depends on
+// [input] : the scheduler
+// [output] : none, throws invalid_argument for a cycle and the first
+//            exception of a task
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskGraph::Run(TaskScheduler& scheduler) {
+    // check for a cycle first, nothing runs if there is one
+    vector<size_t> remaining(m_vertices.size());
+    vector<Node> ready;
+    for (Node node = 0; node < m_vertices.size(); node++) {
+        remaining[node] = m_vertices[node].Predecessors;
+        if (remaining[node] == 0) {
+            ready.push_back(node);
+        }
+    }
+    vector<Node> roots = ready;
+    size_t ordered = 0;
+    while (!ready.empty()) {
+        Node node = ready.back();
+        ready.pop_back();
+        ordered++;
+        for (Node successor : m_vertices[node].Successors) {
+            if (--remaining[successor] == 0) {
+                ready.push_back(successor);
+            }
+        }
+    }
+    if (ordered != m_vertices.size()) {
+        throw invalid_argument("The task graph has a cycle.");
+    }
+    vector<atomic<size_t>> waiting(m_vertices.size());
+    for (Node node = 0; node < m_vertices.size(); node++) {
+        waiting[node].store(m_vertices[node].Predecessors);
+    }
+    TaskGroup group(scheduler);
+    for (Node node : roots) {
+        Start(group, waiting, node);
+    }
+    group.Wait();
+}
+
+// -----------------------------------------------------------
+// [name] : Start
+// [function] : queue a task whose dependencies returned, it starts the
+//              tasks waiting only for it when it returns
+// [input] : the group, the dependencies not returned yet of every node,
+//           the node
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void TaskGraph::Start(TaskGroup& group, vector<atomic<size_t>>& waiting,
+                      Node node) {
+    TaskGroup* groupPointer = &group;
+    vector<atomic<size_t>>* waitingPointer = &waiting;
+    group.Run([this, groupPointer, waitingPointer, node]() {
+        // an exception leaves the successors waiting
+        m_vertices[node].Body();
+        for (Node successor : m_vertices[node].Successors) {
+            if ((*waitingPointer)[successor].fetch_sub(1) == 1) {
+                Start(*groupPointer, *waitingPointer, successor);
+            }
+        }
+    });
+}
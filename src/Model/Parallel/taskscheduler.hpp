@@ -0,0 +1,342 @@
+// [file name] : taskscheduler.hpp
+// [function] : declare the TaskScheduler, TaskGroup and TaskGraph classes
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init TaskScheduler, TaskGroup and TaskGraph classes
+// reason: import, export, the statistics and the duplicate checks each
+//         had to split their work on threads of their own
+// -----------------------------------------------------------
+
+#ifndef TASKSCHEDULER_HPP
+#define TASKSCHEDULER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+class TaskGroup;
+
+// notes on the class TaskScheduler
+// -----------------------------------------------------------
+// [class name] : TaskScheduler
+// [function] : run tasks on a fixed number of threads that steal work
+//              from each other
+// [notes on interface] :
+// 1. every worker thread has a queue of its own. a task spawned by a
+//    worker goes to the back of its queue and the worker takes its next
+//    task from the back too, an idle worker steals from the front of
+//    the other queues. tasks spawned by other threads go to a shared
+//    queue that every worker takes from
+// 2. Options::Threads counts the threads running tasks, the thread
+//    waiting for a TaskGroup runs tasks too, so Threads - 1 workers
+//    are started. 1 runs everything on the waiting thread, 0 takes the
+//    number of hardware threads. Options::PinThreads keeps every worker
+//    on one processor, it is ignored where the platform has no way
+//    to do it
+// 3. GetInstance returns the scheduler shared by the whole program,
+//    Configure sets its options before it is first used and returns
+//    false once it was created
+// 4. ParallelFor calls body(first, last) on ranges of at most grain
+//    indices that cover [begin, end) and returns when all of them
+//    returned. ParallelReduce calls map(first, last) on the ranges
+//    begin + k * grain, which do not depend on the number of threads,
+//    and combines the partial results pairwise in the order of the
+//    ranges, so the result is the same on every number of threads
+// 5. the first exception thrown by a task is thrown again by the
+//    function waiting for it, the other tasks still run
+// 6. GetStatistics returns the tasks run, the tasks stolen from another
+//    queue and the current and highest number of queued tasks
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class TaskScheduler
+{
+public:
+    // a task of the scheduler
+    using Task = function<void()>;
+    // the number of threads and the affinity
+    struct Options {
+        unsigned int Threads;
+        bool PinThreads;
+    };
+    // the counters of the scheduler
+    struct Statistics {
+        unsigned int Threads;
+        uint64_t Tasks;
+        uint64_t Steals;
+        uint64_t QueueDepth;
+        uint64_t PeakQueueDepth;
+    };
+
+    // constructor, start the workers
+    explicit TaskScheduler(const Options& options);
+    // destructor, stop the workers, no task may be queued anymore
+    ~TaskScheduler();
+    // set the options of the shared scheduler before its first use
+    static bool Configure(const Options& options);
+    // get the shared scheduler
+    static TaskScheduler& GetInstance();
+    // number of threads running tasks, the waiting thread included
+    unsigned int GetThreadCount() const;
+    // get and reset the counters
+    Statistics GetStatistics() const;
+    void ResetStatistics();
+    // call a body on ranges of indices covering [begin, end)
+    template <typename Body>
+    void ParallelFor(size_t begin, size_t end, size_t grain,
+                     const Body& body);
+    // map ranges of indices to partial results and combine them
+    template <typename T, typename Map, typename Combine>
+    T ParallelReduce(size_t begin, size_t end, size_t grain, T identity,
+                     const Map& map, const Combine& combine);
+
+private:
+    friend class TaskGroup;
+    // a queued task and the group waiting for it
+    struct Item {
+        Task Body;
+        TaskGroup* Group;
+    };
+    // the queue of a worker, the last one is the shared queue
+    struct Queue {
+        mutex Mutex;
+        deque<Item> Items;
+    };
+    // no copies, the workers refer to the scheduler
+    TaskScheduler(const TaskScheduler&) = delete;
+    void operator=(const TaskScheduler&) = delete;
+    // queue a task of a group
+    void Spawn(TaskGroup& group, Task task);
+    // run one queued task, false if there was none
+    bool RunOne();
+    // take a task, own queue first, then the shared one, then steal
+    bool Take(Item& item);
+    // body of the workers
+    void WorkerLoop(size_t index);
+    // keep the worker on one processor
+    static void PinCurrentThread(unsigned int processor);
+    // split a range in halves until it is at most grain indices long
+    template <typename Body>
+    void Split(TaskGroup& group, size_t begin, size_t end, size_t grain,
+               const Body& body);
+
+    // private member variables
+    bool m_pinThreads;
+    // one queue per worker and the shared queue
+    vector<unique_ptr<Queue>> m_queues;
+    vector<thread> m_threads;
+    // the mutex guards the sleeping workers
+    mutex m_sleepMutex;
+    condition_variable m_wake;
+    atomic<unsigned int> m_sleepers;
+    atomic<bool> m_stopping;
+    // the counters
+    atomic<uint64_t> m_queued;
+    atomic<uint64_t> m_peakQueued;
+    atomic<uint64_t> m_tasks;
+    atomic<uint64_t> m_steals;
+};
+
+// notes on the class TaskGroup
+// -----------------------------------------------------------
+// [class name] : TaskGroup
+// [function] : run tasks on a scheduler and wait for all of them
+// [notes on interface] :
+// 1. Run queues a task, a task of the group may run more tasks of it
+// 2. Wait runs queued tasks on the calling thread until every task of
+//    the group returned, then throws the first exception of a task
+// 3. the destructor waits too but drops the exception, call Wait
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class TaskGroup
+{
+public:
+    // constructor, no tasks yet
+    explicit TaskGroup(TaskScheduler& scheduler =
+                       TaskScheduler::GetInstance());
+    // destructor, wait for the tasks
+    ~TaskGroup();
+    // queue a task
+    void Run(TaskScheduler::Task task);
+    // wait for all tasks and throw the first exception of a task
+    void Wait();
+
+private:
+    friend class TaskScheduler;
+    // no copies, the queued tasks refer to the group
+    TaskGroup(const TaskGroup&) = delete;
+    void operator=(const TaskGroup&) = delete;
+    // run a task of the group and count it as finished
+    void Execute(TaskScheduler::Task& task);
+    // wait without throwing
+    void Join();
+
+    // private member variables
+    TaskScheduler& m_scheduler;
+    atomic<size_t> m_pending;
+    // the mutex guards the exception
+    mutex m_mutex;
+    condition_variable m_finished;
+    exception_ptr m_exception;
+};
+
+// notes on the class TaskGraph
+// -----------------------------------------------------------
+// [class name] : TaskGraph
+// [function] : run tasks that depend on each other
+// [notes on interface] :
+// 1. AddTask adds a task and returns its node, AddDependency makes a
+//    task wait for another one
+// 2. Run starts every task whose dependencies returned, as early as
+//    possible, and returns when all tasks ran. the tasks after one that
+//    threw do not run, the exception is thrown by Run
+// 3. Run throws invalid_argument before running anything if the
+//    dependencies have a cycle or name a node that does not exist
+// 4. a graph can be run again, the tasks are kept
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class TaskGraph
+{
+public:
+    // a task of the graph
+    using Node = size_t;
+    // add a task
+    Node AddTask(TaskScheduler::Task task);
+    // let a task wait for another one
+    void AddDependency(Node before, Node after);
+    // run all tasks
+    void Run(TaskScheduler& scheduler = TaskScheduler::GetInstance());
+
+private:
+    // a task and the tasks waiting for it
+    struct Vertex {
+        TaskScheduler::Task Body;
+        vector<Node> Successors;
+        size_t Predecessors;
+    };
+    // start a task whose dependencies returned
+    void Start(TaskGroup& group, vector<atomic<size_t>>& waiting,
+               Node node);
+
+    // private member variables
+    vector<Vertex> m_vertices;
+};
+
+// -----------------------------------------------------------
+// [name] : ParallelFor
+// [function] : call a body on ranges of indices covering [begin, end)
+// [input] : the range, the largest number of indices of a call, the
+//           body taking the first and the past-the-end index
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <typename Body>
+void TaskScheduler::ParallelFor(size_t begin, size_t end, size_t grain,
+                                const Body& body) {
+    if (grain == 0) {
+        grain = 1;
+    }
+    if (end <= begin) {
+        return;
+    }
+    // a single range or no worker, the caller does it all
+    if (end - begin <= grain || m_threads.empty()) {
+        for (size_t first = begin; first < end; first += grain) {
+            body(first, end - first > grain ? first + grain : end);
+        }
+        return;
+    }
+    TaskGroup group(*this);
+    Split(group, begin, end, grain, body);
+    group.Wait();
+}
+
+// -----------------------------------------------------------
+// [name] : Split
+// [function] : queue the upper halves of a range until the rest is at
+//              most grain indices long, then call the body on it
+// [input] : the group, the range, the grain, the body
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <typename Body>
+void TaskScheduler::Split(TaskGroup& group, size_t begin, size_t end,
+                          size_t grain, const Body& body) {
+    while (end - begin > grain) {
+        // split on a multiple of grain, the ranges stay full
+        size_t middle = begin + (end - begin) / grain / 2 * grain;
+        if (middle == begin) {
+            middle += grain;
+        }
+        const Body* pointer = &body;
+        TaskGroup* groupPointer = &group;
+        size_t last = end;
+        group.Run([this, groupPointer, middle, last, grain, pointer]() {
+            Split(*groupPointer, middle, last, grain, *pointer);
+        });
+        end = middle;
+    }
+    body(begin, end);
+}
+
+// -----------------------------------------------------------
+// [name] : ParallelReduce
+// [function] : map ranges of indices to partial results and combine
+//              them in a fixed order
+// [input] : the range, the number of indices of a partial result, the
+//           identity of combine, the map taking the first and the
+//           past-the-end index, the combine taking two partial results
+// [output] : the combined result, identity for an empty range
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <typename T, typename Map, typename Combine>
+T TaskScheduler::ParallelReduce(size_t begin, size_t end, size_t grain,
+                                T identity, const Map& map,
+                                const Combine& combine) {
+    if (grain == 0) {
+        grain = 1;
+    }
+    if (end <= begin) {
+        return identity;
+    }
+    size_t count = (end - begin + grain - 1) / grain;
+    vector<T> partial(count, identity);
+    ParallelFor(0, count, 1, [&](size_t first, size_t last) {
+        for (size_t k = first; k < last; k++) {
+            size_t from = begin + k * grain;
+            partial[k] = map(from, end - from > grain ? from + grain : end);
+        }
+    });
+    // pairwise, the rounding error of a sum grows with the depth only
+    for (size_t step = 1; step < count; step *= 2) {
+        for (size_t k = 0; k + step < count; k += 2 * step) {
+            partial[k] = combine(partial[k], partial[k + step]);
+        }
+    }
+    return partial[0];
+}
+
+#endif // TASKSCHEDULER_HPP
@@ -0,0 +1,196 @@
+// [file name] : progress.cpp
+// [function] : implement the Progress class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the Progress class
+// reason: to share the progress of an import between threads
+// -----------------------------------------------------------
+
+#include "progress.hpp"
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : Progress
+// [function] : constructor of the Progress class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Progress::Progress()
+    : m_totalBytes(0), m_bytes(0), m_faces(0), m_lines(0),
+      m_totalSteps(0), m_steps(0), m_cancelled(false) {}
+
+// -----------------------------------------------------------
+// [name] : SetTotalBytes
+// [function] : set the number of bytes of the whole input
+// [input] : the number of bytes
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Progress::SetTotalBytes(uint64_t bytes) {
+    m_totalBytes.store(bytes, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : AddBytes
+// [function] : add bytes read
+// [input] : the number of bytes
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Progress::AddBytes(uint64_t bytes) {
+    m_bytes.fetch_add(bytes, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : AddFaces
+// [function] : add faces built
+// [input] : the number of faces
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Progress::AddFaces(uint64_t faces) {
+    m_faces.fetch_add(faces, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : AddLines
+// [function] : add lines built
+// [input] : the number of lines
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Progress::AddLines(uint64_t lines) {
+    m_lines.fetch_add(lines, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : SetTotalSteps
+// [function] : set the number of steps of the operation
+// [input] : the number of steps
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Progress::SetTotalSteps(uint64_t steps) {
+    m_totalSteps.store(steps, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : AddSteps
+// [function] : add finished steps
+// [input] : the number of steps
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Progress::AddSteps(uint64_t steps) {
+    m_steps.fetch_add(steps, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetTotalBytes
+// [function] : get the number of bytes of the whole input
+// [input] : none
+// [output] : the number of bytes of the whole input
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Progress::GetTotalBytes() const {
+    return m_totalBytes.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetBytes
+// [function] : get the number of bytes read
+// [input] : none
+// [output] : the number of bytes read
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Progress::GetBytes() const {
+    return m_bytes.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetFaces
+// [function] : get the number of faces built
+// [input] : none
+// [output] : the number of faces built
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Progress::GetFaces() const {
+    return m_faces.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetLines
+// [function] : get the number of lines built
+// [input] : none
+// [output] : the number of lines built
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Progress::GetLines() const {
+    return m_lines.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetTotalSteps
+// [function] : get the number of steps of the operation
+// [input] : none
+// [output] : the number of steps of the operation
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Progress::GetTotalSteps() const {
+    return m_totalSteps.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : GetSteps
+// [function] : get the number of finished steps
+// [input] : none
+// [output] : the number of finished steps
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+uint64_t Progress::GetSteps() const {
+    return m_steps.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : Cancel
+// [function] : ask the operation to stop
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Progress::Cancel() {
+    m_cancelled.store(true, memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : IsCancelled
+// [function] : check if the operation was asked to stop
+// [input] : none
+// [output] : true after Cancel was called
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Progress::IsCancelled() const {
+    return m_cancelled.load(memory_order_relaxed);
+}
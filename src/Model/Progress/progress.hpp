@@ -0,0 +1,82 @@
+// [file name] : progress.hpp
+// [function] : declare the Progress class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init Progress class
+// reason: to show how far a long import has come and to cancel it
+//         while it runs on another thread
+// -----------------------------------------------------------
+
+#ifndef PROGRESS_HPP
+#define PROGRESS_HPP
+
+#include <atomic>
+#include <cstdint>
+
+using namespace std;
+
+// notes for the Progress class
+// -----------------------------------------------------------
+// [class name] : Progress
+// [function] : share the progress of a long operation between the thread
+//              running it and the threads watching it
+// [notes on interface] :
+// 1. the thread running the operation adds the bytes read and the faces
+//    and lines built, any other thread can read them at any time
+// 2. Cancel asks the operation to stop, the operation checks IsCancelled
+//    now and then and returns ErrorCode::CANCELLED
+// 3. all members are atomic, the counters are only meant for display,
+//    they are not synchronized with each other
+// 4. the object cannot be copied or moved, the threads share its address
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class Progress
+{
+public:
+    // constructor, init all counters to zero
+    Progress();
+    // set the number of bytes of the whole input, 0 if it is unknown
+    void SetTotalBytes(uint64_t bytes);
+    // add bytes read, faces built and lines built
+    void AddBytes(uint64_t bytes);
+    void AddFaces(uint64_t faces);
+    void AddLines(uint64_t lines);
+    // set the number of steps of the operation and add finished steps,
+    // e.g. the arguments of a batch
+    void SetTotalSteps(uint64_t steps);
+    void AddSteps(uint64_t steps);
+    // getters of the counters
+    uint64_t GetTotalBytes() const;
+    uint64_t GetBytes() const;
+    uint64_t GetFaces() const;
+    uint64_t GetLines() const;
+    uint64_t GetTotalSteps() const;
+    uint64_t GetSteps() const;
+    // ask the operation to stop
+    void Cancel();
+    // check if the operation was asked to stop
+    bool IsCancelled() const;
+
+private:
+    // no copies, the threads share the object
+    Progress(const Progress&) = delete;
+    void operator=(const Progress&) = delete;
+
+    // private member variables, the counters and the cancel flag
+    atomic<uint64_t> m_totalBytes;
+    atomic<uint64_t> m_bytes;
+    atomic<uint64_t> m_faces;
+    atomic<uint64_t> m_lines;
+    atomic<uint64_t> m_totalSteps;
+    atomic<uint64_t> m_steps;
+    atomic<bool> m_cancelled;
+};
+
+#endif // PROGRESS_HPP
@@ -0,0 +1,66 @@
+// [file name] : result.cpp
+// [function] : implement the functions on the ErrorCode enum class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the ErrorMessage function
+// reason: to keep the messages of the throwing functions unchanged
+//         when they are built on the functions returning error codes
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the message of CANCELLED
+// reason: to report an import stopped by the user
+// -----------------------------------------------------------
+
+#include "result.hpp"
+
+using namespace std;
+
+// messages of the error codes, in the order of the enum class
+static const char* const ERROR_MESSAGES[] = {
+    "No error",
+    "Path should not be empty.",
+    "Path is not a valid OBJ file.",
+    "Path does not exist.",
+    "Failed to open the file",
+    "Failed to parse",
+    "Index out of range",
+    "Face already exists",
+    "Line already exists",
+    "Point already exists in the container.",
+    "The three points are not distinct",
+    "The two points are the same",
+    "Point3D must have 3 coordinates",
+    "Invalid number format.",
+    "Exactly three numbers are required.",
+    "Invalid input.",
+    "There is no 3D model.",
+    "There is no 3D model to export.",
+    "Failed to export the 3D model.",
+    "The operation was cancelled."
+};
+
+static_assert(sizeof(ERROR_MESSAGES) / sizeof(ERROR_MESSAGES[0]) ==
+              static_cast<unsigned int>(ErrorCode::COUNT),
+              "every error code needs a message");
+
+// -----------------------------------------------------------
+// [name] : ErrorMessage
+// [function] : get the message of an error code
+// [input] : an error code
+// [output] : the message, a string literal
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const char* ErrorMessage(ErrorCode code) {
+    unsigned int index = static_cast<unsigned int>(code);
+    if (index >= static_cast<unsigned int>(ErrorCode::COUNT)) {
+        return "Unknown error";
+    }
+    return ERROR_MESSAGES[index];
+}
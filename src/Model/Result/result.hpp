@@ -0,0 +1,107 @@
+// [file name] : result.hpp
+// [function] : declare the ErrorCode enum class and the Result class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init ErrorCode enum class and Result class
+//       add ErrorMessage function
+// reason: the controller turned failures into responses by catching
+//         exceptions and comparing their messages, so every rejected input
+//         paid for a throw, an unwind and a chain of string comparisons
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add CANCELLED
+// reason: to report an import stopped by the user
+// -----------------------------------------------------------
+
+#ifndef RESULT_HPP
+#define RESULT_HPP
+
+#include <utility>
+
+using namespace std;
+
+// notes for the ErrorCode enum class
+// -----------------------------------------------------------
+// [enum class name] : ErrorCode
+// [function] : define the errors reported by the model without exceptions
+// [notes on interface] :
+// 1. NONE means success, every other value is one kind of failure
+// 2. the values are contiguous and start from 0, COUNT is the number of
+//    values, so a code can index a table directly
+// 3. add new codes before COUNT and extend the tables that use COUNT
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+enum class ErrorCode {
+    NONE,
+    EMPTY_PATH,
+    NOT_OBJ_PATH,
+    NOT_EXIST_PATH,
+    OPEN_FILE_FAILED,
+    PARSE_FAILED,
+    INDEX_OUT_OF_RANGE,
+    DUPLICATE_FACE,
+    DUPLICATE_LINE,
+    DUPLICATE_POINT,
+    NOT_A_FACE,
+    NOT_A_LINE,
+    NOT_A_POINT,
+    INVALID_NUMBER_FORMAT,
+    INPUT_NUMBER_ERROR,
+    INVALID_INPUT,
+    NO_3D_MODEL,
+    NO_MODEL_TO_EXPORT,
+    EXPORT_FAILED,
+    CANCELLED,
+    COUNT
+};
+
+// get the message of an error code, the same message that the throwing
+// functions put into their exceptions
+const char* ErrorMessage(ErrorCode code);
+
+// notes for the Result class
+// -----------------------------------------------------------
+// [class name] : Result
+// [function] : hold either a value or the error code of a failure
+// [notes on interface] :
+// 1. a Result is built implicitly from a value (success) or from an
+//    error code (failure), so a function can simply return either one
+// 2. check IsOk() before reading the value, the value of a failed result
+//    is default constructed, so T must be default constructible
+// 3. functions that have no value to return use ErrorCode directly
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <class T>
+class Result
+{
+public:
+    // constructor, a successful result holding a copy of the value
+    Result(const T& value) : m_code(ErrorCode::NONE), m_value(value) {}
+    // constructor, a successful result taking over the value
+    Result(T&& value) : m_code(ErrorCode::NONE), m_value(move(value)) {}
+    // constructor, a failed result
+    Result(ErrorCode code) : m_code(code), m_value() {}
+    // check if the result holds a value
+    bool IsOk() const { return m_code == ErrorCode::NONE; }
+    // getter of the error code, NONE for a successful result
+    ErrorCode GetError() const { return m_code; }
+    // getter of the value
+    const T& GetValue() const { return m_value; }
+    // getter of the value, the value can be moved out
+    T& GetValue() { return m_value; }
+
+private:
+    // private member variables, the error code and the value
+    ErrorCode m_code;
+    T m_value;
+};
+
+#endif // RESULT_HPP
@@ -0,0 +1,220 @@
+// [file name] : tracer.cpp
+// [function] : implement the Tracer class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the Tracer class
+// reason: to write the spans of an import, an export or an edit as a
+//         timeline
+// -----------------------------------------------------------
+
+#include "tracer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+const size_t Tracer::MAX_EVENTS = 1 << 20;
+atomic<bool> Tracer::m_running(false);
+
+// a finished span
+struct TraceEvent {
+    const char* Category;
+    const char* Name;
+    uint64_t Start;
+    uint64_t End;
+    uint32_t Thread;
+};
+
+// the state of the running trace, guarded by g_traceMutex
+static mutex g_traceMutex;
+static vector<TraceEvent> g_traceEvents;
+static string g_tracePath;
+static uint64_t g_traceOrigin = 0;
+static uint64_t g_traceDropped = 0;
+
+// the number of the next thread that records a span
+static atomic<uint32_t> g_nextThread(1);
+
+// -----------------------------------------------------------
+// [name] : Now
+// [function] : read a steady clock
+// [input] : none
+// [output] : the time in nanoseconds, never 0
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t Now() {
+    uint64_t now = static_cast<uint64_t>(
+        chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count());
+    return now == 0 ? 1 : now;
+}
+
+// -----------------------------------------------------------
+// [name] : ThreadNumber
+// [function] : get a small number of the calling thread
+// [input] : none
+// [output] : the number, the same for every call of a thread
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint32_t ThreadNumber() {
+    static thread_local uint32_t number = g_nextThread.fetch_add(1);
+    return number;
+}
+
+// -----------------------------------------------------------
+// [name] : Span
+// [function] : constructor of the Span class
+// [input] : the category and the name, string literals
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Tracer::Span::Span(const char* category, const char* name)
+    : m_category(category), m_name(name),
+      m_start(m_running.load(memory_order_relaxed) ? Now() : 0) {}
+
+// -----------------------------------------------------------
+// [name] : ~Span
+// [function] : destructor of the Span class, keep the span
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Tracer::Span::~Span() {
+    if (m_start != 0 && m_running.load(memory_order_relaxed)) {
+        Record(m_category, m_name, m_start, Now());
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : IsAvailable
+// [function] : check if the spans were compiled in
+// [input] : none
+// [output] : true if the program was built with HW_TRACE
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Tracer::IsAvailable() {
+#ifdef HW_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+// -----------------------------------------------------------
+// [name] : Start
+// [function] : begin a trace
+// [input] : the path of the file written by Stop
+// [output] : false if a trace is already running
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Tracer::Start(const string& path) {
+    lock_guard<mutex> lock(g_traceMutex);
+    if (m_running.load()) {
+        return false;
+    }
+    g_traceEvents.clear();
+    g_tracePath = path;
+    g_traceOrigin = Now();
+    g_traceDropped = 0;
+    m_running.store(true);
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : Stop
+// [function] : end the trace and write it in the Trace Event Format
+// [input] : none
+// [output] : false if no trace was running or the file cannot be
+//            written
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Tracer::Stop() {
+    vector<TraceEvent> events;
+    string path;
+    uint64_t origin, dropped;
+    {
+        lock_guard<mutex> lock(g_traceMutex);
+        if (!m_running.load()) {
+            return false;
+        }
+        m_running.store(false);
+        events.swap(g_traceEvents);
+        path = g_tracePath;
+        origin = g_traceOrigin;
+        dropped = g_traceDropped;
+    }
+    ofstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    // complete events, the times are in microseconds since Start
+    file << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":"
+         << dropped << "},\"traceEvents\":[";
+    char buffer[96];
+    for (size_t i = 0; i < events.size(); i++) {
+        const TraceEvent& event = events[i];
+        uint64_t start = event.Start > origin ? event.Start - origin : 0;
+        uint64_t duration = event.End > event.Start
+                                ? event.End - event.Start : 0;
+        // the names are string literals of the program, no escaping
+        file << (i == 0 ? "\n" : ",\n") << "{\"cat\":\"" << event.Category
+             << "\",\"name\":\"" << event.Name << "\",\"ph\":\"X\"";
+        snprintf(buffer, sizeof(buffer),
+                 ",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                 start / 1e3, duration / 1e3, event.Thread);
+        file << buffer;
+    }
+    file << "\n]}" << endl;
+    return static_cast<bool>(file);
+}
+
+// -----------------------------------------------------------
+// [name] : IsRunning
+// [function] : check if a trace is running
+// [input] : none
+// [output] : true between Start and Stop
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool Tracer::IsRunning() {
+    return m_running.load(memory_order_relaxed);
+}
+
+// -----------------------------------------------------------
+// [name] : Record
+// [function] : keep a span of the running trace
+// [input] : the category, the name, the start and the end in
+//           nanoseconds
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Tracer::Record(const char* category, const char* name,
+                    uint64_t start, uint64_t end) {
+    uint32_t thread = ThreadNumber();
+    lock_guard<mutex> lock(g_traceMutex);
+    // the trace may have stopped since the span checked it
+    if (!m_running.load(memory_order_relaxed)) {
+        return;
+    }
+    if (g_traceEvents.size() >= MAX_EVENTS) {
+        g_traceDropped++;
+        return;
+    }
+    g_traceEvents.push_back(TraceEvent{category, name, start, end, thread});
+}
@@ -0,0 +1,112 @@
+// [file name] : tracer.hpp
+// [function] : declare the Tracer class and the TRACE_SCOPE macro
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init Tracer class
+// reason: a slow import could not be split into reading, parsing,
+//         validating and sharing the elements without a profiler
+// -----------------------------------------------------------
+
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+// TRACE_SCOPE(category, name) records the time from this line to the end
+// of the enclosing block. both arguments are string literals. without
+// HW_TRACE, e.g. in the debug and release modes, it compiles to nothing
+#ifdef HW_TRACE
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(category, name) \
+    Tracer::Span TRACE_CONCAT(traceSpan, __LINE__)(category, name)
+#else
+#define TRACE_SCOPE(category, name) ((void)0)
+#endif
+
+// notes on the class Tracer
+// -----------------------------------------------------------
+// [class name] : Tracer
+// [function] : collect timed spans and write them as a Chrome trace
+// [notes on interface] :
+// 1. the spans are placed with TRACE_SCOPE, which is only compiled in
+//    with HW_TRACE (xmake f -m trace). IsAvailable tells if it was
+// 2. Start begins a trace, the spans ending until Stop are kept and
+//    Stop writes them to the file given to Start. the file is the
+//    Trace Event Format of Chrome, it opens in chrome://tracing and
+//    in Perfetto
+// 3. while no trace is running a span costs one atomic load. a running
+//    trace keeps at most MAX_EVENTS spans, later ones are counted as
+//    dropped
+// 4. the names are not copied, they must live until Stop, e.g. string
+//    literals
+// 5. all functions can be called from any thread, the class only has
+//    static members
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class Tracer
+{
+public:
+    // the most spans kept by one trace
+    static const size_t MAX_EVENTS;
+
+    // notes for the Span class
+    // -----------------------------------------------------------
+    // [class name] : Span
+    // [function] : record the time from its construction to its
+    //              destruction, if a trace is running at both
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -----------------------------------------------------------
+    class Span
+    {
+    public:
+        // constructor, read the clock if a trace is running
+        Span(const char* category, const char* name);
+        // destructor, keep the span
+        ~Span();
+    private:
+        // no copies, a span is one block
+        Span(const Span&) = delete;
+        void operator=(const Span&) = delete;
+
+        // private member variables
+        const char* m_category;
+        const char* m_name;
+        // the start in nanoseconds, 0 if no trace was running
+        uint64_t m_start;
+    };
+
+    // check if the spans were compiled in
+    static bool IsAvailable();
+    // begin a trace written to a file by Stop, false if one is running
+    static bool Start(const string& path);
+    // end the trace and write it, false if it cannot be written
+    static bool Stop();
+    // check if a trace is running
+    static bool IsRunning();
+
+private:
+    // static class, no instances
+    Tracer() = delete;
+    // keep a span
+    static void Record(const char* category, const char* name,
+                       uint64_t start, uint64_t end);
+
+    // private member variables
+    static atomic<bool> m_running;
+};
+
+#endif // TRACER_HPP
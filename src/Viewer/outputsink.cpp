@@ -0,0 +1,135 @@
+// [file name] : outputsink.cpp
+// [function] : implement the OutputSink class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the OutputSink class
+// reason: to write long listings in large blocks
+// -----------------------------------------------------------
+
+#include "outputsink.hpp"
+#include <string>
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : OutputSink
+// [function] : constructor of the OutputSink class
+// [input] : the stream, the size of the buffer in bytes
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+OutputSink::OutputSink(ostream& out, size_t capacity)
+    : m_out(out), m_capacity(capacity) {
+    m_buffer.reserve(capacity);
+}
+
+// -----------------------------------------------------------
+// [name] : ~OutputSink
+// [function] : destructor of the OutputSink class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+OutputSink::~OutputSink() {
+    Flush();
+}
+
+// -----------------------------------------------------------
+// [name] : Write
+// [function] : append text to the buffer
+// [input] : the text
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void OutputSink::Write(const string& text) {
+    m_buffer += text;
+    WriteIfFull();
+}
+
+// -----------------------------------------------------------
+// [name] : Write
+// [function] : append text of a given length to the buffer
+// [input] : the text, its length
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void OutputSink::Write(const char* text, size_t length) {
+    m_buffer.append(text, length);
+    WriteIfFull();
+}
+
+// -----------------------------------------------------------
+// [name] : Write
+// [function] : append a character to the buffer
+// [input] : the character
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void OutputSink::Write(char character) {
+    m_buffer += character;
+    WriteIfFull();
+}
+
+// -----------------------------------------------------------
+// [name] : Write
+// [function] : append an unsigned number to the buffer
+// [input] : the number
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void OutputSink::Write(size_t number) {
+    // write the digits backwards into a small array
+    char digits[24];
+    size_t length = 0;
+    do {
+        digits[sizeof(digits) - 1 - length] =
+            static_cast<char>('0' + number % 10);
+        number /= 10;
+        length++;
+    } while (number != 0);
+    Write(digits + sizeof(digits) - length, length);
+}
+
+// -----------------------------------------------------------
+// [name] : Flush
+// [function] : write the buffer to the stream and flush the stream
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void OutputSink::Flush() {
+    if (!m_buffer.empty()) {
+        m_out.write(m_buffer.data(),
+                    static_cast<streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+    m_out.flush();
+}
+
+// -----------------------------------------------------------
+// [name] : WriteIfFull
+// [function] : write the buffer to the stream if it reached its capacity
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void OutputSink::WriteIfFull() {
+    if (m_buffer.size() >= m_capacity) {
+        m_out.write(m_buffer.data(),
+                    static_cast<streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+}
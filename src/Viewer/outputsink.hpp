@@ -0,0 +1,71 @@
+// [file name] : outputsink.hpp
+// [function] : declare the OutputSink class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init OutputSink class
+// reason: listing faces flushed the terminal after every line,
+//         printing millions of rows took minutes
+// -----------------------------------------------------------
+
+#ifndef OUTPUTSINK_HPP
+#define OUTPUTSINK_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+// notes on the class OutputSink
+// -----------------------------------------------------------
+// [class name] : OutputSink
+// [function] : collect text in a buffer and write it to a stream in
+//              large blocks
+// [notes on interface] :
+// 1. the text is written to the stream once the buffer reaches its
+//    capacity, when Flush is called and when the sink is destroyed
+// 2. the stream is not flushed after every line, so text written to the
+//    stream directly may appear before the text of the sink until Flush
+//    is called
+// 3. the sink cannot be copied, it refers to the stream
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class OutputSink
+{
+public:
+    // constructor, the stream and the size of the buffer in bytes
+    OutputSink(ostream& out, size_t capacity = 1 << 16);
+    // destructor, write the rest of the buffer
+    ~OutputSink();
+    // append text
+    void Write(const string& text);
+    // append text of a given length
+    void Write(const char* text, size_t length);
+    // append a character
+    void Write(char character);
+    // append an unsigned number
+    void Write(size_t number);
+    // write the buffer to the stream and flush the stream
+    void Flush();
+
+private:
+    // no copies, the sink refers to the stream
+    OutputSink(const OutputSink&) = delete;
+    void operator=(const OutputSink&) = delete;
+    // write the buffer to the stream if it is full
+    void WriteIfFull();
+
+    // private member variables, the stream, the buffer and its capacity
+    ostream& m_out;
+    string m_buffer;
+    size_t m_capacity;
+};
+
+#endif // OUTPUTSINK_HPP
@@ -0,0 +1,381 @@
+// [file name] : scriptrunner.cpp
+// [function] : implement the ScriptRunner class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the ScriptRunner class
+// reason: to run the program without the menus
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: format the values of a response one at a time
+// reason: with --quiet the values are no longer formatted at all
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add pages to faces and lines, add countfaces and countlines
+//       write the values without flushing after every line
+// reason: to list huge models in parts
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: execute the commands through a handler that can be replaced
+// reason: to run scripts against the server from the client
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the metrics command
+// reason: to report the latency of every command
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the memory command
+// reason: to report the bytes used by the model
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the filestats command
+// reason: to get the statistics of a file without importing it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the topology command
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
+
+#include "scriptrunner.hpp"
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using ArgKey = Argument::ArgumentKey;
+
+// one parsed command of a script
+struct ScriptCommand {
+    unsigned int LineNumber;
+    string Text;
+};
+
+// -----------------------------------------------------------
+// [name] : Trim
+// [function] : delete the leading and trailing whitespace of a string
+// [input] : a string
+// [output] : the trimmed string
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static string Trim(const string& text) {
+    const char* spaces = " \t\r\n\v\f";
+    size_t first = text.find_first_not_of(spaces);
+    if (first == string::npos) {
+        return "";
+    }
+    size_t last = text.find_last_not_of(spaces);
+    return text.substr(first, last - first + 1);
+}
+
+// -----------------------------------------------------------
+// [name] : SplitPoints
+// [function] : split the points of addface and addline
+// [input] : the text after the command word, the vector receiving
+//           the points
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void SplitPoints(const string& text, vector<string>& points) {
+    if (text.find('(') != string::npos) {
+        // every point is put in parentheses
+        size_t begin = text.find('(');
+        while (begin != string::npos) {
+            size_t end = text.find(')', begin);
+            if (end == string::npos) {
+                // let the controller report the unbalanced point
+                points.push_back(Trim(text.substr(begin)));
+                return;
+            }
+            points.push_back(text.substr(begin, end - begin + 1));
+            begin = text.find('(', end);
+        }
+        return;
+    }
+    // the points are separated by ';'
+    stringstream stream(text);
+    string point;
+    while (getline(stream, point, ';')) {
+        point = Trim(point);
+        if (!point.empty()) {
+            points.push_back(point);
+        }
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : ScriptRunner
+// [function] : constructor of the ScriptRunner class
+// [input] : the stream receiving the report, whether to continue after
+//           a failed command, whether to send all commands at once,
+//           whether to hide the values of the responses
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+ScriptRunner::ScriptRunner(ostream& out, bool continueOnError, bool batch,
+                           bool quiet)
+    : m_out(out), m_continueOnError(continueOnError), m_batch(batch),
+      m_quiet(quiet) {}
+
+// -----------------------------------------------------------
+// [name] : ParseCommand
+// [function] : translate one command line into an argument
+// [input] : the command line without comments, the argument key and
+//           the values to fill
+// [output] : false if the line is not a valid command
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool ScriptRunner::ParseCommand(const string& line, ArgKey& key,
+                                vector<string>& values) {
+    values.clear();
+    string text = Trim(line);
+    size_t wordEnd = text.find_first_of(" \t");
+    string word = text.substr(0, wordEnd);
+    string rest = wordEnd == string::npos ? "" : Trim(text.substr(wordEnd));
+    // the tokens of the rest, for the commands taking indices
+    vector<string> tokens;
+    stringstream stream(rest);
+    string token;
+    while (stream >> token) {
+        tokens.push_back(token);
+    }
+
+    if (word == "import" || word == "export" || word == "filestats") {
+        // the path may contain spaces
+        if (rest.empty()) {
+            return false;
+        }
+        key = word == "import" ? ArgKey::IMPORT_3D_MODEL
+            : word == "export" ? ArgKey::EXPORT_3D_MODEL
+                               : ArgKey::FILE_STATISTICS;
+        values.push_back(rest);
+        return true;
+    }
+    if (word == "faces" || word == "lines") {
+        // an optional offset and limit
+        if (tokens.size() > 2) {
+            return false;
+        }
+        key = word == "faces" ? ArgKey::DISPLAY_ALL_FACES
+                              : ArgKey::DISPLAY_ALL_LINES;
+        values = tokens;
+        return true;
+    }
+    if (word == "countfaces" || word == "countlines" || word == "stats" ||
+        word == "memory" || word == "topology") {
+        if (!rest.empty()) {
+            return false;
+        }
+        key = word == "countfaces" ? ArgKey::COUNT_FACES
+            : word == "countlines" ? ArgKey::COUNT_LINES
+            : word == "stats"      ? ArgKey::DISPLAY_STATISTICS
+            : word == "memory"     ? ArgKey::DISPLAY_MEMORY
+                                   : ArgKey::DISPLAY_TOPOLOGY;
+        return true;
+    }
+    if (word == "metrics") {
+        // json, reset, on or off, the controller checks the value
+        if (tokens.size() > 1) {
+            return false;
+        }
+        key = ArgKey::DISPLAY_METRICS;
+        values = tokens;
+        return true;
+    }
+    if (word == "face" || word == "line" || word == "delface" ||
+        word == "delline") {
+        if (tokens.size() != 1) {
+            return false;
+        }
+        key = word == "face"    ? ArgKey::DISPLAY_FACE_POINTS
+            : word == "line"    ? ArgKey::DISPLAY_LINE_POINTS
+            : word == "delface" ? ArgKey::DELETE_FACE
+                                : ArgKey::DELETE_LINE;
+        values.push_back(tokens[0]);
+        return true;
+    }
+    if (word == "addface" || word == "addline") {
+        SplitPoints(rest, values);
+        if (values.empty()) {
+            return false;
+        }
+        key = word == "addface" ? ArgKey::ADD_FACE : ArgKey::ADD_LINE;
+        return true;
+    }
+    if (word == "setface" || word == "setline") {
+        if (tokens.size() < 3) {
+            return false;
+        }
+        key = word == "setface" ? ArgKey::MODIFY_FACE_POINT
+                                : ArgKey::MODIFY_LINE_POINT;
+        // the point is the text after the two indices
+        stringstream indices(rest);
+        string faceIndex, pointIndex, point;
+        indices >> faceIndex >> pointIndex;
+        getline(indices, point);
+        values.push_back(faceIndex);
+        values.push_back(pointIndex);
+        values.push_back(Trim(point));
+        return true;
+    }
+    return false;
+}
+
+// -----------------------------------------------------------
+// [name] : Run
+// [function] : run all commands of a script through the controller
+// [input] : the script
+// [output] : 0 if every command succeeded, 1 if a command failed,
+//            2 if the script has a syntax error
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+int ScriptRunner::Run(istream& script) {
+    // parse the whole script first, so a typo does not leave
+    // the model half edited
+    vector<ScriptCommand> commands;
+    vector<Argument> arguments;
+    string line;
+    unsigned int lineNumber = 0;
+    while (getline(script, line)) {
+        lineNumber++;
+        string text = Trim(line);
+        if (text.empty() || text[0] == '#') {
+            continue;
+        }
+        ArgKey key;
+        vector<string> values;
+        if (!ParseCommand(text, key, values)) {
+            m_out << "line " << lineNumber << ": invalid command: "
+                  << text << endl;
+            return 2;
+        }
+        commands.push_back(ScriptCommand{lineNumber, text});
+        arguments.push_back(Argument(key, values));
+    }
+
+    Controller::BatchMode mode =
+        m_continueOnError ? Controller::BatchMode::CONTINUE_ON_ERROR
+                          : Controller::BatchMode::STOP_ON_ERROR;
+    unsigned int failed = 0;
+    unsigned int executed = 0;
+    double total = 0.0;
+    if (m_batch) {
+        // one call for the whole script, only the total time is known
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        vector<Response> responses = Execute(arguments, mode);
+        total = chrono::duration<double, milli>(
+                    chrono::steady_clock::now() - start).count();
+        for (size_t i = 0; i < responses.size(); i++) {
+            PrintResponse(commands[i].LineNumber, commands[i].Text,
+                          responses[i], -1.0);
+            if (!responses[i].IsSuccess()) {
+                failed++;
+            }
+        }
+        executed = static_cast<unsigned int>(responses.size());
+    }
+    else {
+        for (size_t i = 0; i < arguments.size(); i++) {
+            chrono::steady_clock::time_point start =
+                chrono::steady_clock::now();
+            vector<Response> responses =
+                Execute(vector<Argument>{arguments[i]}, mode);
+            double elapsed = chrono::duration<double, milli>(
+                                 chrono::steady_clock::now() - start).count();
+            total += elapsed;
+            executed++;
+            PrintResponse(commands[i].LineNumber, commands[i].Text,
+                          responses[0], elapsed);
+            if (!responses[0].IsSuccess()) {
+                failed++;
+                if (!m_continueOnError) {
+                    break;
+                }
+            }
+        }
+    }
+
+    m_out << executed << " of " << commands.size() << " commands executed, "
+          << failed << " failed, " << fixed << setprecision(3) << total
+          << " ms" << endl;
+    return failed == 0 ? 0 : 1;
+}
+
+// -----------------------------------------------------------
+// [name] : SetHandler
+// [function] : send the commands to another handler than the controller
+// [input] : the handler, empty for the controller
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void ScriptRunner::SetHandler(Handler handler) {
+    m_handler = move(handler);
+}
+
+// -----------------------------------------------------------
+// [name] : Execute
+// [function] : execute a batch with the handler or the controller
+// [input] : the arguments, what to do after a failed argument
+// [output] : the responses
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<Response> ScriptRunner::Execute(const vector<Argument>& arguments,
+                                       Controller::BatchMode mode) {
+    if (m_handler) {
+        return m_handler(arguments, mode);
+    }
+    return Controller::GetInstance()->HandleArguments(arguments, mode);
+}
+
+// -----------------------------------------------------------
+// [name] : PrintResponse
+// [function] : print one response with its command
+// [input] : the line number and the text of the command, the response,
+//           the time spent in the controller, negative if unknown
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void ScriptRunner::PrintResponse(unsigned int lineNumber,
+                                 const string& command,
+                                 const Response& response,
+                                 double milliseconds) {
+    m_out << lineNumber << ": " << command << " -> "
+          << Response::KeyName(response.GetKey());
+    if (milliseconds >= 0.0) {
+        m_out << " (" << fixed << setprecision(3) << milliseconds << " ms)";
+    }
+    m_out << endl;
+    if (m_quiet) {
+        return;
+    }
+    // format the values one at a time into a reused buffer
+    string row;
+    for (size_t i = 0; i < response.GetValueCount(); i++) {
+        row.assign("    ");
+        response.AppendValue(i, row);
+        row += '\n';
+        m_out << row;
+    }
+}
@@ -0,0 +1,130 @@
+// [file name] : scriptrunner.hpp
+// [function] : declare the ScriptRunner class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init ScriptRunner class
+//       add a compact command language mapped onto arguments
+// reason: to run the program without the menus, e.g. for reproducible
+//         timings of whole workloads
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add pages to faces and lines, add countfaces and countlines
+// reason: to list huge models in parts
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add SetHandler
+// reason: to run scripts against the server from the client
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the metrics command
+// reason: to report the latency of every command
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the memory command
+// reason: to report the bytes used by the model
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the filestats command
+// reason: to get the statistics of a file without importing it
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the topology command
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
+
+#ifndef SCRIPTRUNNER_HPP
+#define SCRIPTRUNNER_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <iostream>
+#include "../Controller/controller.hpp"
+#include "../Message/argument.hpp"
+#include "../Message/response.hpp"
+
+using namespace std;
+
+// notes on the class ScriptRunner
+// -----------------------------------------------------------
+// [class name] : ScriptRunner
+// [function] : run a script of commands through the controller
+// [notes on interface] :
+// 1. a script has one command per line, blank lines and lines starting
+//    with '#' are skipped. the commands are:
+//        import PATH            export PATH
+//        faces [OFFSET [LIMIT]] lines [OFFSET [LIMIT]]
+//        countfaces             countlines
+//        face I                 line I
+//        addface P; P; P        addline P; P
+//        delface I              delline I
+//        setface I J P          setline I J P
+//        stats                  metrics [json|reset|on|off]
+//        memory                 filestats PATH
+//        topology
+//    a point P is written as in the menus, e.g. "1 2 3" or "(1, 2, 3)",
+//    the points of addface and addline are separated by ';' or each one
+//    is put in parentheses
+// 2. Run prints one line per command with the line number, the command,
+//    the response key and the time spent in the controller, followed by
+//    the values of the response unless quiet is set, then a summary
+// 3. in batch mode all commands are sent in one HandleArguments call,
+//    only the total time is measured
+// 4. by default the script stops at the first failed command, with
+//    continueOnError the remaining commands are still executed
+// 5. Run returns 0 if every command succeeded, 1 if a command failed
+//    and 2 if the script has a syntax error
+// 6. the commands are sent to HandleArguments of the controller, unless
+//    another handler is set, e.g. one sending them to the server. a
+//    handler returns at least one response for every batch
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class ScriptRunner
+{
+public:
+    // executes a batch of arguments instead of the controller
+    using Handler = function<vector<Response>(
+        const vector<Argument>& arguments, Controller::BatchMode mode)>;
+    // constructor, the stream receiving the report and the options
+    ScriptRunner(ostream& out, bool continueOnError = false,
+                 bool batch = false, bool quiet = false);
+    // run all commands of a script, return the exit code
+    int Run(istream& script);
+    // translate one command line into an argument key and its values
+    // return false if the line is not a valid command
+    static bool ParseCommand(const string& line, Argument::ArgumentKey& key,
+                             vector<string>& values);
+    // send the commands to another handler than the controller
+    void SetHandler(Handler handler);
+
+private:
+    // execute a batch with the handler or the controller
+    vector<Response> Execute(const vector<Argument>& arguments,
+                             Controller::BatchMode mode);
+    // print one response with its command
+    void PrintResponse(unsigned int lineNumber, const string& command,
+                       const Response& response, double milliseconds);
+
+    // private member variables, the output stream and the options
+    ostream& m_out;
+    bool m_continueOnError;
+    bool m_batch;
+    bool m_quiet;
+    // the handler, empty for the controller
+    Handler m_handler;
+};
+
+#endif // SCRIPTRUNNER_HPP
@@ -23,8 +23,53 @@
 //       add functions to handle responses
 // reason: to support displaying the model and handling responses
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: take the vector of responses returned by HandleArguments
+// reason: the controller now returns one response per argument
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: format the displayed values one at a time from the response
+// reason: the controller returns typed payloads instead of strings
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: stream all faces and lines through an OutputSink
+//       print the index of the first value of a page
+//       show the counts of faces and lines
+// reason: the terminal was flushed after every line of a listing
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: import and export in the background and show the progress
+// reason: a large import froze the viewer without any feedback
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the metrics to the start menu
+// reason: to show the latency of the commands
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: show the memory of the model with the statistics
+// reason: to tell which part of a big model uses the memory
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: show the topology of the model with the statistics
+// reason: to tell if the faces of a model close a solid
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: cancel the background command on Ctrl+C, show CANCELLED
+// reason: a long import or export could only be waited for
+// -----------------------------------------------------------
 
 #include "viewer.hpp"
+#include "outputsink.hpp"
+#include <chrono>
+#include <thread>
 #include <iostream>
 #include <exception>
 #include "../Message/argument.hpp"
@@ -36,7 +81,9 @@
 #include <cmath>
 #include <limits>
 #include <cstdlib>
+#include <cstdint>
 #include <regex>
+#include <csignal>
 #include "../Model/Element3D/face3d.hpp"
 #include "../Model/Element3D/line3d.hpp"
 #include "../Model/Element3D/point3d.hpp"
@@ -46,6 +93,21 @@ using namespace std;
 using ArgKey = Argument::ArgumentKey;
 using ResKey = Response::ResponseKey;
 
+// set by the SIGINT handler while a command runs in the background
+static volatile sig_atomic_t g_interrupted = 0;
+
+// -----------------------------------------------------------
+// [name] : OnInterrupt
+// [function] : handler of SIGINT while a command runs in the background
+// [input] : the signal
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void OnInterrupt(int) {
+    g_interrupted = 1;
+}
+
 // -----------------------------------------------------------
 // [name] : HandleResponses
 // [function] : handle the responses from the controller
@@ -124,31 +186,55 @@ void Viewer::HandleResponses(const vector<Response>& responses)
     // Check if displaying all faces
     if (responses[0].GetKey() == ResKey::DISPLAY_ALL_FACES) {
         cout << "Display all faces:" << endl;
-        DisplayAllFaces(responses[0].GetValues());
+        DisplayAllFaces(responses[0]);
         return;
     }
     // Check if displaying face points
     if (responses[0].GetKey() == ResKey::DISPLAY_FACE_POINTS) {
         cout << "Display face points:" << endl;
-        DisplayFacePoints(responses[0].GetValues());
+        DisplayFacePoints(responses[0]);
         return;
     }
     // Check if displaying all lines
     if (responses[0].GetKey() == ResKey::DISPLAY_ALL_LINES) {
         cout << "Display all lines:" << endl;
-        DisplayAllLines(responses[0].GetValues());
+        DisplayAllLines(responses[0]);
         return;
     }
     // Check if displaying line points
     if (responses[0].GetKey() == ResKey::DISPLAY_LINE_POINTS) {
         cout << "Display line points:" << endl;
-        DisplayLinePoints(responses[0].GetValues());
+        DisplayLinePoints(responses[0]);
+        return;
+    }
+    // Check if displaying the number of faces or lines
+    if (responses[0].GetKey() == ResKey::DISPLAY_FACE_COUNT ||
+        responses[0].GetKey() == ResKey::DISPLAY_LINE_COUNT) {
+        DisplayStatistics(responses[0]);
         return;
     }
     // Check if displaying statistics
     if (responses[0].GetKey() == ResKey::DISPLAY_STATISTICS) {
         cout << "Display statistics:" << endl;
-        DisplayStatistics(responses[0].GetValues());
+        DisplayStatistics(responses[0]);
+        return;
+    }
+    // Check if displaying the topology
+    if (responses[0].GetKey() == ResKey::DISPLAY_TOPOLOGY) {
+        cout << "Display topology:" << endl;
+        DisplayStatistics(responses[0]);
+        return;
+    }
+    // Check if displaying memory
+    if (responses[0].GetKey() == ResKey::DISPLAY_MEMORY) {
+        cout << "Display memory:" << endl;
+        DisplayStatistics(responses[0]);
+        return;
+    }
+    // Check if displaying metrics
+    if (responses[0].GetKey() == ResKey::DISPLAY_METRICS) {
+        cout << "Display metrics:" << endl;
+        DisplayStatistics(responses[0]);
         return;
     }
     // Check for unknown invalid argument
@@ -256,6 +342,11 @@ void Viewer::HandleResponses(const vector<Response>& responses)
         cout << "Please import a 3D model first." << endl;
         return;
     }
+    // Check if the command was cancelled
+    if (responses[0].GetKey() == ResKey::CANCELLED) {
+        cout << "Cancelled, the model is unchanged." << endl;
+        return;
+    }
     cout << "An unknown error occurred. Please try again." << endl;
     return;
 }
@@ -281,7 +372,8 @@ void Viewer::Start()
             cout << "1. Import 3D Model" << endl;
             cout << "2. Export 3D Model" << endl;
             cout << "3. Modify 3D Model" << endl;
-            cout << "4. Exit" << endl;
+            cout << "4. Show metrics" << endl;
+            cout << "5. Exit" << endl;
             cout << "Enter your choice: ";
 
             string arg;
@@ -306,6 +398,10 @@ void Viewer::Start()
                 break;
 
             case 4 :
+                ShowShowMetrics();
+                break;
+
+            case 5 :
             // exit the program
                 IsRunning = false;
                 break;
@@ -349,15 +445,13 @@ void Viewer::ShowImportModel()
             cout << "Exiting import model process." << endl;
             return;
         }
-        // get the controller instance
-        Controller* controller = Controller::GetInstance();
         // create an argument object
         Argument arg(ArgKey::IMPORT_3D_MODEL, vector<string>{path});
-        // get the response from the controller
-        Response response = 
-                (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // get the responses from the controller, a large file is read
+        // in the background while the progress is shown
+        vector<Response> responses = RunInBackground(arg);
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -389,15 +483,12 @@ void Viewer::ShowExportModel()
             cout << "Exiting export model process." << endl;
             return;
         }
-        // get the controller instance
-        Controller* controller = Controller::GetInstance();
         // create an argument object
         Argument arg(ArgKey::EXPORT_3D_MODEL, vector<string>{path});
-        // get the response from the controller
-        Response response = 
-                (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // get the responses from the controller
+        vector<Response> responses = RunInBackground(arg);
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -519,13 +610,30 @@ void Viewer::ShowListAllFaces() {
     try {
         // get the controller instance
         Controller* controller = Controller::GetInstance();
-        // create an argument object
-        Argument arg(ArgKey::DISPLAY_ALL_FACES, vector<string>());
-        // get the response from the controller
-        Response response = 
-                (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // write the faces straight to the output, one block at a time
+        OutputSink sink(cout);
+        bool first = true;
+        ErrorCode code = (*controller).StreamFaces(0, SIZE_MAX,
+            [&sink, &first](size_t index, const string& row) {
+                if (first) {
+                    sink.Write(string("Display all faces:\n"));
+                    first = false;
+                }
+                sink.Write(string("Face "));
+                sink.Write(index);
+                sink.Write('\n');
+                sink.Write(row);
+                sink.Write('\n');
+            });
+        sink.Flush();
+        if (code != ErrorCode::NONE) {
+            HandleResponses(vector<Response>{
+                Response(Controller::ToResponseKey(code), {})});
+        }
+        else if (first) {
+            // a model without faces
+            cout << "Display all faces:" << endl;
+        }
     }
     catch (const exception& e) {
         // handle exception here
@@ -552,11 +660,11 @@ void Viewer::ShowDeleteFace() {
         Controller* controller = Controller::GetInstance();
         // create an argument object
         Argument arg(ArgKey::DELETE_FACE, vector<string>{face_id});
-        // get the response from the controller
-        Response response = 
+        // get the responses from the controller
+        vector<Response> responses = 
                 (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -591,11 +699,11 @@ void Viewer::ShowAddFace() {
         Controller* controller = Controller::GetInstance();
         // create an argument object
         Argument arg(ArgKey::ADD_FACE, vector<string>{coord1, coord2, coord3});
-        // get the response from the controller
-        Response response = 
+        // get the responses from the controller
+        vector<Response> responses = 
                 (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -623,11 +731,11 @@ void Viewer::ShowListAllPointsOfFace() {
         Controller* controller = Controller::GetInstance();
         // create an argument object
         Argument arg(ArgKey::DISPLAY_FACE_POINTS, vector<string>{face_id});
-        // get the response from the controller
-        Response response = 
+        // get the responses from the controller
+        vector<Response> responses = 
                 (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -664,11 +772,11 @@ void Viewer::ShowModifyPointOfFace() {
                 vector<string>{face_id, point_id, coord});
         // get the controller instance
         Controller* controller = Controller::GetInstance();
-        // get the response from the controller
-        Response response = 
+        // get the responses from the controller
+        vector<Response> responses = 
                 (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -689,13 +797,30 @@ void Viewer::ShowListAllLines() {
     try {
         // get the controller instance
         Controller* controller = Controller::GetInstance();
-        // create an argument object
-        Argument arg(ArgKey::DISPLAY_ALL_LINES, vector<string>());
-        // get the response from the controller
-        Response response = 
-                (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // write the lines straight to the output, one block at a time
+        OutputSink sink(cout);
+        bool first = true;
+        ErrorCode code = (*controller).StreamLines(0, SIZE_MAX,
+            [&sink, &first](size_t index, const string& row) {
+                if (first) {
+                    sink.Write(string("Display all lines:\n"));
+                    first = false;
+                }
+                sink.Write(string("Line "));
+                sink.Write(index);
+                sink.Write('\n');
+                sink.Write(row);
+                sink.Write(string(" \n"));
+            });
+        sink.Flush();
+        if (code != ErrorCode::NONE) {
+            HandleResponses(vector<Response>{
+                Response(Controller::ToResponseKey(code), {})});
+        }
+        else if (first) {
+            // a model without lines
+            cout << "Display all lines:" << endl;
+        }
     }
     catch (const exception& e) {
         // handle exception here
@@ -729,11 +854,11 @@ void Viewer::ShowAddLine() {
         Controller* controller = Controller::GetInstance();
         // create an argument object
         Argument arg(ArgKey::ADD_LINE, vector<string>{coord1, coord2});
-        // get the response from the controller
-        Response response = 
+        // get the responses from the controller
+        vector<Response> responses = 
                 (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -762,11 +887,11 @@ void Viewer::ShowDeleteLine() {
         Controller* controller = Controller::GetInstance();
         // create an argument object
         Argument arg(ArgKey::DELETE_LINE, vector<string>{line_id});
-        // get the response from the controller
-        Response response = 
+        // get the responses from the controller
+        vector<Response> responses = 
                 (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -795,11 +920,11 @@ void Viewer::ShowListAllPointsOfLine() {
         Controller* controller = Controller::GetInstance();
         // create an argument object
         Argument arg(ArgKey::DISPLAY_LINE_POINTS, vector<string>{line_id});
-        // get the response from the controller
-        Response response = 
+        // get the responses from the controller
+        vector<Response> responses = 
                 (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -838,11 +963,11 @@ void Viewer::ShowModifyPointOfLine() {
                 vector<string>{line_id, point_id, coord});
         // get the controller instance
         Controller* controller = Controller::GetInstance();
-        // get the response from the controller
-        Response response = 
+        // get the responses from the controller
+        vector<Response> responses = 
                 (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // handle the responses
+        HandleResponses(responses);
     }
     catch (const exception& e) {
         // handle exception here
@@ -863,13 +988,19 @@ void Viewer::ShowShowStatistics() {
     try {
         // get the controller instance
         Controller* controller = Controller::GetInstance();
-        // create an argument object
-        Argument arg(ArgKey::DISPLAY_STATISTICS, vector<string>());
-        // get the response from the controller
-        Response response = 
-                (*controller).HandleArguments(vector<Argument>{arg});
-        // handle the response
-        HandleResponses(vector<Response>{response});
+        // the topology and the memory are only asked for if the
+        // statistics succeed
+        vector<Argument> args = {
+            Argument(ArgKey::DISPLAY_STATISTICS, vector<string>()),
+            Argument(ArgKey::DISPLAY_TOPOLOGY, vector<string>()),
+            Argument(ArgKey::DISPLAY_MEMORY, vector<string>())
+        };
+        // get the responses from the controller
+        vector<Response> responses = (*controller).HandleArguments(args);
+        // handle the responses one at a time
+        for (const Response& response : responses) {
+            HandleResponses(vector<Response>{response});
+        }
     }
     catch (const exception& e) {
         // handle exception here
@@ -878,82 +1009,179 @@ void Viewer::ShowShowStatistics() {
     }
 }
  
+// -----------------------------------------------------------
+// [name] : ShowShowMetrics
+// [function] : display the latency of the commands, the number of the
+//              responses and the throughput of import and export
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Viewer::ShowShowMetrics() {
+    try {
+        Controller* controller = Controller::GetInstance();
+        Argument arg(ArgKey::DISPLAY_METRICS, vector<string>());
+        vector<Response> responses = 
+                (*controller).HandleArguments(vector<Argument>{arg});
+        HandleResponses(responses);
+    }
+    catch (const exception& e) {
+        cout << "catch exception: " << e.what() << endl;
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : RunInBackground
+// [function] : run an argument on the worker thread of the controller
+//              and show its progress until it is done, Ctrl+C cancels
+//              the command
+// [input] : the argument
+// [output] : the responses of the controller
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<Response> Viewer::RunInBackground(const Argument& argument) {
+    Controller* controller = Controller::GetInstance();
+    Controller::Ticket ticket = 
+        (*controller).HandleArgumentsAsync(vector<Argument>{argument});
+    vector<Response> responses;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    bool shown = false;
+    bool cancelled = false;
+    // Ctrl+C cancels the command instead of ending the program
+    g_interrupted = 0;
+    void (*previous)(int) = signal(SIGINT, OnInterrupt);
+    while (!(*controller).TryCollectJob(ticket, responses)) {
+        this_thread::sleep_for(chrono::milliseconds(100));
+        if (g_interrupted && !cancelled) {
+            // the job answers CANCELLED when it next checks its progress,
+            // a job that already finished is collected as usual
+            (*controller).CancelJob(ticket);
+            cancelled = true;
+            cout << "\rCancelling..." << flush;
+            shown = true;
+        }
+        // only show the progress of a command that takes a while
+        if (chrono::steady_clock::now() - start < chrono::milliseconds(500)) {
+            continue;
+        }
+        CommandExecutor::JobStatus status;
+        if (!(*controller).GetJobStatus(ticket, status)) {
+            break;
+        }
+        if (cancelled) {
+            continue;
+        }
+        cout << "\rWorking... ";
+        if (status.TotalBytes > 0) {
+            cout << status.Bytes * 100 / status.TotalBytes << "% read, ";
+        }
+        cout << status.Faces << " faces, " << status.Lines << " lines"
+             << " (Ctrl+C to cancel)" << flush;
+        shown = true;
+    }
+    if (previous != SIG_ERR) {
+        signal(SIGINT, previous);
+    }
+    if (shown) {
+        cout << endl;
+    }
+    return responses;
+}
+
 // -----------------------------------------------------------
 // [name] : DisplayAllFaces
 // [function] : display all faces of the 3D model
-// [input] : vector of strings representing face data
+// [input] : the response with the face data
 // [output] : none
 // [author] : Huayu Chen
 // [date] : 2024/8/1
 // -----------------------------------------------------------
-void Viewer::DisplayAllFaces(const vector<string>& values) const{
-    // iterate through the face data and display each face
-    for (unsigned int i = 0; i < values.size(); i++) {
-        cout << "Face " << i << endl;
-        cout << values[i] << endl;
+void Viewer::DisplayAllFaces(const Response& response) const{
+    // iterate through the face data and display each face,
+    // numbered from the first face of the page
+    OutputSink sink(cout);
+    string row;
+    for (size_t i = 0; i < response.GetValueCount(); i++) {
+        row.clear();
+        response.AppendValue(i, row);
+        sink.Write(string("Face "));
+        sink.Write(response.GetFirstIndex() + i);
+        sink.Write('\n');
+        sink.Write(row);
+        sink.Write('\n');
     }
 }
  
 // -----------------------------------------------------------
 // [name] : DisplayFacePoints
 // [function] : display points of a specific face
-// [input] : vector of strings representing face point data
+// [input] : the response with the face point data
 // [output] : none
 // [author] : Huayu Chen
 // [date] : 2024/8/1
 // -----------------------------------------------------------
-void Viewer::DisplayFacePoints(const vector<string>& values) const{
+void Viewer::DisplayFacePoints(const Response& response) const{
     // iterate through the face point data and display each point
-    for (unsigned int i = 0; i < values.size(); i++) {
+    for (size_t i = 0; i < response.GetValueCount(); i++) {
         cout << "Point " << i << endl;
-        cout << values[i] << endl;
+        cout << response.GetValue(i) << endl;
     }
 }
  
 // -----------------------------------------------------------
 // [name] : DisplayAllLines
 // [function] : display all lines of the 3D model
-// [input] : vector of strings representing line data
+// [input] : the response with the line data
 // [output] : none
 // [author] : Huayu Chen
 // [date] : 2024/8/1
 // -----------------------------------------------------------
-void Viewer::DisplayAllLines(const vector<string>& values) const{
-    // iterate through the line data and display each line
-    for (unsigned int i = 0; i < values.size(); i++) {
-        cout << "Line " << i << endl;
-        cout << values[i] << " " << endl;
+void Viewer::DisplayAllLines(const Response& response) const{
+    // iterate through the line data and display each line,
+    // numbered from the first line of the page
+    OutputSink sink(cout);
+    string row;
+    for (size_t i = 0; i < response.GetValueCount(); i++) {
+        row.clear();
+        response.AppendValue(i, row);
+        sink.Write(string("Line "));
+        sink.Write(response.GetFirstIndex() + i);
+        sink.Write('\n');
+        sink.Write(row);
+        sink.Write(string(" \n"));
     }
 }
  
 // -----------------------------------------------------------
 // [name] : DisplayLinePoints
 // [function] : display points of a specific line
-// [input] : vector of strings representing line point data
+// [input] : the response with the line point data
 // [output] : none
 // [author] : Huayu Chen
 // [date] : 2024/8/1
 // -----------------------------------------------------------
-void Viewer::DisplayLinePoints(const vector<string>& values) const{
+void Viewer::DisplayLinePoints(const Response& response) const{
     // iterate through the line point data and display each point
-    for (unsigned int i = 0; i < values.size(); i++) {
+    for (size_t i = 0; i < response.GetValueCount(); i++) {
         cout << "Point " << i << endl;
-        cout << values[i] << " " << endl;
+        cout << response.GetValue(i) << " " << endl;
     }
 }
  
 // -----------------------------------------------------------
 // [name] : DisplayStatistics
 // [function] : display statistics of the 3D model
-// [input] : vector of strings representing statistics data
+// [input] : the response with the statistics data
 // [output] : none
 // [author] : Huayu Chen
 // [date] : 2024/8/1
 // -----------------------------------------------------------
-void Viewer::DisplayStatistics(const vector<string>& values) const{
+void Viewer::DisplayStatistics(const Response& response) const{
     // iterate through the statistics data and display each statistic
-    for (unsigned int i = 0; i < values.size(); i++) {
-        cout << values[i] << endl;
+    for (size_t i = 0; i < response.GetValueCount(); i++) {
+        cout << response.GetValue(i) << endl;
     }
 }
  
@@ -23,6 +23,26 @@
 // edit: add functions that display the model
 // reason: to support displaying the model
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: pass the responses to the display functions
+// reason: the values are formatted row by row while they are printed
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add RunInBackground function
+// reason: to show the progress of a long import or export
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add ShowShowMetrics function
+// reason: to show the latency of the commands
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: cancel the command of RunInBackground on Ctrl+C
+// reason: a long import or export could only be waited for
+// -----------------------------------------------------------
 
 //// this is the header file of the Viewer class
 // the class Viewer is a class that interacts with the user
@@ -68,6 +88,9 @@ public:
 private:
     // handle the responses from the controller
     void HandleResponses(const vector<Response>& responses);
+    // run an argument on the worker thread of the controller and show
+    // its progress until it is done, Ctrl+C cancels the argument
+    vector<Response> RunInBackground(const Argument& argument);
     // list all the interfaces
     // interface 1: start menu
     void ShowStartMenu();
@@ -99,18 +122,20 @@ private:
     void ShowModifyPointOfLine();
     // interface 15: show statistics
     void ShowShowStatistics();
+    // interface 16: show metrics
+    void ShowShowMetrics();
 
     // display functions
     // display all faces
-    void DisplayAllFaces(const vector<string>& FaceStrings) const;
+    void DisplayAllFaces(const Response& response) const;
     // display all points of a face
-    void DisplayFacePoints(const vector<string>& PointStrings) const;
+    void DisplayFacePoints(const Response& response) const;
     // display all lines
-    void DisplayAllLines(const vector<string>& LineStrings) const;
+    void DisplayAllLines(const Response& response) const;
     // display all points of a line
-    void DisplayLinePoints(const vector<string>& PointStrings) const;
+    void DisplayLinePoints(const Response& response) const;
     // display statistics
-    void DisplayStatistics(const vector<string>& StatsStrings) const;
+    void DisplayStatistics(const Response& response) const;
     // convert string input to integer
     int GetIntegerInput(const string& InputString) const;
 };
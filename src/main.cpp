@@ -10,6 +10,41 @@
 // edit: add main function
 // reason: to test the program
 // -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the script mode, hw --script [FILE|-] [--continue] [--batch]
+//       [--quiet]
+// reason: to run commands without the menus
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add the server mode, hw --serve SOCKET [--workers N]
+// reason: to let several tools share the loaded model
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add --metrics FILE, write the metrics as JSON at the end
+// reason: to compare the latency of the commands between runs
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add --trace FILE, write the trace spans as a Chrome trace
+// reason: to see where the time of a slow import or export goes
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add --threads N and --pin-threads, the options of the
+//       TaskScheduler
+// reason: to choose how many threads import, export and the statistics
+//         use
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add --stats FILE, print the statistics of a file without
+//       importing it
+// reason: to get the counts, sums and bounds of a big file without
+//         the memory and time of the whole model
+// -----------------------------------------------------------
 
 #include "Model/Element3D/point3d.hpp"
 #include "Model/FileIO/model3dobjimporter.hpp"
@@ -19,13 +54,239 @@
 #include "Message/argument.hpp"
 #include "Message/response.hpp"
 #include "Viewer/viewer.hpp"
+#include "Viewer/scriptrunner.hpp"
+#include "Ipc/ipcserver.hpp"
+#include "Model/Trace/tracer.hpp"
+#include "Model/Parallel/taskscheduler.hpp"
 #include <vector>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <csignal>
+#include <cstdlib>
+#include <thread>
 using namespace std;
 
-int main() {
-    Controller* controller = Controller::GetInstance();
-    Viewer viewer;
-    viewer.Start();
+// the running server, stopped by SIGINT and SIGTERM
+static IpcServer* g_server = nullptr;
+
+// -----------------------------------------------------------
+// [name] : StopServer
+// [function] : signal handler stopping the server
+// [input] : the signal
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void StopServer(int) {
+    if (g_server) {
+        g_server->Stop();
+    }
+}
+
+// -----------------------------------------------------------
+// [name] : Serve
+// [function] : serve the controller on a Unix domain socket until the
+//              program is interrupted
+// [input] : the path of the socket, the number of worker threads
+// [output] : the exit code of the program
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int Serve(const string& path, unsigned int workers) {
+    IpcServer server(Controller::GetInstance(), path, workers);
+    string error;
+    if (!server.Open(error)) {
+        cerr << "Failed to start the server: " << error << endl;
+        return 1;
+    }
+    g_server = &server;
+    signal(SIGINT, StopServer);
+    signal(SIGTERM, StopServer);
+    cerr << "Serving on " << path << " with " << workers 
+         << " worker threads" << endl;
+    server.Run();
+    g_server = nullptr;
     return 0;
-}
\ No newline at end of file
+}
+
+// -----------------------------------------------------------
+// [name] : RunScript
+// [function] : run the commands of a script
+// [input] : the script runner, the path of the script, '-' for stdin
+// [output] : the exit code of the program
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int RunScript(ScriptRunner& runner, const string& path) {
+    if (path == "-") {
+        return runner.Run(cin);
+    }
+    ifstream file(path);
+    if (!file.is_open()) {
+        cerr << "Failed to open the script " << path << endl;
+        return 2;
+    }
+    return runner.Run(file);
+}
+
+// -----------------------------------------------------------
+// [name] : WriteMetrics
+// [function] : write the metrics of the controller as JSON
+// [input] : the controller, the path of the file
+// [output] : false if the file cannot be written
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool WriteMetrics(Controller* controller, const string& path) {
+    ofstream file(path);
+    file << controller->GetMetrics().GetJson() << endl;
+    if (!file) {
+        cerr << "Failed to write the metrics to " << path << endl;
+        return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : PrintUsage
+// [function] : print the command line options
+// [input] : the name of the program
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void PrintUsage(const char* program) {
+    cerr << "usage: " << program << " [--script [FILE|-]] [--continue] "
+         << "[--batch] [--quiet] [--metrics FILE] [--trace FILE]" << endl
+         << "       " << program << " --stats FILE [--quiet] "
+         << "[--metrics FILE] [--trace FILE]" << endl
+         << "       " << program << " --serve SOCKET [--workers N] "
+         << "[--metrics FILE] [--trace FILE]" << endl
+         << "  both take [--threads N] [--pin-threads]" << endl
+         << "  without --script the interactive menus are shown" << endl
+         << "  --script FILE  run the commands of FILE, '-' or no FILE "
+         << "reads stdin" << endl
+         << "  --continue     keep running after a failed command" << endl
+         << "  --batch        send all commands to the controller at once"
+         << endl
+         << "  --quiet        do not print the values of the responses"
+         << endl
+         << "  --stats FILE   print the statistics of an OBJ file "
+         << "without importing it" << endl
+         << "  --serve SOCKET serve the model on a Unix domain socket"
+         << endl
+         << "  --workers N    threads answering the queries of the server"
+         << endl
+         << "  --metrics FILE write the latency of the commands as JSON "
+         << "at the end" << endl
+         << "  --trace FILE   write a Chrome trace of the run, needs a "
+         << "build with xmake f -m trace" << endl
+         << "  --threads N    threads of import, export and the "
+         << "statistics, 1 runs them on one thread" << endl
+         << "  --pin-threads  keep every one of these threads on one "
+         << "processor" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    Controller* controller = Controller::GetInstance();
+    bool script = false;
+    string scriptPath = "-";
+    bool continueOnError = false;
+    bool batch = false;
+    bool quiet = false;
+    string socketPath;
+    string metricsPath;
+    string tracePath;
+    string statsPath;
+    // 0 threads, as many as the hardware has
+    TaskScheduler::Options options = {0, false};
+    unsigned int workers = thread::hardware_concurrency();
+    if (workers == 0) {
+        workers = 4;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--script") == 0) {
+            script = true;
+            // the file is optional, stdin is read without it
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+                scriptPath = argv[++i];
+            }
+        }
+        else if (strcmp(argv[i], "--continue") == 0) {
+            continueOnError = true;
+        }
+        else if (strcmp(argv[i], "--batch") == 0) {
+            batch = true;
+        }
+        else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = true;
+        }
+        else if (strcmp(argv[i], "--serve") == 0 && i + 1 < argc) {
+            socketPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc &&
+                 atoi(argv[i + 1]) > 0) {
+            workers = static_cast<unsigned int>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--metrics") == 0 && i + 1 < argc) {
+            metricsPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            tracePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--stats") == 0 && i + 1 < argc) {
+            statsPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc &&
+                 atoi(argv[i + 1]) > 0) {
+            options.Threads = static_cast<unsigned int>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--pin-threads") == 0) {
+            options.PinThreads = true;
+        }
+        else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+    TaskScheduler::Configure(options);
+    if (!tracePath.empty()) {
+        if (!Tracer::IsAvailable()) {
+            cerr << "This build has no trace spans, rebuild it with "
+                 << "xmake f -m trace" << endl;
+            return 2;
+        }
+        Tracer::Start(tracePath);
+    }
+    int code = 0;
+    if (!socketPath.empty()) {
+        code = Serve(socketPath, workers);
+    }
+    else if (!statsPath.empty()) {
+        // one filestats command, reported as a script
+        ScriptRunner runner(cout, false, false, quiet);
+        istringstream command("filestats " + statsPath);
+        code = runner.Run(command);
+    }
+    else if (!script) {
+        Viewer viewer;
+        viewer.Start();
+    }
+    else {
+        ScriptRunner runner(cout, continueOnError, batch, quiet);
+        code = RunScript(runner, scriptPath);
+    }
+    if (!metricsPath.empty() && !WriteMetrics(controller, metricsPath) &&
+        code == 0) {
+        code = 1;
+    }
+    if (!tracePath.empty() && !Tracer::Stop()) {
+        cerr << "Failed to write the trace to " << tracePath << endl;
+        if (code == 0) {
+            code = 1;
+        }
+    }
+    return code;
+}
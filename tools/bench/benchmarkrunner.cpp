@@ -0,0 +1,288 @@
+// [file name] : benchmarkrunner.cpp
+// [function] : implement the BenchmarkRunner class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the BenchmarkRunner class
+// reason: to time the elements, the model and the files
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: write the time of every repetition as samples_ns
+// reason: benchcmp compares the repetitions of two runs
+// -----------------------------------------------------------
+
+#include "benchmarkrunner.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : Now
+// [function] : read a steady clock
+// [input] : none
+// [output] : the time in nanoseconds
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t Now() {
+    return static_cast<uint64_t>(
+        chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// -----------------------------------------------------------
+// [name] : JsonString
+// [function] : quote a string for JSON
+// [input] : the string
+// [output] : the quoted string with '"', '\' and control characters
+//            escaped
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static string JsonString(const string& text) {
+    string json = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            json += '\\';
+            json += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            json += buffer;
+        }
+        else {
+            json += c;
+        }
+    }
+    return json + "\"";
+}
+
+// -----------------------------------------------------------
+// [name] : JsonNumber
+// [function] : format a number for JSON
+// [input] : the number
+// [output] : the number with 3 decimals
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static string JsonNumber(double value) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return buffer;
+}
+
+// -----------------------------------------------------------
+// [name] : BenchmarkRunner
+// [function] : constructor of the BenchmarkRunner class
+// [input] : the options of all benchmarks
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+BenchmarkRunner::BenchmarkRunner(const Options& options)
+    : m_options(options) {
+    // a summary needs at least one repetition
+    m_options.Repetitions = max<size_t>(m_options.Repetitions, 1);
+}
+
+// -----------------------------------------------------------
+// [name] : Add
+// [function] : register a benchmark
+// [input] : the name, the bytes of one operation or 0, the body
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void BenchmarkRunner::Add(const string& name, uint64_t bytes, Body body) {
+    m_benchmarks.push_back(Benchmark{name, bytes, move(body)});
+}
+
+// -----------------------------------------------------------
+// [name] : GetNames
+// [function] : get the names of the benchmarks passing the filter
+// [input] : none
+// [output] : the names in the order they were added
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<string> BenchmarkRunner::GetNames() const {
+    vector<string> names;
+    for (const Benchmark& benchmark : m_benchmarks) {
+        if (IsSelected(benchmark.Name)) {
+            names.push_back(benchmark.Name);
+        }
+    }
+    return names;
+}
+
+// -----------------------------------------------------------
+// [name] : Run
+// [function] : run the benchmarks passing the filter
+// [input] : the stream of the progress, one line per benchmark
+// [output] : the summaries in the order the benchmarks were added
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+vector<BenchmarkRunner::Summary> BenchmarkRunner::Run(
+            ostream& progress) const {
+    vector<Summary> summaries;
+    for (const Benchmark& benchmark : m_benchmarks) {
+        if (!IsSelected(benchmark.Name)) {
+            continue;
+        }
+        Summary summary = Measure(benchmark);
+        char buffer[160];
+        snprintf(buffer, sizeof(buffer),
+                 "%-32s %14.1f ns/op  +- %5.1f%%  (%llu x %llu)",
+                 summary.Name.c_str(), summary.MedianNs,
+                 summary.MeanNs > 0
+                     ? 100.0 * summary.StddevNs / summary.MeanNs : 0.0,
+                 static_cast<unsigned long long>(summary.Iterations),
+                 static_cast<unsigned long long>(summary.Repetitions));
+        progress << buffer << endl;
+        summaries.push_back(summary);
+    }
+    return summaries;
+}
+
+// -----------------------------------------------------------
+// [name] : Measure
+// [function] : run one benchmark
+// [input] : the benchmark
+// [output] : the summary of its repetitions
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+BenchmarkRunner::Summary BenchmarkRunner::Measure(
+            const Benchmark& benchmark) const {
+    // find the iterations of one repetition, the growth is bounded so a
+    // fast first call does not lead to a huge repetition
+    uint64_t iterations = 1;
+    while (true) {
+        uint64_t start = Now();
+        benchmark.Run(iterations);
+        uint64_t elapsed = Now() - start;
+        if (elapsed >= m_options.MinTime) {
+            break;
+        }
+        double factor = elapsed == 0 ? 10.0
+            : 1.4 * static_cast<double>(m_options.MinTime) / elapsed;
+        iterations = static_cast<uint64_t>(
+            iterations * min(10.0, max(2.0, factor)));
+    }
+    for (size_t i = 0; i < m_options.Warmup; i++) {
+        benchmark.Run(iterations);
+    }
+    vector<double> times;
+    times.reserve(m_options.Repetitions);
+    for (size_t i = 0; i < m_options.Repetitions; i++) {
+        uint64_t start = Now();
+        benchmark.Run(iterations);
+        times.push_back(static_cast<double>(Now() - start) / iterations);
+    }
+
+    Summary summary;
+    summary.Name = benchmark.Name;
+    summary.Iterations = iterations;
+    summary.Repetitions = times.size();
+    summary.Samples = times;
+    double sum = 0.0;
+    for (double time : times) {
+        sum += time;
+    }
+    summary.MeanNs = sum / times.size();
+    double squares = 0.0;
+    for (double time : times) {
+        squares += (time - summary.MeanNs) * (time - summary.MeanNs);
+    }
+    // the sample deviation, 0 for a single repetition
+    summary.StddevNs = times.size() > 1
+        ? sqrt(squares / (times.size() - 1)) : 0.0;
+    sort(times.begin(), times.end());
+    size_t middle = times.size() / 2;
+    summary.MedianNs = times.size() % 2 == 1
+        ? times[middle] : (times[middle - 1] + times[middle]) / 2.0;
+    summary.MinNs = times.front();
+    summary.MaxNs = times.back();
+    summary.BytesPerSecond = benchmark.Bytes == 0 || summary.MedianNs == 0
+        ? 0.0 : benchmark.Bytes * 1e9 / summary.MedianNs;
+    return summary;
+}
+
+// -----------------------------------------------------------
+// [name] : ToJson
+// [function] : format the summaries and the options as one JSON object
+// [input] : the summaries
+// [output] : the object, e.g. {"context":{"warmup":2,"repetitions":10,
+//            "min_time_ns":..,"build":"release","compiler":".."},
+//            "benchmarks":[{"name":"vector/add","iterations":..,
+//            "repetitions":10,"mean_ns":..,"median_ns":..,"min_ns":..,
+//            "max_ns":..,"stddev_ns":..,"cv":..,"bytes_per_second":..,
+//            "samples_ns":[..]}]}
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+string BenchmarkRunner::ToJson(const vector<Summary>& summaries) const {
+#ifdef NDEBUG
+    const char* build = "release";
+#else
+    const char* build = "debug";
+#endif
+#ifdef __VERSION__
+    const char* compiler = __VERSION__;
+#else
+    const char* compiler = "unknown";
+#endif
+    string json = "{\"context\":{\"warmup\":" +
+                  to_string(m_options.Warmup) + ",\"repetitions\":" +
+                  to_string(m_options.Repetitions) + ",\"min_time_ns\":" +
+                  to_string(m_options.MinTime) + ",\"build\":" +
+                  JsonString(build) + ",\"compiler\":" +
+                  JsonString(compiler) + "},\"benchmarks\":[";
+    for (size_t i = 0; i < summaries.size(); i++) {
+        const Summary& summary = summaries[i];
+        double cv = summary.MeanNs > 0
+            ? summary.StddevNs / summary.MeanNs : 0.0;
+        json += (i == 0 ? "\n" : ",\n");
+        json += "{\"name\":" + JsonString(summary.Name) +
+                ",\"iterations\":" + to_string(summary.Iterations) +
+                ",\"repetitions\":" + to_string(summary.Repetitions) +
+                ",\"mean_ns\":" + JsonNumber(summary.MeanNs) +
+                ",\"median_ns\":" + JsonNumber(summary.MedianNs) +
+                ",\"min_ns\":" + JsonNumber(summary.MinNs) +
+                ",\"max_ns\":" + JsonNumber(summary.MaxNs) +
+                ",\"stddev_ns\":" + JsonNumber(summary.StddevNs) +
+                ",\"cv\":" + JsonNumber(cv) +
+                ",\"bytes_per_second\":" +
+                JsonNumber(summary.BytesPerSecond) + ",\"samples_ns\":[";
+        for (size_t j = 0; j < summary.Samples.size(); j++) {
+            json += (j == 0 ? "" : ",") + JsonNumber(summary.Samples[j]);
+        }
+        json += "]}";
+    }
+    json += "\n]}";
+    return json;
+}
+
+// -----------------------------------------------------------
+// [name] : IsSelected
+// [function] : check if a name passes the filter
+// [input] : the name
+// [output] : true if the filter is empty or a part of the name
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool BenchmarkRunner::IsSelected(const string& name) const {
+    return m_options.Filter.empty() ||
+           name.find(m_options.Filter) != string::npos;
+}
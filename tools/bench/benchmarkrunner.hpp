@@ -0,0 +1,129 @@
+// [file name] : benchmarkrunner.hpp
+// [function] : declare the BenchmarkRunner class and KeepValue
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init BenchmarkRunner class
+// reason: there was no way to measure if a change made the elements,
+//         the model or the files slower
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: keep the time of every repetition in the Summary
+// reason: benchcmp compares the repetitions of two runs, not only their
+//         medians
+// -----------------------------------------------------------
+
+#ifndef BENCHMARKRUNNER_HPP
+#define BENCHMARKRUNNER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : KeepValue
+// [function] : keep the compiler from removing the computation of a
+//              value that is never used, or from moving the computation
+//              on an input out of the loop
+// [input] : the value
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+template <typename T>
+inline void KeepValue(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+// notes on the class BenchmarkRunner
+// -----------------------------------------------------------
+// [class name] : BenchmarkRunner
+// [function] : time benchmarks and summarize them as JSON
+// [notes on interface] :
+// 1. Add registers a benchmark. its body runs the operation the given
+//    number of times, the setup is done before Add. bytes is the size
+//    of one operation for a throughput, 0 for none
+// 2. Run first doubles the iterations until one call of the body takes
+//    MinTime, then calls it Warmup times untimed and Repetitions times
+//    timed. every repetition gives the nanoseconds of one operation
+// 3. a Summary has the mean, the median, the minimum, the maximum and
+//    the standard deviation of the repetitions, and the bytes per second
+//    of the median. Samples has the time of every repetition in the
+//    order they ran
+// 4. only the benchmarks whose name contains Filter are run
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class BenchmarkRunner
+{
+public:
+    // how the benchmarks are run
+    struct Options {
+        size_t Warmup;
+        size_t Repetitions;
+        // the shortest time of one repetition in nanoseconds
+        uint64_t MinTime;
+        string Filter;
+    };
+    // the result of one benchmark, the times are of one operation
+    struct Summary {
+        string Name;
+        uint64_t Iterations;
+        size_t Repetitions;
+        double MeanNs;
+        double MedianNs;
+        double MinNs;
+        double MaxNs;
+        double StddevNs;
+        double BytesPerSecond;
+        vector<double> Samples;
+    };
+    // the body of a benchmark, runs the operation a number of times
+    using Body = function<void(uint64_t iterations)>;
+
+    // constructor, the options of all benchmarks
+    BenchmarkRunner(const Options& options);
+    // register a benchmark
+    void Add(const string& name, uint64_t bytes, Body body);
+    // the names of the benchmarks passing the filter
+    vector<string> GetNames() const;
+    // run the benchmarks passing the filter, print a line per benchmark
+    // to progress
+    vector<Summary> Run(ostream& progress) const;
+    // format the summaries and the options as one JSON object
+    string ToJson(const vector<Summary>& summaries) const;
+
+private:
+    // a registered benchmark
+    struct Benchmark {
+        string Name;
+        uint64_t Bytes;
+        Body Run;
+    };
+    // run one benchmark
+    Summary Measure(const Benchmark& benchmark) const;
+    // check if a name passes the filter
+    bool IsSelected(const string& name) const;
+
+    // private member variables
+    Options m_options;
+    vector<Benchmark> m_benchmarks;
+};
+
+#endif // BENCHMARKRUNNER_HPP
@@ -0,0 +1,358 @@
+// [file name] : main.cpp
+// [function] : main function of the benchmarks
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add main function of bench
+// reason: to measure the elements, the model and the files before and
+//         after a change
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: build the models with the MeshGenerator, add --faces
+// reason: to measure the model and the files at several sizes
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: parse a point without an exponent in string_to_point and fail
+//       the run if it is rejected
+// reason: the parser rejects exponents, the benchmark only measured the
+//         error path
+// -----------------------------------------------------------
+
+#include "benchmarkrunner.hpp"
+#include "Controller/pointparser.hpp"
+#include "Model/Element3D/face3d.hpp"
+#include "Model/Element3D/line3d.hpp"
+#include "Model/Element3D/point3d.hpp"
+#include "Model/Element3D/vector.hpp"
+#include "Model/FileIO/model3dobjexporter.hpp"
+#include "Model/FileIO/model3dobjimporter.hpp"
+#include "Model/Generator/meshgenerator.hpp"
+#include "Model/Model3D/model3d.hpp"
+#include "Model/Result/result.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+using namespace std;
+
+// the faces of the model built by add_face, every face is compared with
+// all earlier ones, so the time grows with the square of the faces
+static const size_t ADD_FACE_COUNT = 2000;
+// the faces of the model added in one bulk operation
+static const size_t BULK_FACE_COUNT = 100000;
+// the faces of the terrain written and read as OBJ, unless --faces
+static const uint64_t DEFAULT_OBJ_FACES = 20000;
+
+// -----------------------------------------------------------
+// [name] : PrintUsage
+// [function] : print the command line options
+// [input] : the name of the program
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void PrintUsage(const char* program) {
+    cerr << "usage: " << program << " [--warmup N] [--repetitions N] "
+         << "[--min-time MS] [--filter TEXT] [--output FILE] [--dir DIR] "
+         << "[--faces N] [--list]" << endl
+         << "  run the benchmarks and write their summaries as JSON"
+         << endl
+         << "  --warmup N       untimed runs before the repetitions, "
+         << "default 2" << endl
+         << "  --repetitions N  timed runs of every benchmark, default 10"
+         << endl
+         << "  --min-time MS    shortest time of one run, default 50"
+         << endl
+         << "  --filter TEXT    only run the benchmarks containing TEXT"
+         << endl
+         << "  --output FILE    write the JSON to FILE, not to stdout"
+         << endl
+         << "  --dir DIR        directory of the OBJ file, default ."
+         << endl
+         << "  --faces N        faces of the OBJ file, default 20000"
+         << endl
+         << "  --list           print the names of the benchmarks" << endl;
+}
+
+// -----------------------------------------------------------
+// [name] : MakeTerrain
+// [function] : build the faces of a terrain of the MeshGenerator
+// [input] : the number of faces
+// [output] : the faces, all different
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static vector<Face3D> MakeTerrain(uint64_t faces) {
+    MeshGenerator::Options options{MeshGenerator::Shape::TERRAIN, faces, 1,
+                                   0.0, 0.0};
+    Result<vector<Face3D>> made = MeshGenerator::MakeFaces(options);
+    if (!made.IsOk()) {
+        throw runtime_error(ErrorMessage(made.GetError()));
+    }
+    return made.GetValue();
+}
+
+// -----------------------------------------------------------
+// [name] : FileSize
+// [function] : get the size of a file
+// [input] : the path
+// [output] : the size in bytes, 0 if it cannot be opened
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t FileSize(const string& path) {
+    ifstream file(path, ios::binary | ios::ate);
+    if (!file.is_open()) {
+        return 0;
+    }
+    return static_cast<uint64_t>(file.tellg());
+}
+
+// -----------------------------------------------------------
+// [name] : AddElementBenchmarks
+// [function] : register the benchmarks of the vectors, points, lines
+//              and faces
+// [input] : the runner
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void AddElementBenchmarks(BenchmarkRunner& runner) {
+    const Vector a(vector<double>{1.0, 2.0, 3.0});
+    const Vector b(vector<double>{-4.0, 5.5, 0.25});
+    runner.Add("vector/add", 0, [a, b](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            KeepValue(a);
+            Vector sum = a + b;
+            KeepValue(sum);
+        }
+    });
+    runner.Add("vector/dot", 0, [a, b](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            KeepValue(a);
+            double dot = a.Dot(b);
+            KeepValue(dot);
+        }
+    });
+    runner.Add("vector/cross", 0, [a, b](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            KeepValue(a);
+            Vector cross = a.Cross(b);
+            KeepValue(cross);
+        }
+    });
+    runner.Add("vector/normalize", 0, [a](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            KeepValue(a);
+            Vector unit = a.Normalize();
+            KeepValue(unit);
+        }
+    });
+    runner.Add("point3d/construct", 0, [](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            Point3D point(static_cast<double>(i), 1.0, 2.0);
+            KeepValue(point);
+        }
+    });
+    const Point3D source(1.0, 2.0, 3.0);
+    runner.Add("point3d/copy", 0, [source](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            KeepValue(source);
+            Point3D point(source);
+            KeepValue(point);
+        }
+    });
+    const Line3D line(Point3D(0.0, 0.0, 0.0), Point3D(1.0, 2.0, 3.0));
+    const Line3D skew(Point3D(5.0, 0.0, 1.0), Point3D(5.0, 1.0, -2.0));
+    const Point3D point(4.0, -1.0, 2.5);
+    runner.Add("line3d/distance_point", 0, [line, point](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            KeepValue(line);
+            double distance = line.Distance(point);
+            KeepValue(distance);
+        }
+    });
+    runner.Add("line3d/distance_line", 0, [line, skew](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            KeepValue(line);
+            double distance = line.Distance(skew);
+            KeepValue(distance);
+        }
+    });
+    const Face3D face(Point3D(0.0, 0.0, 0.0), Point3D(3.0, 0.5, 0.0),
+                      Point3D(1.0, 2.0, 1.5));
+    runner.Add("face3d/area", 0, [face](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            KeepValue(face);
+            double area = face.Area();
+            KeepValue(area);
+        }
+    });
+    runner.Add("face3d/perpendicular_line", 0, [face](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            KeepValue(face);
+            Line3D normal = face.PerpendicularLine();
+            KeepValue(normal);
+        }
+    });
+    // the parser of Controller::StringToPoint, which is private
+    const string text = "(1.5, -2.25, 300.0)";
+    runner.Add("controller/string_to_point", 0, [text](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            KeepValue(text);
+            Result<Point3D> parsed = PointParser::Parse(text);
+            if (!parsed.IsOk()) {
+                throw runtime_error("Failed to parse " + text);
+            }
+            KeepValue(parsed);
+        }
+    });
+}
+
+// -----------------------------------------------------------
+// [name] : AddModelBenchmarks
+// [function] : register the benchmarks of the model and the OBJ files
+// [input] : the runner, the path and the faces of the OBJ file
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void AddModelBenchmarks(BenchmarkRunner& runner, const string& path,
+                               uint64_t objFaces) {
+    vector<Face3D> few = MakeTerrain(ADD_FACE_COUNT);
+    runner.Add("model3d/add_face_x" + to_string(ADD_FACE_COUNT), 0,
+               [few](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            Model3D model;
+            for (const Face3D& face : few) {
+                model.AddFace(face);
+            }
+            KeepValue(model);
+        }
+    });
+    vector<Face3D> many = MakeTerrain(BULK_FACE_COUNT);
+    runner.Add("model3d/add_faces_x" + to_string(BULK_FACE_COUNT), 0,
+               [many](uint64_t iterations) {
+        vector<ErrorCode> codes;
+        for (uint64_t i = 0; i < iterations; i++) {
+            Model3D model;
+            model.TryAddFaces(many, codes, false);
+            KeepValue(model);
+        }
+    });
+    // the file is written once so import has the size for its MB/s,
+    // export writes it again with the same content
+    Model3D model(MakeTerrain(objFaces), vector<Line3D>(), "bench");
+    Model3DObjExporter exporter;
+    exporter.Save(path, model);
+    uint64_t bytes = FileSize(path);
+    runner.Add("objio/export", bytes, [model, path](uint64_t iterations) {
+        Model3DObjExporter exporter;
+        for (uint64_t i = 0; i < iterations; i++) {
+            exporter.Save(path, model);
+        }
+    });
+    runner.Add("objio/import", bytes, [path](uint64_t iterations) {
+        Model3DObjImporter importer;
+        for (uint64_t i = 0; i < iterations; i++) {
+            Result<Model3D> loaded = importer.TryLoad(path);
+            if (!loaded.IsOk()) {
+                throw runtime_error("Failed to import " + path);
+            }
+            KeepValue(loaded);
+        }
+    });
+}
+
+int main(int argc, char* argv[]) {
+    BenchmarkRunner::Options options{2, 10, 50000000, ""};
+    string outputPath;
+    string directory = ".";
+    uint64_t objFaces = DEFAULT_OBJ_FACES;
+    bool list = false;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--warmup") == 0 && hasValue) {
+            options.Warmup = strtoul(argv[++i], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "--repetitions") == 0 && hasValue) {
+            options.Repetitions = strtoul(argv[++i], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "--min-time") == 0 && hasValue) {
+            options.MinTime = strtoull(argv[++i], nullptr, 10) * 1000000;
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && hasValue) {
+            options.Filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--output") == 0 && hasValue) {
+            outputPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--dir") == 0 && hasValue) {
+            directory = argv[++i];
+        }
+        else if (strcmp(argv[i], "--faces") == 0 && hasValue) {
+            objFaces = strtoull(argv[++i], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "--list") == 0) {
+            list = true;
+        }
+        else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    BenchmarkRunner runner(options);
+    string objPath = directory + "/bench_model.obj";
+    try {
+        AddElementBenchmarks(runner);
+        AddModelBenchmarks(runner, objPath, objFaces);
+    }
+    catch (const exception& e) {
+        cerr << "Failed to prepare the benchmarks: " << e.what() << endl;
+        return 1;
+    }
+    if (list) {
+        for (const string& name : runner.GetNames()) {
+            cout << name << endl;
+        }
+        remove(objPath.c_str());
+        return 0;
+    }
+
+    vector<BenchmarkRunner::Summary> summaries;
+    try {
+        // the progress goes to stderr, stdout only gets the JSON
+        summaries = runner.Run(cerr);
+    }
+    catch (const exception& e) {
+        cerr << "A benchmark failed: " << e.what() << endl;
+        remove(objPath.c_str());
+        return 1;
+    }
+    remove(objPath.c_str());
+
+    string json = runner.ToJson(summaries);
+    if (outputPath.empty()) {
+        cout << json << endl;
+        return 0;
+    }
+    ofstream output(outputPath);
+    output << json << endl;
+    if (!output) {
+        cerr << "Failed to write " << outputPath << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,213 @@
+// [file name] : comparison.cpp
+// [function] : implement the Comparison class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the Comparison class
+// reason: to tell a regression from the noise of the repetitions
+// -----------------------------------------------------------
+
+#include "comparison.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace std;
+
+const size_t Comparison::MIN_SAMPLES = 3;
+const size_t Comparison::BOOTSTRAP_RESAMPLES = 2000;
+
+// the seed of the bootstrap, the same runs give the same interval
+static const uint64_t BOOTSTRAP_SEED = 0x5eed;
+
+// -----------------------------------------------------------
+// [name] : NextRandom
+// [function] : draw the next number of SplitMix64
+// [input] : the state of the generator
+// [output] : the number
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static uint64_t NextRandom(uint64_t& state) {
+    uint64_t x = (state += 0x9e3779b97f4a7c15ull);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+// -----------------------------------------------------------
+// [name] : Median
+// [function] : get the median of some times
+// [input] : the times, a copy that is sorted
+// [output] : the median, the mean of the two middle times for an even
+//            number, 0 for none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+double Comparison::Median(vector<double> values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    size_t middle = values.size() / 2;
+    nth_element(values.begin(), values.begin() + middle, values.end());
+    double upper = values[middle];
+    if (values.size() % 2 == 1) {
+        return upper;
+    }
+    double lower = *max_element(values.begin(), values.begin() + middle);
+    return (lower + upper) / 2.0;
+}
+
+// -----------------------------------------------------------
+// [name] : Compare
+// [function] : compare the times of a benchmark in two runs
+// [input] : the times of the baseline and of the new run, the
+//           confidence of the interval
+// [output] : the outcome
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Comparison::Outcome Comparison::Compare(const vector<double>& base,
+                                        const vector<double>& current,
+                                        double confidence) {
+    Outcome outcome;
+    outcome.BaseMedian = Median(base);
+    outcome.NewMedian = Median(current);
+    double ratio = outcome.BaseMedian > 0
+        ? outcome.NewMedian / outcome.BaseMedian : 1.0;
+    outcome.Change = ratio - 1.0;
+    outcome.RatioLow = ratio;
+    outcome.RatioHigh = ratio;
+    outcome.PSlower = 1.0;
+    outcome.PFaster = 1.0;
+    outcome.Tested = base.size() >= MIN_SAMPLES &&
+                     current.size() >= MIN_SAMPLES;
+    if (outcome.Tested) {
+        MannWhitney(base, current, outcome.PSlower, outcome.PFaster);
+        Bootstrap(base, current, confidence, outcome.RatioLow,
+                  outcome.RatioHigh);
+    }
+    return outcome;
+}
+
+// -----------------------------------------------------------
+// [name] : Classify
+// [function] : classify an outcome
+// [input] : the outcome, the threshold of the change, e.g. 0.05, the
+//           level of the test, e.g. 0.05
+// [output] : SLOWER, FASTER or SAME
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+Comparison::Verdict Comparison::Classify(const Outcome& outcome,
+                                         double threshold, double alpha) {
+    if (outcome.Change > threshold && outcome.PSlower < alpha) {
+        return Verdict::SLOWER;
+    }
+    if (outcome.Change < -threshold && outcome.PFaster < alpha) {
+        return Verdict::FASTER;
+    }
+    return Verdict::SAME;
+}
+
+// -----------------------------------------------------------
+// [name] : MannWhitney
+// [function] : test if the new times tend to be larger or smaller
+// [input] : the times of the baseline and of the new run, the p values
+//           to set
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Comparison::MannWhitney(const vector<double>& base,
+                             const vector<double>& current,
+                             double& pSlower, double& pFaster) {
+    // rank all times together, the new ones are marked with true
+    vector<pair<double, bool>> all;
+    for (double time : base) {
+        all.push_back(make_pair(time, false));
+    }
+    for (double time : current) {
+        all.push_back(make_pair(time, true));
+    }
+    sort(all.begin(), all.end());
+    double n1 = static_cast<double>(current.size());
+    double n2 = static_cast<double>(base.size());
+    double n = n1 + n2;
+    double rankSum = 0.0;
+    double ties = 0.0;
+    size_t i = 0;
+    while (i < all.size()) {
+        size_t j = i;
+        while (j < all.size() && all[j].first == all[i].first) {
+            j++;
+        }
+        // equal times share the mean of their ranks, which start at 1
+        double rank = (static_cast<double>(i + 1) + j) / 2.0;
+        for (size_t k = i; k < j; k++) {
+            if (all[k].second) {
+                rankSum += rank;
+            }
+        }
+        double t = static_cast<double>(j - i);
+        ties += t * t * t - t;
+        i = j;
+    }
+    double u = rankSum - n1 * (n1 + 1.0) / 2.0;
+    double mean = n1 * n2 / 2.0;
+    double variance = n1 * n2 / 12.0 * ((n + 1.0) - ties / (n * (n - 1.0)));
+    if (variance <= 0.0) {
+        // all times are equal
+        pSlower = 1.0;
+        pFaster = 1.0;
+        return;
+    }
+    double sigma = sqrt(variance);
+    // P(Z >= z) of the standard normal distribution
+    auto upper = [](double z) { return 0.5 * erfc(z / sqrt(2.0)); };
+    pSlower = upper((u - mean - 0.5) / sigma);
+    pFaster = upper((mean - u - 0.5) / sigma);
+}
+
+// -----------------------------------------------------------
+// [name] : Bootstrap
+// [function] : find the confidence interval of the ratio of the medians
+// [input] : the times of the baseline and of the new run, the
+//           confidence, the bounds to set
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+void Comparison::Bootstrap(const vector<double>& base,
+                           const vector<double>& current, double confidence,
+                           double& low, double& high) {
+    uint64_t state = BOOTSTRAP_SEED;
+    vector<double> ratios;
+    ratios.reserve(BOOTSTRAP_RESAMPLES);
+    vector<double> baseSample(base.size());
+    vector<double> currentSample(current.size());
+    for (size_t r = 0; r < BOOTSTRAP_RESAMPLES; r++) {
+        for (double& time : baseSample) {
+            time = base[NextRandom(state) % base.size()];
+        }
+        for (double& time : currentSample) {
+            time = current[NextRandom(state) % current.size()];
+        }
+        double baseMedian = Median(baseSample);
+        if (baseMedian > 0) {
+            ratios.push_back(Median(currentSample) / baseMedian);
+        }
+    }
+    if (ratios.empty()) {
+        return;
+    }
+    sort(ratios.begin(), ratios.end());
+    double tail = (1.0 - confidence) / 2.0;
+    size_t last = ratios.size() - 1;
+    low = ratios[static_cast<size_t>(floor(tail * last))];
+    high = ratios[static_cast<size_t>(ceil((1.0 - tail) * last))];
+}
@@ -0,0 +1,99 @@
+// [file name] : comparison.hpp
+// [function] : declare the Comparison class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init Comparison class
+// reason: a single slower median is often noise, a regression has to
+//         stand out from the spread of the repetitions
+// -----------------------------------------------------------
+
+#ifndef COMPARISON_HPP
+#define COMPARISON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// notes on the class Comparison
+// -----------------------------------------------------------
+// [class name] : Comparison
+// [function] : compare the repetitions of a benchmark in two runs
+// [notes on interface] :
+// 1. Compare takes the times of the baseline and of the new run. the
+//    change is the ratio of the medians minus 1, so 0.05 is 5% slower
+// 2. the p values are of the one-sided Mann-Whitney U test, with the
+//    normal approximation corrected for ties and continuity. PSlower is
+//    small if the new times tend to be larger
+// 3. the confidence interval of the ratio of the medians is found with
+//    a bootstrap of the two runs. the random numbers are seeded, so the
+//    same runs always give the same interval
+// 4. with fewer than MIN_SAMPLES times in a run nothing is tested, both
+//    p values are 1 and the interval is the ratio alone
+// 5. Classify gives SLOWER if the change is above the threshold and
+//    PSlower below alpha, FASTER for the opposite, SAME otherwise
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class Comparison
+{
+public:
+    // notes for the Verdict enum class
+    // -----------------------------------------------------------
+    // [enum class name] : Verdict
+    // [function] : define the outcome of a comparison
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -----------------------------------------------------------
+    enum class Verdict {
+        SAME,
+        SLOWER,
+        FASTER
+    };
+    // the outcome of a comparison
+    struct Outcome {
+        double BaseMedian;
+        double NewMedian;
+        double Change;
+        double RatioLow;
+        double RatioHigh;
+        double PSlower;
+        double PFaster;
+        bool Tested;
+    };
+    // the fewest times of a run for the tests
+    static const size_t MIN_SAMPLES;
+    // the resamples of the bootstrap
+    static const size_t BOOTSTRAP_RESAMPLES;
+
+    // compare two runs at a confidence, e.g. 0.95
+    static Outcome Compare(const vector<double>& base,
+                           const vector<double>& current,
+                           double confidence);
+    // classify an outcome with a threshold of the change and a level
+    static Verdict Classify(const Outcome& outcome, double threshold,
+                            double alpha);
+    // the median of some times, 0 for none
+    static double Median(vector<double> values);
+
+private:
+    // static class, no instances
+    Comparison() = delete;
+    // the one-sided p values of the Mann-Whitney U test
+    static void MannWhitney(const vector<double>& base,
+                            const vector<double>& current,
+                            double& pSlower, double& pFaster);
+    // the bootstrap interval of the ratio of the medians
+    static void Bootstrap(const vector<double>& base,
+                          const vector<double>& current, double confidence,
+                          double& low, double& high);
+};
+
+#endif // COMPARISON_HPP
@@ -0,0 +1,370 @@
+// [file name] : jsonvalue.cpp
+// [function] : implement the JsonValue class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add implementation of the JsonValue class
+// reason: to read the JSON written by bench
+// -----------------------------------------------------------
+
+#include "jsonvalue.hpp"
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+// the deepest nesting of arrays and objects
+static const size_t MAX_DEPTH = 64;
+
+// notes on the class JsonParser
+// -----------------------------------------------------------
+// [class name] : JsonParser
+// [function] : parse a JSON document by recursive descent
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+class JsonParser
+{
+public:
+    // constructor, the text of the document
+    JsonParser(const string& text) : m_text(text), m_offset(0) {}
+
+    // -------------------------------------------------------
+    // [name] : ParseDocument
+    // [function] : parse the whole text as one value
+    // [input] : the value to fill, the error to set
+    // [output] : false on a syntax error
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -------------------------------------------------------
+    bool ParseDocument(JsonValue& value, string& error) {
+        SkipSpace();
+        if (!ParseValue(value, 0)) {
+            error = m_error + " at offset " + to_string(m_offset);
+            return false;
+        }
+        SkipSpace();
+        if (m_offset != m_text.size()) {
+            error = "text after the value at offset " + to_string(m_offset);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    // skip the white space
+    void SkipSpace() {
+        while (m_offset < m_text.size() &&
+               strchr(" \t\r\n", m_text[m_offset]) != nullptr &&
+               m_text[m_offset] != '\0') {
+            m_offset++;
+        }
+    }
+
+    // keep the first error
+    bool Fail(const char* message) {
+        if (m_error.empty()) {
+            m_error = message;
+        }
+        return false;
+    }
+
+    // take a word such as true, false or null
+    bool TakeWord(const char* word) {
+        size_t length = strlen(word);
+        if (m_text.compare(m_offset, length, word) != 0) {
+            return Fail("unknown word");
+        }
+        m_offset += length;
+        return true;
+    }
+
+    // -------------------------------------------------------
+    // [name] : ParseValue
+    // [function] : parse one value
+    // [input] : the value to fill, the depth of the value
+    // [output] : false on a syntax error
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -------------------------------------------------------
+    bool ParseValue(JsonValue& value, size_t depth) {
+        if (depth > MAX_DEPTH) {
+            return Fail("nested too deep");
+        }
+        if (m_offset >= m_text.size()) {
+            return Fail("missing value");
+        }
+        char c = m_text[m_offset];
+        if (c == '{') {
+            return ParseObject(value, depth);
+        }
+        if (c == '[') {
+            return ParseArray(value, depth);
+        }
+        if (c == '"') {
+            value.m_type = JsonValue::Type::STRING;
+            return ParseString(value.m_string);
+        }
+        if (c == 't' || c == 'f') {
+            value.m_type = JsonValue::Type::BOOLEAN;
+            value.m_boolean = c == 't';
+            return TakeWord(c == 't' ? "true" : "false");
+        }
+        if (c == 'n') {
+            value.m_type = JsonValue::Type::NUL;
+            return TakeWord("null");
+        }
+        return ParseNumber(value);
+    }
+
+    // -------------------------------------------------------
+    // [name] : ParseObject
+    // [function] : parse an object
+    // [input] : the value to fill, the depth of the object
+    // [output] : false on a syntax error
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -------------------------------------------------------
+    bool ParseObject(JsonValue& value, size_t depth) {
+        value.m_type = JsonValue::Type::OBJECT;
+        m_offset++;
+        SkipSpace();
+        if (m_offset < m_text.size() && m_text[m_offset] == '}') {
+            m_offset++;
+            return true;
+        }
+        while (true) {
+            SkipSpace();
+            if (m_offset >= m_text.size() || m_text[m_offset] != '"') {
+                return Fail("missing key");
+            }
+            pair<string, JsonValue> member;
+            if (!ParseString(member.first)) {
+                return false;
+            }
+            SkipSpace();
+            if (m_offset >= m_text.size() || m_text[m_offset] != ':') {
+                return Fail("missing ':'");
+            }
+            m_offset++;
+            SkipSpace();
+            if (!ParseValue(member.second, depth + 1)) {
+                return false;
+            }
+            value.m_members.push_back(move(member));
+            SkipSpace();
+            if (m_offset < m_text.size() && m_text[m_offset] == ',') {
+                m_offset++;
+                continue;
+            }
+            if (m_offset < m_text.size() && m_text[m_offset] == '}') {
+                m_offset++;
+                return true;
+            }
+            return Fail("missing ',' or '}'");
+        }
+    }
+
+    // -------------------------------------------------------
+    // [name] : ParseArray
+    // [function] : parse an array
+    // [input] : the value to fill, the depth of the array
+    // [output] : false on a syntax error
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -------------------------------------------------------
+    bool ParseArray(JsonValue& value, size_t depth) {
+        value.m_type = JsonValue::Type::ARRAY;
+        m_offset++;
+        SkipSpace();
+        if (m_offset < m_text.size() && m_text[m_offset] == ']') {
+            m_offset++;
+            return true;
+        }
+        while (true) {
+            SkipSpace();
+            value.m_items.push_back(JsonValue());
+            if (!ParseValue(value.m_items.back(), depth + 1)) {
+                return false;
+            }
+            SkipSpace();
+            if (m_offset < m_text.size() && m_text[m_offset] == ',') {
+                m_offset++;
+                continue;
+            }
+            if (m_offset < m_text.size() && m_text[m_offset] == ']') {
+                m_offset++;
+                return true;
+            }
+            return Fail("missing ',' or ']'");
+        }
+    }
+
+    // -------------------------------------------------------
+    // [name] : ParseString
+    // [function] : parse a string and its escapes
+    // [input] : the string to fill
+    // [output] : false on a syntax error
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -------------------------------------------------------
+    bool ParseString(string& text) {
+        m_offset++;
+        while (m_offset < m_text.size()) {
+            char c = m_text[m_offset++];
+            if (c == '"') {
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) {
+                return Fail("control character in a string");
+            }
+            if (c != '\\') {
+                text += c;
+                continue;
+            }
+            if (m_offset >= m_text.size()) {
+                break;
+            }
+            char escape = m_text[m_offset++];
+            const char* plain = strchr("\"\\/bfnrt", escape);
+            if (plain != nullptr && escape != '\0') {
+                text += "\"\\/\b\f\n\r\t"[plain - "\"\\/bfnrt"];
+                continue;
+            }
+            if (escape != 'u' || m_offset + 4 > m_text.size()) {
+                return Fail("bad escape");
+            }
+            char* end = nullptr;
+            string digits = m_text.substr(m_offset, 4);
+            unsigned long code = strtoul(digits.c_str(), &end, 16);
+            if (end != digits.c_str() + 4) {
+                return Fail("bad escape");
+            }
+            m_offset += 4;
+            // UTF-8 of a code point below 0x10000
+            if (code < 0x80) {
+                text += static_cast<char>(code);
+            }
+            else if (code < 0x800) {
+                text += static_cast<char>(0xc0 | (code >> 6));
+                text += static_cast<char>(0x80 | (code & 0x3f));
+            }
+            else {
+                text += static_cast<char>(0xe0 | (code >> 12));
+                text += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                text += static_cast<char>(0x80 | (code & 0x3f));
+            }
+        }
+        return Fail("unterminated string");
+    }
+
+    // -------------------------------------------------------
+    // [name] : ParseNumber
+    // [function] : parse a number
+    // [input] : the value to fill
+    // [output] : false on a syntax error
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -------------------------------------------------------
+    bool ParseNumber(JsonValue& value) {
+        size_t start = m_offset;
+        while (m_offset < m_text.size() &&
+               strchr("+-0123456789.eE", m_text[m_offset]) != nullptr &&
+               m_text[m_offset] != '\0') {
+            m_offset++;
+        }
+        string number = m_text.substr(start, m_offset - start);
+        char* end = nullptr;
+        value.m_type = JsonValue::Type::NUMBER;
+        value.m_number = strtod(number.c_str(), &end);
+        if (number.empty() || end != number.c_str() + number.size()) {
+            m_offset = start;
+            return Fail("bad number");
+        }
+        return true;
+    }
+
+    // private member variables
+    const string& m_text;
+    size_t m_offset;
+    string m_error;
+};
+
+// -----------------------------------------------------------
+// [name] : JsonValue
+// [function] : constructor of the JsonValue class
+// [input] : none
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+JsonValue::JsonValue()
+    : m_type(Type::NUL), m_boolean(false), m_number(0.0) {}
+
+// -----------------------------------------------------------
+// [name] : Parse
+// [function] : parse a JSON document
+// [input] : the text, the value to fill, the error to set
+// [output] : false on a syntax error
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+bool JsonValue::Parse(const string& text, JsonValue& value, string& error) {
+    value = JsonValue();
+    return JsonParser(text).ParseDocument(value, error);
+}
+
+// -----------------------------------------------------------
+// [name] : GetType, GetBoolean, GetNumber, GetString, GetItems,
+//          GetMembers
+// [function] : getters of the value
+// [input] : none
+// [output] : the kind or the value of its kind
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+JsonValue::Type JsonValue::GetType() const {
+    return m_type;
+}
+
+bool JsonValue::GetBoolean() const {
+    return m_boolean;
+}
+
+double JsonValue::GetNumber() const {
+    return m_number;
+}
+
+const string& JsonValue::GetString() const {
+    return m_string;
+}
+
+const vector<JsonValue>& JsonValue::GetItems() const {
+    return m_items;
+}
+
+const vector<pair<string, JsonValue>>& JsonValue::GetMembers() const {
+    return m_members;
+}
+
+// -----------------------------------------------------------
+// [name] : Find
+// [function] : find a member of an object
+// [input] : the key
+// [output] : the first member of the key, nullptr if there is none or
+//            the value is not an object
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+const JsonValue* JsonValue::Find(const string& key) const {
+    for (const pair<string, JsonValue>& member : m_members) {
+        if (member.first == key) {
+            return &member.second;
+        }
+    }
+    return nullptr;
+}
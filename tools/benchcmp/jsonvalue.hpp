@@ -0,0 +1,86 @@
+// [file name] : jsonvalue.hpp
+// [function] : declare the JsonValue class
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: init JsonValue class
+// reason: benchcmp reads the JSON written by bench
+// -----------------------------------------------------------
+
+#ifndef JSONVALUE_HPP
+#define JSONVALUE_HPP
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// notes on the class JsonValue
+// -----------------------------------------------------------
+// [class name] : JsonValue
+// [function] : hold a parsed JSON document
+// [notes on interface] :
+// 1. Parse reads a whole document, on a syntax error it returns false
+//    and sets the error with the offset of the problem
+// 2. an object keeps its members in the order of the document, Find
+//    returns the first member of a key or nullptr
+// 3. the escapes \uXXXX are kept as UTF-8, a surrogate pair is not
+//    joined, bench never writes one
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+
+class JsonValue
+{
+public:
+    // notes for the Type enum class
+    // -----------------------------------------------------------
+    // [enum class name] : Type
+    // [function] : define the kind of a value
+    // [author] : Huayu Chen
+    // [date] : 2026/10/19
+    // -----------------------------------------------------------
+    enum class Type {
+        NUL,
+        BOOLEAN,
+        NUMBER,
+        STRING,
+        ARRAY,
+        OBJECT
+    };
+
+    // constructor, a null value
+    JsonValue();
+    // parse a document, false with an error on a syntax error
+    static bool Parse(const string& text, JsonValue& value, string& error);
+    // the kind of the value
+    Type GetType() const;
+    // the value of each kind, false, 0 or empty for another kind
+    bool GetBoolean() const;
+    double GetNumber() const;
+    const string& GetString() const;
+    const vector<JsonValue>& GetItems() const;
+    const vector<pair<string, JsonValue>>& GetMembers() const;
+    // the first member of a key, nullptr if there is none
+    const JsonValue* Find(const string& key) const;
+
+private:
+    // the parser fills the members
+    friend class JsonParser;
+
+    // private member variables
+    Type m_type;
+    bool m_boolean;
+    double m_number;
+    string m_string;
+    vector<JsonValue> m_items;
+    vector<pair<string, JsonValue>> m_members;
+};
+
+#endif // JSONVALUE_HPP
@@ -0,0 +1,428 @@
+// [file name] : main.cpp
+// [function] : main function of the benchmark comparison
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add main function of benchcmp
+// reason: to keep the results of bench as baselines and to fail a build
+//         when a later run is slower beyond the noise
+// -----------------------------------------------------------
+
+#include "comparison.hpp"
+#include "jsonvalue.hpp"
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+using namespace std;
+
+// the directory of the baselines, unless --dir
+static const char* DEFAULT_DIRECTORY = "build/bench_baselines";
+// the change above which a benchmark may be slower, in percent
+static const double DEFAULT_THRESHOLD = 5.0;
+// the level of the test, a smaller p value is significant
+static const double DEFAULT_ALPHA = 0.05;
+// the confidence of the interval of the ratio
+static const double CONFIDENCE = 0.95;
+
+// a benchmark of a run
+struct BenchmarkTimes {
+    double Median;
+    vector<double> Samples;
+};
+
+// the benchmarks of a run by name, and the build that ran them
+struct BenchmarkRun {
+    string Build;
+    map<string, BenchmarkTimes> Benchmarks;
+};
+
+// -----------------------------------------------------------
+// [name] : PrintUsage
+// [function] : print the commands and their options
+// [input] : the name of the program
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void PrintUsage(const char* program) {
+    cerr << "usage: " << program << " compare BASE NEW [--threshold PCT] "
+         << "[--alpha P] [--filter TEXT] [--dir DIR]" << endl
+         << "       " << program << " store RUN NAME [--dir DIR]" << endl
+         << "  compare two outputs of bench, exit 1 if a benchmark is "
+         << "slower" << endl
+         << "  BASE and NEW are files, or names of baselines in DIR"
+         << endl
+         << "  store keeps an output of bench as the baseline NAME"
+         << endl
+         << "  --threshold PCT  change above which a benchmark is slower, "
+         << "default 5" << endl
+         << "  --alpha P        level of the test, default 0.05" << endl
+         << "  --filter TEXT    only compare the benchmarks containing TEXT"
+         << endl
+         << "  --dir DIR        directory of the baselines, default "
+         << DEFAULT_DIRECTORY << endl;
+}
+
+// -----------------------------------------------------------
+// [name] : ReadFile
+// [function] : read a whole file
+// [input] : the path, the text to fill
+// [output] : false if the file cannot be read
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool ReadFile(const string& path, string& text) {
+    ifstream file(path, ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    ostringstream stream;
+    stream << file.rdbuf();
+    text = stream.str();
+    return static_cast<bool>(file) || file.eof();
+}
+
+// -----------------------------------------------------------
+// [name] : ReadRun
+// [function] : read an output of bench
+// [input] : the path, the run to fill, the error to set
+// [output] : false if the file cannot be read or is not an output of
+//            bench
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool ReadRun(const string& path, BenchmarkRun& run, string& error) {
+    string text;
+    if (!ReadFile(path, text)) {
+        error = "Failed to read " + path;
+        return false;
+    }
+    JsonValue document;
+    if (!JsonValue::Parse(text, document, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    const JsonValue* benchmarks = document.Find("benchmarks");
+    if (benchmarks == nullptr ||
+        benchmarks->GetType() != JsonValue::Type::ARRAY) {
+        error = path + ": no benchmarks";
+        return false;
+    }
+    const JsonValue* context = document.Find("context");
+    const JsonValue* build = context != nullptr
+        ? context->Find("build") : nullptr;
+    run.Build = build != nullptr ? build->GetString() : "";
+    for (const JsonValue& benchmark : benchmarks->GetItems()) {
+        const JsonValue* name = benchmark.Find("name");
+        const JsonValue* median = benchmark.Find("median_ns");
+        if (name == nullptr || name->GetType() != JsonValue::Type::STRING ||
+            median == nullptr ||
+            median->GetType() != JsonValue::Type::NUMBER) {
+            error = path + ": a benchmark has no name or median_ns";
+            return false;
+        }
+        BenchmarkTimes times;
+        times.Median = median->GetNumber();
+        // older outputs have no samples, they are compared by the median
+        const JsonValue* samples = benchmark.Find("samples_ns");
+        if (samples != nullptr) {
+            for (const JsonValue& sample : samples->GetItems()) {
+                times.Samples.push_back(sample.GetNumber());
+            }
+        }
+        run.Benchmarks[name->GetString()] = times;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : ResolvePath
+// [function] : find the file of a run
+// [input] : a path, or the name of a baseline, the directory of the
+//           baselines
+// [output] : the path if the file exists or ends with .json,
+//            DIR/NAME.json otherwise
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static string ResolvePath(const string& argument, const string& directory) {
+    const string extension = ".json";
+    ifstream file(argument);
+    if (file.is_open() || (argument.size() > extension.size() &&
+        argument.compare(argument.size() - extension.size(),
+                         extension.size(), extension) == 0)) {
+        return argument;
+    }
+    return directory + "/" + argument + ".json";
+}
+
+// -----------------------------------------------------------
+// [name] : MakeDirectory
+// [function] : create a directory and its parents
+// [input] : the path
+// [output] : false if it cannot be created
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool MakeDirectory(const string& path) {
+    for (size_t i = 1; i <= path.size(); i++) {
+        if (i < path.size() && path[i] != '/' && path[i] != '\\') {
+            continue;
+        }
+        string part = path.substr(0, i);
+#ifdef _WIN32
+        int failed = _mkdir(part.c_str());
+#else
+        int failed = mkdir(part.c_str(), 0755);
+#endif
+        if (failed != 0 && errno != EEXIST) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------
+// [name] : FormatTime
+// [function] : format a duration with a unit
+// [input] : the duration in nanoseconds
+// [output] : the text, e.g. "12.3 us"
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static string FormatTime(double nanoseconds) {
+    const char* unit = "ns";
+    double value = nanoseconds;
+    if (value >= 1e9) {
+        value /= 1e9;
+        unit = "s";
+    }
+    else if (value >= 1e6) {
+        value /= 1e6;
+        unit = "ms";
+    }
+    else if (value >= 1e3) {
+        value /= 1e3;
+        unit = "us";
+    }
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.3g %s", value, unit);
+    return buffer;
+}
+
+// -----------------------------------------------------------
+// [name] : Store
+// [function] : keep an output of bench as a baseline
+// [input] : the path of the output, the name of the baseline, the
+//           directory of the baselines
+// [output] : the exit code, 0 if it was stored
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int Store(const string& path, const string& name,
+                 const string& directory) {
+    BenchmarkRun run;
+    string error;
+    if (!ReadRun(path, run, error)) {
+        cerr << error << endl;
+        return 2;
+    }
+    string text;
+    ReadFile(path, text);
+    if (!MakeDirectory(directory)) {
+        cerr << "Failed to create " << directory << endl;
+        return 1;
+    }
+    string target = directory + "/" + name + ".json";
+    ofstream file(target, ios::binary);
+    file << text;
+    if (!file) {
+        cerr << "Failed to write " << target << endl;
+        return 1;
+    }
+    cerr << "Stored " << run.Benchmarks.size() << " benchmarks as "
+         << target << endl;
+    return 0;
+}
+
+// -----------------------------------------------------------
+// [name] : Compare
+// [function] : compare two outputs of bench and print a table
+// [input] : the paths of the baseline and of the new run, the
+//           threshold as a fraction, the level of the test, the filter
+// [output] : the exit code, 1 if a benchmark is slower
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static int Compare(const string& basePath, const string& newPath,
+                   double threshold, double alpha, const string& filter) {
+    BenchmarkRun base, current;
+    string error;
+    if (!ReadRun(basePath, base, error) ||
+        !ReadRun(newPath, current, error)) {
+        cerr << error << endl;
+        return 2;
+    }
+    if (base.Build != current.Build) {
+        cerr << "Warning: the runs are of different builds, "
+             << base.Build << " and " << current.Build << endl;
+    }
+
+    // every name of both runs, in order
+    map<string, bool> names;
+    for (const auto& entry : base.Benchmarks) {
+        names[entry.first] = true;
+    }
+    for (const auto& entry : current.Benchmarks) {
+        names[entry.first] = true;
+    }
+    size_t slower = 0, faster = 0, same = 0;
+    char row[256];
+    printf("%-32s %10s %10s %8s %17s %7s  %s\n", "benchmark", "base",
+           "new", "change", "95% ci of ratio", "p", "verdict");
+    for (const auto& entry : names) {
+        const string& name = entry.first;
+        if (!filter.empty() && name.find(filter) == string::npos) {
+            continue;
+        }
+        auto baseIt = base.Benchmarks.find(name);
+        auto newIt = current.Benchmarks.find(name);
+        if (baseIt == base.Benchmarks.end() ||
+            newIt == current.Benchmarks.end()) {
+            bool missing = newIt == current.Benchmarks.end();
+            double median = missing ? baseIt->second.Median
+                                    : newIt->second.Median;
+            printf("%-32s %10s %10s %8s %17s %7s  %s\n", name.c_str(),
+                   missing ? FormatTime(median).c_str() : "-",
+                   missing ? "-" : FormatTime(median).c_str(), "-", "-",
+                   "-", missing ? "missing" : "new");
+            continue;
+        }
+        // a run without samples is compared by its median alone
+        vector<double> baseTimes = baseIt->second.Samples;
+        vector<double> newTimes = newIt->second.Samples;
+        if (baseTimes.empty()) {
+            baseTimes.push_back(baseIt->second.Median);
+        }
+        if (newTimes.empty()) {
+            newTimes.push_back(newIt->second.Median);
+        }
+        Comparison::Outcome outcome =
+            Comparison::Compare(baseTimes, newTimes, CONFIDENCE);
+        Comparison::Verdict verdict;
+        if (outcome.Tested) {
+            verdict = Comparison::Classify(outcome, threshold, alpha);
+        }
+        else {
+            // too few times for a test, the change alone decides
+            verdict = outcome.Change > threshold
+                ? Comparison::Verdict::SLOWER
+                : outcome.Change < -threshold
+                    ? Comparison::Verdict::FASTER
+                    : Comparison::Verdict::SAME;
+        }
+        const char* text = "same";
+        if (verdict == Comparison::Verdict::SLOWER) {
+            text = "SLOWER";
+            slower++;
+        }
+        else if (verdict == Comparison::Verdict::FASTER) {
+            text = "faster";
+            faster++;
+        }
+        else {
+            same++;
+        }
+        char interval[32], p[16];
+        if (outcome.Tested) {
+            snprintf(interval, sizeof(interval), "[%.3f, %.3f]",
+                     outcome.RatioLow, outcome.RatioHigh);
+            snprintf(p, sizeof(p), "%.3f",
+                     outcome.Change >= 0 ? outcome.PSlower
+                                         : outcome.PFaster);
+        }
+        else {
+            snprintf(interval, sizeof(interval), "-");
+            snprintf(p, sizeof(p), "-");
+        }
+        snprintf(row, sizeof(row),
+                 "%-32s %10s %10s %+7.1f%% %17s %7s  %s%s", name.c_str(),
+                 FormatTime(outcome.BaseMedian).c_str(),
+                 FormatTime(outcome.NewMedian).c_str(),
+                 outcome.Change * 100.0, interval, p, text,
+                 outcome.Tested ? "" : " (few samples)");
+        printf("%s\n", row);
+    }
+    printf("\n%llu slower, %llu faster, %llu same, threshold %.1f%%, "
+           "alpha %.3g\n",
+           static_cast<unsigned long long>(slower),
+           static_cast<unsigned long long>(faster),
+           static_cast<unsigned long long>(same), threshold * 100.0,
+           alpha);
+    return slower > 0 ? 1 : 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+    string command = argv[1];
+    string first = argv[2];
+    string second = argv[3];
+    string directory = DEFAULT_DIRECTORY;
+    string filter;
+    double threshold = DEFAULT_THRESHOLD;
+    double alpha = DEFAULT_ALPHA;
+    for (int i = 4; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--threshold") == 0 && hasValue) {
+            threshold = strtod(argv[++i], nullptr);
+        }
+        else if (strcmp(argv[i], "--alpha") == 0 && hasValue) {
+            alpha = strtod(argv[++i], nullptr);
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && hasValue) {
+            filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--dir") == 0 && hasValue) {
+            directory = argv[++i];
+        }
+        else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+    if (threshold < 0 || alpha <= 0 || alpha >= 1) {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+
+    if (command == "store") {
+        return Store(first, second, directory);
+    }
+    if (command == "compare") {
+        return Compare(ResolvePath(first, directory),
+                       ResolvePath(second, directory), threshold / 100.0,
+                       alpha, filter);
+    }
+    PrintUsage(argv[0]);
+    return 2;
+}
@@ -0,0 +1,124 @@
+// [file name] : main.cpp
+// [function] : main function of the client of the server
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add main function of hwclient
+// reason: to run commands against a model served by hw --serve
+// -----------------------------------------------------------
+
+#include "Controller/controller.hpp"
+#include "Ipc/ipcclient.hpp"
+#include "Message/argument.hpp"
+#include "Message/response.hpp"
+#include "Viewer/scriptrunner.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : PrintUsage
+// [function] : print the command line options
+// [input] : the name of the program
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void PrintUsage(const char* program) {
+    cerr << "usage: " << program << " SOCKET [-e COMMAND]... [FILE|-] "
+         << "[--continue] [--batch] [--quiet]" << endl
+         << "  send the commands of the script mode to hw --serve SOCKET"
+         << endl
+         << "  -e COMMAND     run one command, can be repeated" << endl
+         << "  FILE           run the commands of FILE, '-' or no FILE "
+         << "and no -e reads stdin" << endl
+         << "  --continue     keep running after a failed command" << endl
+         << "  --batch        send all commands in one request" << endl
+         << "  --quiet        do not print the values of the responses"
+         << endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || strncmp(argv[1], "-", 1) == 0) {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+    string socketPath = argv[1];
+    string scriptPath;
+    string commands;
+    bool continueOnError = false;
+    bool batch = false;
+    bool quiet = false;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+            commands += argv[++i];
+            commands += '\n';
+        }
+        else if (strcmp(argv[i], "--continue") == 0) {
+            continueOnError = true;
+        }
+        else if (strcmp(argv[i], "--batch") == 0) {
+            batch = true;
+        }
+        else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = true;
+        }
+        else if (scriptPath.empty() &&
+                 (strcmp(argv[i], "-") == 0 || argv[i][0] != '-')) {
+            scriptPath = argv[i];
+        }
+        else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (!commands.empty() && !scriptPath.empty()) {
+        // the commands come either from -e or from the script
+        PrintUsage(argv[0]);
+        return 2;
+    }
+
+    IpcClient client;
+    string error;
+    if (!client.Connect(socketPath, error)) {
+        cerr << error << endl;
+        return 1;
+    }
+    ScriptRunner runner(cout, continueOnError, batch, quiet);
+    runner.SetHandler([&client](const vector<Argument>& arguments,
+                                Controller::BatchMode mode) {
+        vector<Response> responses;
+        string message;
+        if (!client.Send(arguments, mode, responses, message) ||
+            responses.empty()) {
+            cerr << (message.empty() ? "the server sent no response"
+                                     : message) << endl;
+            return vector<Response>{Response(
+                Response::ResponseKey::UNKNOWN_RUN_TIME_ERROR, {})};
+        }
+        return responses;
+    });
+
+    if (!commands.empty()) {
+        istringstream script(commands);
+        return runner.Run(script);
+    }
+    if (scriptPath.empty() || scriptPath == "-") {
+        return runner.Run(cin);
+    }
+    ifstream file(scriptPath);
+    if (!file.is_open()) {
+        cerr << "Failed to open the script " << scriptPath << endl;
+        return 2;
+    }
+    return runner.Run(file);
+}
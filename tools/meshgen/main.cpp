@@ -0,0 +1,169 @@
+// [file name] : main.cpp
+// [function] : main function of the mesh generator
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+
+// [edit history] :
+// -----------------------------------------------------------
+// date: 2026/10/19
+// author: Huayu Chen
+// edit: add main function of meshgen
+// reason: to write models of realistic sizes for the benchmarks and
+//         the stress tests
+// -----------------------------------------------------------
+
+#include "Model/Element3D/face3d.hpp"
+#include "Model/Element3D/line3d.hpp"
+#include "Model/FileIO/model3dobjexporter.hpp"
+#include "Model/Generator/meshgenerator.hpp"
+#include "Model/Model3D/model3d.hpp"
+#include "Model/Progress/progress.hpp"
+#include "Model/Result/result.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// -----------------------------------------------------------
+// [name] : PrintUsage
+// [function] : print the command line options
+// [input] : the name of the program
+// [output] : none
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static void PrintUsage(const char* program) {
+    cerr << "usage: " << program << " SHAPE FACES FILE [--seed N] "
+         << "[--duplicates SHARE] [--degenerates SHARE] [--exporter]"
+         << endl
+         << "  write a generated mesh of about FACES faces to an OBJ FILE"
+         << endl
+         << "  SHAPE              sphere, terrain, soup or defective" << endl
+         << "  --seed N           the seed of the mesh, default 1" << endl
+         << "  --duplicates SHARE share of repeated faces of defective, "
+         << "default 0.01" << endl
+         << "  --degenerates SHARE share of degenerate faces of "
+         << "defective, default 0.01" << endl
+         << "  --exporter         build the model and write it with the "
+         << "exporter, slow for large meshes" << endl;
+}
+
+// -----------------------------------------------------------
+// [name] : ParseCount
+// [function] : read a count such as 1000, 1K, 10M
+// [input] : the text, the count to set
+// [output] : false if the text is not a count
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static bool ParseCount(const char* text, uint64_t& count) {
+    char* end = nullptr;
+    unsigned long long value = strtoull(text, &end, 10);
+    if (end == text) {
+        return false;
+    }
+    if (*end == 'K' || *end == 'k') {
+        value *= 1000;
+        end++;
+    }
+    else if (*end == 'M' || *end == 'm') {
+        value *= 1000000;
+        end++;
+    }
+    count = value;
+    return *end == '\0';
+}
+
+// -----------------------------------------------------------
+// [name] : ExportMesh
+// [function] : build the mesh in memory and write it with the exporter
+// [input] : the options, the path, the faces to set
+// [output] : NONE, EXPORT_FAILED, or the error of MakeFaces
+// [author] : Huayu Chen
+// [date] : 2026/10/19
+// -----------------------------------------------------------
+static ErrorCode ExportMesh(const MeshGenerator::Options& options,
+                            const string& path, uint64_t& faces) {
+    Result<vector<Face3D>> made = MeshGenerator::MakeFaces(options);
+    if (!made.IsOk()) {
+        return made.GetError();
+    }
+    faces = made.GetValue().size();
+    Model3D model(made.GetValue(), vector<Line3D>(),
+                  MeshGenerator::ShapeName(options.Kind));
+    try {
+        Model3DObjExporter().Save(path, model);
+    }
+    catch (const exception&) {
+        return ErrorCode::EXPORT_FAILED;
+    }
+    return ErrorCode::NONE;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+    MeshGenerator::Options options{MeshGenerator::Shape::TERRAIN, 0, 1,
+                                   0.01, 0.01};
+    if (!MeshGenerator::ParseShape(argv[1], options.Kind) ||
+        !ParseCount(argv[2], options.Faces)) {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+    string path = argv[3];
+    bool useExporter = false;
+    for (int i = 4; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+            if (!ParseCount(argv[++i], options.Seed)) {
+                PrintUsage(argv[0]);
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "--duplicates") == 0 && hasValue) {
+            options.DuplicateShare = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--degenerates") == 0 && hasValue) {
+            options.DegenerateShare = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--exporter") == 0) {
+            useExporter = true;
+        }
+        else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    ErrorCode code;
+    uint64_t faces = 0;
+    if (useExporter) {
+        code = ExportMesh(options, path, faces);
+    }
+    else {
+        Progress progress;
+        code = MeshGenerator::WriteObj(options, path, &progress);
+        faces = progress.GetFaces();
+    }
+    if (code != ErrorCode::NONE) {
+        cerr << "Failed to generate the mesh: " << ErrorMessage(code)
+             << endl;
+        return 1;
+    }
+    double seconds = chrono::duration<double>(
+        chrono::steady_clock::now() - start).count();
+    ifstream file(path, ios::binary | ios::ate);
+    cout << "Wrote " << faces << " faces of a "
+         << MeshGenerator::ShapeName(options.Kind) << " to " << path
+         << " (" << static_cast<long long>(file.tellg()) << " bytes, "
+         << seconds << " s)" << endl;
+    return 0;
+}
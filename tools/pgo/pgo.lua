@@ -0,0 +1,254 @@
+-- [file name] : pgo.lua
+-- [function] : build hw with profile-guided optimization
+-- [author] : Huayu Chen
+-- [date] : 2026/10/19
+
+-- [edit history] :
+-- -----------------------------------------------------------
+-- date: 2026/10/19
+-- author: Huayu Chen
+-- edit: add the profile-guided build
+-- reason: the argument dispatch of the controller, the line dispatch of
+--         the importer and the validation of the faces are branchy, the
+--         compiler lays them out better with a profile
+-- -----------------------------------------------------------
+
+-- run from the project directory with
+--     xmake lua tools/pgo/pgo.lua [--runs N]
+-- 1. builds hw and meshgen in the release mode, writes the models of
+--    the workload with meshgen and times the workload
+-- 2. builds hw in the pgo mode with --pgo_phase=generate and runs the
+--    workload once to write the profile
+-- 3. builds hw in the pgo mode with --pgo_phase=use and times the
+--    workload again
+-- 4. writes the median times of both builds to build/pgo/report.txt
+-- the project is left configured in the pgo mode, so hw is the optimized
+-- build afterwards. the toolchain is gcc, as in the rest of the project
+
+import("core.project.config")
+
+-- the timed runs of the workload for each build, unless --runs
+local DEFAULT_RUNS = 5
+-- the workload and the files it reads and writes
+local WORKLOAD = path.join("tools", "pgo", "training.txt")
+local DIRECTORY = path.join("build", "pgo")
+local PROFILES = path.join(DIRECTORY, "profiles")
+-- the models of the workload, written by meshgen
+local MODELS = {
+    {"terrain", "20000"},
+    {"sphere", "4000"},
+    {"defective", "2000"}
+}
+
+-- -----------------------------------------------------------
+-- [name] : _xmake
+-- [function] : run xmake with some arguments
+-- [input] : the arguments
+-- [output] : none, raises an error if xmake fails
+-- [author] : Huayu Chen
+-- [date] : 2026/10/19
+-- -----------------------------------------------------------
+function _xmake(arguments)
+    os.execv(os.programfile(), arguments)
+end
+
+-- -----------------------------------------------------------
+-- [name] : _configure
+-- [function] : configure the project for a mode, keeping the platform,
+--              the architecture and the toolchain
+-- [input] : the mode, the pgo phase or nil
+-- [output] : none
+-- [author] : Huayu Chen
+-- [date] : 2026/10/19
+-- -----------------------------------------------------------
+function _configure(mode, phase)
+    local arguments = {"f", "-y", "-m", mode}
+    -- a project that was never configured gets the defaults of the host
+    if config.plat() then
+        table.join2(arguments, {"-p", config.plat(), "-a", config.arch()})
+    end
+    local toolchain = config.get("toolchain")
+    if toolchain then
+        table.insert(arguments, "--toolchain=" .. toolchain)
+    end
+    if phase then
+        table.insert(arguments, "--pgo_phase=" .. phase)
+    end
+    _xmake(arguments)
+    config.load()
+end
+
+-- -----------------------------------------------------------
+-- [name] : _program
+-- [function] : get the path of a program built in a mode
+-- [input] : the name of the target, the mode
+-- [output] : the path
+-- [author] : Huayu Chen
+-- [date] : 2026/10/19
+-- -----------------------------------------------------------
+function _program(name, mode)
+    local extension = ""
+    if config.plat() == "windows" or config.plat() == "mingw" then
+        extension = ".exe"
+    end
+    return path.join(config.buildir(), config.plat(), config.arch(), mode,
+                     name .. extension)
+end
+
+-- -----------------------------------------------------------
+-- [name] : _run
+-- [function] : run the workload once
+-- [input] : the path of hw
+-- [output] : the commands in order, the times of the commands in
+--            milliseconds by command, the total time
+-- [author] : Huayu Chen
+-- [date] : 2026/10/19
+-- -----------------------------------------------------------
+function _run(program)
+    local output = path.join(DIRECTORY, "workload_output.txt")
+    -- the refused model fails on purpose, so the exit code is 1
+    os.execv(program, {"--script", WORKLOAD, "--continue"},
+             {stdout = output, try = true})
+    local commands = {}
+    local times = {}
+    local total = nil
+    for line in io.lines(output) do
+        local number, command, time = line:match(
+            "^(%d+): (.-) %-> %S+ %(([%d%.]+) ms%)")
+        if number then
+            local key = number .. ": " .. command
+            table.insert(commands, key)
+            times[key] = tonumber(time)
+        end
+        local all = line:match("commands executed.-([%d%.]+) ms$")
+        if all then
+            total = tonumber(all)
+        end
+    end
+    if not total then
+        raise("the workload did not finish, see " .. output)
+    end
+    return commands, times, total
+end
+
+-- -----------------------------------------------------------
+-- [name] : _median
+-- [function] : get the median of some times
+-- [input] : the times
+-- [output] : the median
+-- [author] : Huayu Chen
+-- [date] : 2026/10/19
+-- -----------------------------------------------------------
+function _median(values)
+    table.sort(values)
+    local count = #values
+    if count % 2 == 1 then
+        return values[(count + 1) / 2]
+    end
+    return (values[count / 2] + values[count / 2 + 1]) / 2
+end
+
+-- -----------------------------------------------------------
+-- [name] : _measure
+-- [function] : run the workload several times
+-- [input] : the path of hw, the number of runs
+-- [output] : the commands in order, the median time of each command,
+--            the median total time
+-- [author] : Huayu Chen
+-- [date] : 2026/10/19
+-- -----------------------------------------------------------
+function _measure(program, runs)
+    local commands = nil
+    local samples = {}
+    local totals = {}
+    for run = 1, runs do
+        local names, times, total = _run(program)
+        commands = names
+        for _, name in ipairs(names) do
+            samples[name] = samples[name] or {}
+            table.insert(samples[name], times[name])
+        end
+        table.insert(totals, total)
+    end
+    local medians = {}
+    for name, values in pairs(samples) do
+        medians[name] = _median(values)
+    end
+    return commands, medians, _median(totals)
+end
+
+-- -----------------------------------------------------------
+-- [name] : _report
+-- [function] : format the times of both builds
+-- [input] : the commands, the medians and totals of both builds, the
+--           number of runs
+-- [output] : the report
+-- [author] : Huayu Chen
+-- [date] : 2026/10/19
+-- -----------------------------------------------------------
+function _report(commands, release, releaseTotal, pgo, pgoTotal, runs)
+    local lines = {
+        format("profile-guided build of hw, median of %d runs of %s",
+               runs, WORKLOAD),
+        format("%-48s %12s %12s %8s", "command", "release", "pgo",
+               "speedup")
+    }
+    local row = "%-48s %9.3f ms %9.3f ms %7.3fx"
+    for _, name in ipairs(commands) do
+        local before = release[name]
+        local after = pgo[name]
+        if before and after and after > 0 then
+            table.insert(lines, format(row, name:sub(1, 48), before, after,
+                                       before / after))
+        end
+    end
+    table.insert(lines, format(row, "total", releaseTotal, pgoTotal,
+                               releaseTotal / pgoTotal))
+    return table.concat(lines, "\n") .. "\n"
+end
+
+function main(...)
+    local arguments = {...}
+    local runs = DEFAULT_RUNS
+    if arguments[1] == "--runs" and tonumber(arguments[2]) then
+        runs = math.max(1, math.floor(tonumber(arguments[2])))
+    elseif #arguments > 0 then
+        raise("usage: xmake lua tools/pgo/pgo.lua [--runs N]")
+    end
+    os.cd(os.projectdir())
+    config.load()
+    os.mkdir(DIRECTORY)
+
+    -- the release build is the reference, meshgen writes the models
+    cprint("${bright}building the release mode")
+    _configure("release")
+    _xmake({"build", "hw"})
+    _xmake({"build", "meshgen"})
+    for _, model in ipairs(MODELS) do
+        os.execv(_program("meshgen", "release"),
+                 {model[1], model[2],
+                  path.join(DIRECTORY, model[1] .. ".obj")})
+    end
+    local commands, release, releaseTotal =
+        _measure(_program("hw", "release"), runs)
+
+    -- an old profile would be merged with the new one
+    cprint("${bright}building the instrumented pgo mode")
+    os.tryrm(PROFILES)
+    _configure("pgo", "generate")
+    _xmake({"build", "hw"})
+    _run(_program("hw", "pgo"))
+
+    cprint("${bright}building the pgo mode with the profile")
+    _configure("pgo", "use")
+    _xmake({"build", "-r", "hw"})
+    local _, pgo, pgoTotal = _measure(_program("hw", "pgo"), runs)
+
+    local report = _report(commands, release, releaseTotal, pgo, pgoTotal,
+                           runs)
+    local reportPath = path.join(DIRECTORY, "report.txt")
+    io.writefile(reportPath, report)
+    print(report)
+    print("the report is in %s, the optimized hw is %s", reportPath,
+          _program("hw", "pgo"))
+end
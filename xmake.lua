@@ -2,10 +2,131 @@ add_rules("mode.debug", "mode.release")
 
 set_project("hw")
 
+-- release build with the trace spans compiled in, for hw --trace FILE
+--   $ xmake f -m trace && xmake
+if is_mode("trace") then
+    set_symbols("debug")
+    set_optimize("faster")
+    add_defines("HW_TRACE")
+end
+
+-- profile-guided release build, instruments hw, runs the training
+-- workload of tools/pgo and rebuilds with the profile, then reports the
+-- speedup over the release mode
+--   $ xmake lua tools/pgo/pgo.lua
+-- the two phases by hand, run the workload between them
+--   $ xmake f -m pgo --pgo_phase=generate && xmake build hw
+--   $ xmake f -m pgo --pgo_phase=use && xmake build hw
+option("pgo_phase")
+    set_default("use")
+    set_showmenu(true)
+    set_values("generate", "use")
+    set_description("Instrument the pgo mode or use its profile")
+option_end()
+
+if is_mode("pgo") then
+    set_symbols("hidden")
+    set_optimize("fastest")
+    set_strip("all")
+    add_defines("NDEBUG")
+    -- both phases build the same object files, so gcc finds the profile
+    -- of every file under the same name
+    local profiles = path.join(os.projectdir(), "build", "pgo", "profiles")
+    if is_config("pgo_phase", "generate") then
+        -- the controller counts on a worker thread too
+        add_cxflags("-fprofile-generate", "-fprofile-update=atomic",
+                    "-fprofile-dir=" .. profiles)
+        add_ldflags("-fprofile-generate")
+    else
+        add_cxflags("-fprofile-use", "-fprofile-correction",
+                    "-fprofile-dir=" .. profiles)
+    end
+end
+
+-- xmake f --count_allocations=y replaces the global operator new and
+-- delete to report the heap bytes and the peak of every command
+option("count_allocations")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Count the heap allocations for the memory report")
+    add_defines("HW_COUNT_ALLOCATIONS")
+option_end()
+
 target("hw")
     set_kind("binary")
     add_files("src/**.cpp")
     add_includedirs("src")
+    add_options("count_allocations")
+    -- the controller runs long commands on a worker thread
+    if is_plat("linux", "bsd") then
+        add_syslinks("pthread")
+    end
+
+-- client of hw --serve, runs script commands against the served model
+target("hwclient")
+    set_kind("binary")
+    add_files("tools/hwclient/*.cpp")
+    add_files("src/**.cpp|main.cpp")
+    add_includedirs("src")
+    add_options("count_allocations")
+    if is_plat("linux", "bsd") then
+        add_syslinks("pthread")
+    end
+
+-- seeded meshes of any size for the benchmarks and the stress tests
+--   $ xmake build meshgen
+--   $ xmake run meshgen sphere 1M sphere.obj --seed 7
+target("meshgen")
+    set_kind("binary")
+    set_default(false)
+    add_files("tools/meshgen/*.cpp")
+    add_files("src/**.cpp|main.cpp")
+    add_includedirs("src")
+    add_options("count_allocations")
+    if is_plat("linux", "bsd") then
+        add_syslinks("pthread")
+    end
+
+-- micro-benchmarks, only built when asked for, best in release mode
+--   $ xmake f -m release && xmake build bench
+--   $ xmake run bench --output bench.json
+target("bench")
+    set_kind("binary")
+    set_default(false)
+    add_files("tools/bench/*.cpp")
+    add_files("src/**.cpp|main.cpp")
+    add_includedirs("src")
+    add_options("count_allocations")
+    if is_plat("linux", "bsd") then
+        add_syslinks("pthread")
+    end
+
+-- compares two outputs of bench, exits 1 when a benchmark got slower
+--   $ xmake build benchcmp
+--   $ xmake run benchcmp store bench.json main
+--   $ xmake run benchcmp compare main bench.json --threshold 5
+target("benchcmp")
+    set_kind("binary")
+    set_default(false)
+    add_files("tools/benchcmp/*.cpp")
+
+-- runs bench and compares it with the baseline "main", fails the build
+-- when a benchmark is slower beyond the threshold and the noise, the
+-- arguments are given to benchcmp compare
+--   $ xmake run benchgate --threshold 10
+target("benchgate")
+    set_kind("phony")
+    set_default(false)
+    add_deps("bench", "benchcmp")
+    on_run(function (target)
+        import("core.base.option")
+        local current = path.join(os.projectdir(), "build", "bench_current.json")
+        local baselines = path.join(os.projectdir(), "build", "bench_baselines")
+        os.execv(target:dep("bench"):targetfile(), {"--output", current})
+        local arguments = {"compare", "main", current, "--dir", baselines}
+        table.join2(arguments, option.get("arguments") or {})
+        os.execv(target:dep("benchcmp"):targetfile(), arguments)
+    end)
 
 --
 -- If you want to known more usage about xmake, please see https://xmake.io